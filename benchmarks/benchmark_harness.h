@@ -0,0 +1,124 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_BENCHMARK_HARNESS_H
+#define SOMEIP_BENCHMARK_HARNESS_H
+
+// Minimal Google-Benchmark-style harness: BENCHMARK(fn) registers a
+// void fn(benchmark::State&) that loops `for (auto _ : state)`; the
+// runner calibrates iteration counts to a target wall time and
+// reports ns/op plus derived throughput. Self-contained because the
+// build environment cannot fetch external dependencies.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+class State {
+public:
+    explicit State(uint64_t iterations) : remaining_(iterations), total_(iterations) {}
+
+    struct Iterator {
+        // Empty value type so the idiomatic `for (auto _ : state)`
+        // loop variable never warns; the user-provided constructor is
+        // what keeps -Wunused-but-set-variable quiet
+        struct Value {
+            Value() {}
+            ~Value() {}  // Non-trivial: the loop variable "has effects"
+        };
+
+        State* state;
+        bool operator!=(const Iterator&) const { return state->remaining_ > 0; }
+        void operator++() { state->remaining_--; }
+        Value operator*() const { return {}; }
+    };
+
+    Iterator begin() { return Iterator{this}; }
+    Iterator end() { return Iterator{this}; }
+
+    void SetBytesProcessed(uint64_t bytes) { bytes_ = bytes; }
+    void SetItemsProcessed(uint64_t items) { items_ = items; }
+    uint64_t iterations() const { return total_; }
+
+    uint64_t bytes_{0};
+    uint64_t items_{0};
+
+private:
+    uint64_t remaining_;
+    uint64_t total_;
+};
+
+using BenchFn = std::function<void(State&)>;
+
+struct Registered {
+    std::string name;
+    BenchFn fn;
+};
+
+inline std::vector<Registered>& registry() {
+    static std::vector<Registered> benches;
+    return benches;
+}
+
+struct Registrar {
+    Registrar(const char* name, BenchFn fn) {
+        registry().push_back({name, std::move(fn)});
+    }
+};
+
+inline void run_all() {
+    std::printf("%-44s %14s %16s %12s\n", "benchmark", "ns/op", "ops/s", "MB/s");
+    std::printf("%.*s\n", 90,
+                "------------------------------------------------------------"
+                "------------------------------");
+
+    for (auto& bench : registry()) {
+        // Calibrate: grow iterations until the run takes long enough
+        uint64_t iterations = 1;
+        double seconds = 0.0;
+        uint64_t bytes = 0;
+        while (true) {
+            State state(iterations);
+            auto start = std::chrono::steady_clock::now();
+            bench.fn(state);
+            seconds = std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+            bytes = state.bytes_;
+            if (seconds >= 0.25 || iterations >= (1ull << 30)) {
+                break;
+            }
+            iterations *= (seconds < 0.025) ? 10 : 2;
+        }
+
+        double ns_per_op = seconds * 1e9 / static_cast<double>(iterations);
+        double ops_per_sec = static_cast<double>(iterations) / seconds;
+        double mb_per_sec = bytes > 0
+                                ? static_cast<double>(bytes) / seconds / (1024.0 * 1024.0)
+                                : 0.0;
+        std::printf("%-44s %14.1f %16.0f %12.1f\n", bench.name.c_str(), ns_per_op,
+                    ops_per_sec, mb_per_sec);
+    }
+}
+
+} // namespace benchmark
+
+#define BENCHMARK(fn) \
+    static ::benchmark::Registrar registrar_##fn(#fn, fn)
+
+#endif // SOMEIP_BENCHMARK_HARNESS_H
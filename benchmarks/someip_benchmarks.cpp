@@ -0,0 +1,158 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "benchmark_harness.h"
+#include "serialization/serializer.h"
+#include "someip/message.h"
+#include "transport/udp_transport.h"
+#include "rpc/rpc_client.h"
+#include "rpc/rpc_server.h"
+#include "events/event_publisher.h"
+#include <thread>
+
+using namespace someip;
+
+// ---- Serialization ----------------------------------------------------------
+
+static void BM_SerializeUint32(benchmark::State& state) {
+    serialization::Serializer serializer;
+    for (auto _ : state) {
+        serializer.serialize_uint32(0xDEADBEEF);
+        if (serializer.get_buffer().size() > 1 << 20) {
+            serializer.reset();
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * 4);
+}
+BENCHMARK(BM_SerializeUint32);
+
+static void BM_SerializeUint32Array(benchmark::State& state) {
+    std::vector<uint32_t> values(1024, 0xA5A5A5A5);
+    for (auto _ : state) {
+        serialization::Serializer serializer;
+        serializer.serialize_array(values);
+    }
+    state.SetBytesProcessed(state.iterations() * values.size() * 4);
+}
+BENCHMARK(BM_SerializeUint32Array);
+
+static void BM_MessageSerialize(benchmark::State& state) {
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload(std::vector<uint8_t>(1024, 0x42));
+    for (auto _ : state) {
+        auto bytes = message.serialize();
+        (void)bytes;
+    }
+    state.SetBytesProcessed(state.iterations() * 1040);
+}
+BENCHMARK(BM_MessageSerialize);
+
+static void BM_MessageDeserialize(benchmark::State& state) {
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload(std::vector<uint8_t>(1024, 0x42));
+    auto bytes = message.serialize();
+    for (auto _ : state) {
+        Message decoded;
+        decoded.deserialize(bytes);
+    }
+    state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+BENCHMARK(BM_MessageDeserialize);
+
+// ---- Transport --------------------------------------------------------------
+
+static void BM_UdpLoopbackRoundTrip(benchmark::State& state) {
+    using namespace someip::transport;
+    UdpTransport receiver(Endpoint("127.0.0.1", 47801, TransportProtocol::UDP));
+    UdpTransport sender(Endpoint("127.0.0.1", 47802, TransportProtocol::UDP));
+    if (receiver.start() != Result::SUCCESS || sender.start() != Result::SUCCESS) {
+        return;
+    }
+    Endpoint destination("127.0.0.1", 47801, TransportProtocol::UDP);
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload(std::vector<uint8_t>(256, 0x11));
+
+    for (auto _ : state) {
+        if (sender.send_message(message, destination) != Result::SUCCESS) {
+            break;
+        }
+        while (!receiver.receive_message()) {
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * 272);
+    (void)sender.stop();
+    (void)receiver.stop();
+}
+BENCHMARK(BM_UdpLoopbackRoundTrip);
+
+// ---- RPC --------------------------------------------------------------------
+
+static void BM_RpcSyncCall(benchmark::State& state) {
+    using namespace someip::rpc;
+    RpcServer server(0x1234);
+    if (!server.initialize()) {
+        return;
+    }
+    server.register_method(0x0001,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+            out = in;
+            return RpcResult::SUCCESS;
+        });
+    RpcClient client(0x42, 512);
+    if (!client.initialize()) {
+        return;
+    }
+
+    std::vector<uint8_t> parameters(64, 0x7);
+    for (auto _ : state) {
+        auto result = client.call_method_sync(0x1234, 0x0001, parameters);
+        if (result.result != RpcResult::SUCCESS) {
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    client.shutdown();
+    server.shutdown();
+}
+BENCHMARK(BM_RpcSyncCall);
+
+// ---- Events -----------------------------------------------------------------
+
+static void BM_EventFanOut8Subscribers(benchmark::State& state) {
+    using namespace someip::events;
+    EventPublisher publisher(0x1234, 1);
+    if (!publisher.initialize()) {
+        return;
+    }
+    EventConfig config;
+    config.event_id = 0x8001;
+    config.eventgroup_id = 0x10;
+    config.notification_type = NotificationType::ON_CHANGE;
+    publisher.register_event(config);
+    for (uint16_t client = 1; client <= 8; ++client) {
+        publisher.handle_subscription(0x10, client);
+    }
+
+    std::vector<uint8_t> sample(128, 0x33);
+    for (auto _ : state) {
+        publisher.publish_event(0x8001, sample);
+    }
+    state.SetItemsProcessed(state.iterations() * 8);
+    publisher.shutdown();
+}
+BENCHMARK(BM_EventFanOut8Subscribers);
+
+int main() {
+    benchmark::run_all();
+    return 0;
+}
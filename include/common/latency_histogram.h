@@ -0,0 +1,168 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_COMMON_LATENCY_HISTOGRAM_H
+#define SOMEIP_COMMON_LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace someip {
+
+/**
+ * @brief Low-overhead log-bucketed latency histogram (microseconds)
+ *
+ * Values below 16us are recorded exactly; above that each power-of-two
+ * octave is split into 8 linear sub-buckets, giving ~9% worst-case
+ * value error — plenty for percentile reporting. record() is one
+ * relaxed atomic increment plus a running-sum update, safe from any
+ * thread with no locks; snapshot() merges the buckets on read. All
+ * the Statistics surfaces report p50/p95/p99/p99.9 from this instead
+ * of a single millisecond average, because deployments are tuned by
+ * tail latency, not means.
+ */
+class LatencyHistogram {
+public:
+    /// Merged view of the distribution at one point in time
+    struct Percentiles {
+        uint64_t count{0};
+        uint64_t p50_us{0};
+        uint64_t p95_us{0};
+        uint64_t p99_us{0};
+        uint64_t p999_us{0};
+        uint64_t max_us{0};
+        uint64_t mean_us{0};
+    };
+
+    static constexpr size_t EXACT_LIMIT = 16;     // Values < 16us exact
+    static constexpr size_t SUB_BUCKETS = 8;      // Per octave above that
+    static constexpr size_t MAX_OCTAVE = 40;      // ~ 18 minutes in us
+    static constexpr size_t BUCKET_COUNT =
+        EXACT_LIMIT + (MAX_OCTAVE - 3) * SUB_BUCKETS;
+
+    /**
+     * @brief Record one latency sample
+     */
+    void record(uint64_t microseconds) {
+        buckets_[bucket_index(microseconds)].fetch_add(1, std::memory_order_relaxed);
+        total_us_.fetch_add(microseconds, std::memory_order_relaxed);
+
+        uint64_t previous = max_us_.load(std::memory_order_relaxed);
+        while (microseconds > previous &&
+               !max_us_.compare_exchange_weak(previous, microseconds,
+                                              std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Record a duration sample
+     */
+    template <typename Rep, typename Period>
+    void record(std::chrono::duration<Rep, Period> duration) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        record(us < 0 ? 0 : static_cast<uint64_t>(us));
+    }
+
+    /**
+     * @brief Merge the buckets into percentile values
+     */
+    Percentiles snapshot() const {
+        std::array<uint64_t, BUCKET_COUNT> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+
+        Percentiles result;
+        result.count = total;
+        if (total == 0) {
+            return result;
+        }
+
+        result.max_us = max_us_.load(std::memory_order_relaxed);
+        result.mean_us = total_us_.load(std::memory_order_relaxed) / total;
+        result.p50_us = value_at_quantile(counts, total, 0.50);
+        result.p95_us = value_at_quantile(counts, total, 0.95);
+        result.p99_us = value_at_quantile(counts, total, 0.99);
+        result.p999_us = value_at_quantile(counts, total, 0.999);
+        return result;
+    }
+
+    /**
+     * @brief Discard all recorded samples
+     */
+    void reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        total_us_.store(0, std::memory_order_relaxed);
+        max_us_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static size_t bucket_index(uint64_t microseconds) {
+        if (microseconds < EXACT_LIMIT) {
+            return static_cast<size_t>(microseconds);
+        }
+
+        int msb = 63 - __builtin_clzll(microseconds);
+        size_t octave = static_cast<size_t>(msb);
+        if (octave >= MAX_OCTAVE) {
+            octave = MAX_OCTAVE - 1;
+            microseconds = (1ULL << MAX_OCTAVE) - 1;
+            msb = static_cast<int>(MAX_OCTAVE) - 1;
+        }
+
+        size_t sub = (microseconds >> (msb - 3)) & (SUB_BUCKETS - 1);
+        return EXACT_LIMIT + (octave - 4) * SUB_BUCKETS + sub;
+    }
+
+    /// Lower bound of the values a bucket holds
+    static uint64_t bucket_value(size_t index) {
+        if (index < EXACT_LIMIT) {
+            return index;
+        }
+
+        size_t octave = 4 + (index - EXACT_LIMIT) / SUB_BUCKETS;
+        size_t sub = (index - EXACT_LIMIT) % SUB_BUCKETS;
+        return (1ULL << octave) + sub * (1ULL << (octave - 3));
+    }
+
+    static uint64_t value_at_quantile(const std::array<uint64_t, BUCKET_COUNT>& counts,
+                                      uint64_t total, double quantile) {
+        uint64_t target = static_cast<uint64_t>(quantile * static_cast<double>(total));
+        if (target == 0) {
+            target = 1;
+        }
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            seen += counts[i];
+            if (seen >= target) {
+                return bucket_value(i);
+            }
+        }
+        return bucket_value(BUCKET_COUNT - 1);
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+    std::atomic<uint64_t> total_us_{0};
+    std::atomic<uint64_t> max_us_{0};
+};
+
+} // namespace someip
+
+#endif // SOMEIP_COMMON_LATENCY_HISTOGRAM_H
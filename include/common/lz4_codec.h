@@ -0,0 +1,75 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_COMMON_LZ4_CODEC_H
+#define SOMEIP_COMMON_LZ4_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Self-contained LZ4 block-format codec
+ *
+ * Emits and consumes standard LZ4 block streams (token / literals /
+ * little-endian offset / extended lengths), so frames interoperate
+ * with liblz4 peers; implemented in-tree because the build
+ * environment cannot take external dependencies. The compressor is a
+ * greedy single-probe hash matcher — simple and fast, trading a few
+ * percent of ratio against reference LZ4.
+ *
+ * Compressed SOME/IP payloads carry a small header (magic + original
+ * size) so the receive side can detect and reverse the stage
+ * transparently.
+ */
+namespace lz4 {
+
+/// Prefix on compressed payloads: magic (4) + original size (4, LE)
+constexpr uint8_t PAYLOAD_MAGIC[4] = {'L', 'Z', '4', 0x01};
+constexpr size_t PAYLOAD_HEADER_SIZE = 8;
+
+/**
+ * @brief Compress src into an LZ4 block
+ * @return Compressed bytes (no payload header); empty on failure
+ */
+std::vector<uint8_t> compress_block(const uint8_t* src, size_t size);
+
+/**
+ * @brief Decompress an LZ4 block of known original size
+ * @return false on malformed input
+ */
+bool decompress_block(const uint8_t* src, size_t size, std::vector<uint8_t>& out,
+                      size_t original_size);
+
+/**
+ * @brief Wrap a payload: header + compressed block, only if smaller
+ * @return true when out holds the compressed form (worth sending)
+ */
+bool compress_payload(const std::vector<uint8_t>& payload, std::vector<uint8_t>& out);
+
+/**
+ * @brief Whether a payload carries the compression header
+ */
+bool is_compressed_payload(const uint8_t* data, size_t size);
+
+/**
+ * @brief Reverse compress_payload
+ */
+bool decompress_payload(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+
+} // namespace lz4
+} // namespace someip
+
+#endif // SOMEIP_COMMON_LZ4_CODEC_H
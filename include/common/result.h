@@ -45,6 +45,7 @@ enum class Result : uint8_t {
     INVALID_PROTOCOL_VERSION = 0x14,
     INVALID_INTERFACE_VERSION = 0x15,
     MALFORMED_MESSAGE = 0x16,
+    INSUFFICIENT_DATA = 0x17,
 
     // Session errors
     INVALID_SESSION_ID = 0x20,
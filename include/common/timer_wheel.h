@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_COMMON_TIMER_WHEEL_H
+#define SOMEIP_COMMON_TIMER_WHEEL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Hierarchical timer wheel with a single wakeup thread
+ *
+ * Replaces per-loop deadline scans: insert and cancel are O(1) (slot
+ * list splices via a handle map), and one worker sleeps tick-to-tick,
+ * cascading longer timers down the levels as their horizon nears.
+ * Four levels of 256 slots at a 10ms tick cover ~50 days.
+ *
+ * Optional jitter spreads recurring timers (TTL refreshes, cyclic
+ * offers) so hundreds of services do not synchronize into bursts on
+ * the wire: each firing is delayed by a fresh uniform draw from
+ * [0, jitter].
+ */
+class TimerWheel {
+public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr size_t SLOTS_PER_LEVEL = 256;
+    static constexpr size_t LEVELS = 4;
+
+    explicit TimerWheel(std::chrono::milliseconds tick = std::chrono::milliseconds(10));
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Start the tick thread
+     */
+    void start();
+
+    /**
+     * @brief Stop the tick thread; pending timers never fire
+     */
+    void stop();
+
+    /**
+     * @brief Arm a one-shot timer
+     *
+     * @param delay When to fire, relative to now
+     * @param callback Invoked on the wheel thread
+     * @param jitter Uniform extra delay in [0, jitter]
+     * @return Handle for cancel(); never 0
+     */
+    TimerId schedule(std::chrono::milliseconds delay, Callback callback,
+                     std::chrono::milliseconds jitter = std::chrono::milliseconds(0));
+
+    /**
+     * @brief Arm a recurring timer; each firing re-draws the jitter
+     */
+    TimerId schedule_recurring(std::chrono::milliseconds period, Callback callback,
+                               std::chrono::milliseconds jitter = std::chrono::milliseconds(0));
+
+    /**
+     * @brief Cancel a timer; false if it already fired (one-shot) or is unknown
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief Timers currently armed
+     */
+    size_t pending_count() const;
+
+private:
+    struct Timer {
+        TimerId id{0};
+        uint64_t deadline_tick{0};
+        std::chrono::milliseconds period{0};  // Zero for one-shot
+        std::chrono::milliseconds jitter{0};
+        Callback callback;
+    };
+
+    using Slot = std::list<Timer>;
+
+    void arm_locked(Timer timer, std::chrono::milliseconds delay);
+    void place_locked(Timer timer);
+    void cascade_locked(size_t level, size_t slot_index);
+    void tick_loop();
+
+    std::chrono::milliseconds tick_;
+    std::vector<std::vector<Slot>> wheels_;  // [level][slot]
+    std::unordered_map<TimerId, std::pair<size_t, Slot::iterator>> index_;  // id -> (level*SLOTS+slot, it)
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread worker_;
+    bool running_{false};
+    uint64_t current_tick_{0};
+    TimerId next_id_{1};
+    std::unordered_set<TimerId> firing_;                  // Ids mid-callback
+    std::unordered_set<TimerId> cancelled_while_firing_;  // Cancelled during callback
+    std::minstd_rand jitter_rng_{std::random_device{}()};
+};
+
+} // namespace someip
+
+#endif // SOMEIP_COMMON_TIMER_WHEEL_H
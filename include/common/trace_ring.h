@@ -0,0 +1,118 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_COMMON_TRACE_RING_H
+#define SOMEIP_COMMON_TRACE_RING_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Where on the hot path a trace record was taken
+ */
+enum class TraceSite : uint8_t {
+    RECEIVE = 0,         // Datagram left the socket
+    QUEUE_PUSH,          // Entered the receive ring
+    QUEUE_POP,           // Left the receive ring
+    DESERIALIZE,         // Message decoded
+    DISPATCH,            // Handler about to run
+    HANDLER_RETURN,      // Handler finished
+    SEND                 // Response handed to the socket
+};
+
+/**
+ * @brief One fixed-size trace record
+ */
+struct TraceRecord {
+    uint64_t timestamp_ns{0};
+    uint32_t span_id{0};  // (client_id << 16) | session_id correlates a message
+    TraceSite site{TraceSite::RECEIVE};
+};
+
+/**
+ * @brief Always-on per-thread trace rings
+ *
+ * record() costs one clock read and one store into the calling
+ * thread's private ring (no locks, no atomics on the write path), so
+ * it stays enabled in production. Rings are registered at first use
+ * and survive thread exit, so a post-mortem dump still sees the data.
+ * snapshot_span() correlates all threads' records for one message
+ * into a time-ordered timeline.
+ */
+class TraceRing {
+public:
+    static constexpr size_t RECORDS_PER_THREAD = 4096;  // Power of two
+
+    /**
+     * @brief Record one point; tens of nanoseconds, safe anywhere
+     */
+    static void record(uint32_t span_id, TraceSite site) {
+        ThreadRing& ring = local_ring();
+        TraceRecord& slot = ring.records[ring.next & (RECORDS_PER_THREAD - 1)];
+        slot.timestamp_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+        slot.span_id = span_id;
+        slot.site = site;
+        ring.next++;
+    }
+
+    /// Span id convention for SOME/IP messages
+    static uint32_t span_of(uint16_t client_id, uint16_t session_id) {
+        return (static_cast<uint32_t>(client_id) << 16) | session_id;
+    }
+
+    /**
+     * @brief All records for one span, across threads, time-ordered
+     */
+    static std::vector<TraceRecord> snapshot_span(uint32_t span_id);
+
+    /**
+     * @brief Visit every retained record (all threads, raw order)
+     */
+    template <typename Fn>
+    static void dump(Fn&& fn) {
+        auto rings = all_rings();
+        for (const auto& ring : rings) {
+            size_t count = std::min<size_t>(ring->next, RECORDS_PER_THREAD);
+            for (size_t i = 0; i < count; ++i) {
+                fn(ring->records[i]);
+            }
+        }
+    }
+
+    static const char* site_name(TraceSite site);
+
+private:
+    struct ThreadRing {
+        TraceRecord records[RECORDS_PER_THREAD];
+        size_t next{0};
+    };
+
+    static ThreadRing& local_ring();
+    static std::vector<std::shared_ptr<ThreadRing>> all_rings();
+
+    static std::mutex registry_mutex_;
+    static std::vector<std::shared_ptr<ThreadRing>> registry_;
+};
+
+} // namespace someip
+
+#endif // SOMEIP_COMMON_TRACE_RING_H
@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_CORE_EVENT_LOOP_H
+#define SOMEIP_CORE_EVENT_LOOP_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Shared event-loop runtime
+ *
+ * One thread multiplexes readiness callbacks for any number of file
+ * descriptors (epoll on Linux, poll elsewhere) plus posted tasks, so
+ * components that each used to burn a dedicated receive thread can
+ * share a single poller. Transports opt in via their
+ * attach_to_event_loop hooks; components keep their own threads when
+ * no loop is provided, so adoption is incremental.
+ *
+ * Callbacks run on the loop thread; add_fd/remove_fd/post are safe
+ * from any thread.
+ */
+class EventLoop {
+public:
+    using FdCallback = std::function<void()>;
+    using Task = std::function<void()>;
+
+    EventLoop();
+    ~EventLoop();
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    /**
+     * @brief Start the loop thread
+     */
+    void start();
+
+    /**
+     * @brief Stop and join the loop thread
+     */
+    void stop();
+
+    bool is_running() const { return running_.load(); }
+
+    /**
+     * @brief Watch a descriptor; on_readable runs on the loop thread
+     */
+    bool add_fd(int fd, FdCallback on_readable);
+
+    /**
+     * @brief Stop watching a descriptor
+     */
+    void remove_fd(int fd);
+
+    /**
+     * @brief Run a task on the loop thread as soon as possible
+     */
+    void post(Task task);
+
+    /**
+     * @brief Number of descriptors currently watched
+     */
+    size_t watched_fd_count() const;
+
+private:
+    void loop();
+    void wake();
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<int, FdCallback> callbacks_;
+    std::vector<Task> pending_tasks_;
+
+    int epoll_fd_{-1};           // Linux
+    int wakeup_fds_[2]{-1, -1};  // eventfd on Linux ([1] unused), pipe elsewhere
+};
+
+} // namespace someip
+
+#endif // SOMEIP_CORE_EVENT_LOOP_H
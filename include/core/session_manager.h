@@ -17,8 +17,9 @@
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
-#include <mutex>
+#include <atomic>
 #include <chrono>
+#include <memory>
 
 namespace someip {
 
@@ -130,9 +131,27 @@ public:
     size_t get_active_session_count() const;
 
 private:
-    std::unordered_map<uint16_t, std::shared_ptr<Session>> sessions_;
-    mutable std::mutex sessions_mutex_;
-    uint16_t next_session_id_{1};
+    // Direct-indexed slot per possible 16-bit session id: create is a
+    // CAS claim, validate/update are single atomic loads/stores, and a
+    // freed slot is immediately recyclable — no lock anywhere on the
+    // RPC hot path
+    struct SessionSlot {
+        std::atomic<uint8_t> state{static_cast<uint8_t>(SessionState::INACTIVE)};
+        std::atomic<uint16_t> client_id{0};
+        std::atomic<int64_t> last_activity_ns{0};
+    };
+
+    static constexpr size_t SLOT_COUNT = 65536;
+
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    std::unique_ptr<SessionSlot[]> slots_;
+    std::atomic<uint16_t> next_session_id_{1};
+    std::atomic<size_t> active_count_{0};
 
     // Prevent copying
     SessionManager(const SessionManager&) = delete;
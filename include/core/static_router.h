@@ -0,0 +1,109 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_CORE_STATIC_ROUTER_H
+#define SOMEIP_CORE_STATIC_ROUTER_H
+
+#include <cstdint>
+#include <utility>
+
+namespace someip {
+
+/**
+ * @brief One compile-time route: (service, method) -> handler
+ *
+ * Handler is any callable usable as a non-type template parameter
+ * (free function or captureless lambda converted to function pointer).
+ */
+template <uint16_t ServiceId, uint16_t MethodId, auto Handler>
+struct Route {
+    static constexpr uint16_t service_id = ServiceId;
+    static constexpr uint16_t method_id = MethodId;
+};
+
+/**
+ * @brief Compile-time service routing table
+ *
+ * The whole topology is given as template arguments, so dispatch
+ * compiles to a flat comparison chain the optimizer folds into a
+ * jump table — no runtime maps, no hashing, no locks. Handler
+ * signatures are checked statically against the dispatch arguments
+ * (a mismatch is a compile error), duplicate (service, method) pairs
+ * are rejected at compile time, and handlers for services a binary
+ * never dispatches are dead code the linker elides.
+ *
+ *   using Router = StaticRouter<
+ *       Route<0x1234, 0x0001, &handle_read>,
+ *       Route<0x1234, 0x0002, &handle_write>>;
+ *   Router::dispatch(service, method, request, response);
+ */
+template <typename... Routes>
+class StaticRouter;
+
+template <uint16_t... ServiceIds, uint16_t... MethodIds, auto... Handlers>
+class StaticRouter<Route<ServiceIds, MethodIds, Handlers>...> {
+public:
+    static constexpr size_t route_count = sizeof...(ServiceIds);
+
+    /**
+     * @brief Whether a (service, method) pair is routed — constexpr
+     */
+    static constexpr bool contains(uint16_t service_id, uint16_t method_id) {
+        return (((service_id == ServiceIds) && (method_id == MethodIds)) || ...);
+    }
+
+    /**
+     * @brief Whether any method of a service is routed — constexpr
+     */
+    static constexpr bool contains_service(uint16_t service_id) {
+        return ((service_id == ServiceIds) || ...);
+    }
+
+    /**
+     * @brief Invoke the matching handler; false when unrouted
+     *
+     * Args are forwarded to the handler, so a handler whose signature
+     * does not accept them fails to compile.
+     */
+    template <typename... Args>
+    static bool dispatch(uint16_t service_id, uint16_t method_id, Args&&... args) {
+        bool handled = false;
+        // Fold over the routes: at -O2 this comparison chain becomes a
+        // switch/jump table over the (service << 16 | method) key
+        (void)((service_id == ServiceIds && method_id == MethodIds
+                    ? (Handlers(std::forward<Args>(args)...), handled = true, true)
+                    : false) ||
+               ...);
+        return handled;
+    }
+
+private:
+    static constexpr bool has_duplicate() {
+        constexpr uint32_t keys[] = {
+            (static_cast<uint32_t>(ServiceIds) << 16 | MethodIds)...};
+        for (size_t i = 0; i < route_count; ++i) {
+            for (size_t j = i + 1; j < route_count; ++j) {
+                if (keys[i] == keys[j]) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static_assert(!has_duplicate(), "duplicate (service_id, method_id) route");
+};
+
+} // namespace someip
+
+#endif // SOMEIP_CORE_STATIC_ROUTER_H
@@ -15,6 +15,7 @@
 #define SOMEIP_EVENTS_PUBLISHER_H
 
 #include "event_types.h"
+#include "common/latency_histogram.h"
 #include <memory>
 #include <vector>
 
@@ -97,6 +98,22 @@ public:
      */
     bool publish_event(uint16_t event_id, const std::vector<uint8_t>& data);
 
+    /**
+     * @brief Publish a batch of event notifications in one pass
+     *
+     * Locks once, serializes every sample, and hands the notifications
+     * to the transport grouped by subscriber endpoint so same-
+     * destination datagrams coalesce into as few syscalls (and, with
+     * GSO, wire packets) as possible. Meant for ticks that emit many
+     * correlated signals at once. Samples whose event is not
+     * registered are skipped.
+     *
+     * @param samples Event samples to publish together
+     * @return true if every registered sample was handed to the
+     *         transport successfully, false on any send failure
+     */
+    bool publish_events(const std::vector<EventSample>& samples);
+
     /**
      * @brief Publish a field notification (immediate update)
      *
@@ -106,6 +123,27 @@ public:
      */
     bool publish_field(uint16_t event_id, const std::vector<uint8_t>& data);
 
+    /**
+     * @brief Configure multicast delivery for an eventgroup
+     *
+     * Once the eventgroup's subscriber count reaches
+     * subscriber_threshold, notifications go out as one datagram to
+     * the multicast endpoint instead of N unicasts (subscribers join
+     * the group via UdpTransport::join_multicast_group and filter
+     * locally). Below the threshold, unicast fan-out — including
+     * filter evaluation — continues as usual.
+     *
+     * @param eventgroup_id Event group to configure
+     * @param multicast_address Multicast group address (e.g. from SD offer)
+     * @param port Multicast UDP port
+     * @param subscriber_threshold Subscriber count at which to switch
+     * @param interface_address Optional egress interface to pin
+     * @return true if configured
+     */
+    bool set_eventgroup_multicast(uint16_t eventgroup_id, const std::string& multicast_address,
+                                  uint16_t port, size_t subscriber_threshold,
+                                  const std::string& interface_address = std::string());
+
     /**
      * @brief Handle event subscription request
      *
@@ -158,7 +196,8 @@ public:
         uint32_t notifications_sent{0};
         uint32_t subscriptions_active{0};
         uint32_t subscriptions_rejected{0};
-        std::chrono::milliseconds average_publish_time{0};
+        std::chrono::milliseconds average_publish_time{0};  // Derived from the histogram mean
+        LatencyHistogram::Percentiles publish_time{};       // p50/p95/p99/p99.9 in us
     };
     Statistics get_statistics() const;
 
@@ -15,6 +15,7 @@
 #define SOMEIP_EVENTS_SUBSCRIBER_H
 
 #include "event_types.h"
+#include "common/latency_histogram.h"
 #include <memory>
 #include <vector>
 
@@ -112,6 +113,23 @@ public:
     bool set_event_filters(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
                          const std::vector<EventFilter>& filters);
 
+    /**
+     * @brief Decouple notification callbacks from the receive path
+     *
+     * With the executor enabled, callbacks run on a worker pool fed by
+     * a bounded queue drained in batches, so one slow application
+     * callback (JSON logging and friends) cannot back up the UDP
+     * receive queue. Overflow policy is explicit: drop-oldest with a
+     * counter, or coalesce-to-latest per event id for value-like
+     * events where only the newest sample matters.
+     *
+     * @param worker_count Drain threads
+     * @param queue_depth Pending-notification bound
+     * @param coalesce_to_latest Replace queued samples of the same event
+     */
+    void enable_async_delivery(size_t worker_count = 1, size_t queue_depth = 256,
+                               bool coalesce_to_latest = false);
+
     /**
      * @brief Get active subscriptions
      *
@@ -147,7 +165,9 @@ public:
         uint32_t notifications_received{0};
         uint32_t subscription_requests_sent{0};
         uint32_t subscription_responses_received{0};
-        std::chrono::milliseconds average_response_time{0};
+        uint32_t notifications_dropped{0};                   // Executor overflow
+        std::chrono::milliseconds average_response_time{0};  // Derived from the histogram mean
+        LatencyHistogram::Percentiles notification_dispatch_time{};  // p50/p95/p99/p99.9 in us
     };
     Statistics get_statistics() const;
 
@@ -106,6 +106,22 @@ struct EventNotification {
     }
 };
 
+/**
+ * @brief One event's worth of data in a batched publication
+ *
+ * A tick's correlated signals are passed to publish_events as a batch
+ * of these, so the publisher locks and walks the subscriber table
+ * once for the whole group.
+ */
+struct EventSample {
+    uint16_t event_id{0};
+    std::vector<uint8_t> data;
+
+    EventSample() = default;
+    EventSample(uint16_t id, std::vector<uint8_t> sample_data)
+        : event_id(id), data(std::move(sample_data)) {}
+};
+
 /**
  * @brief Event configuration
  */
@@ -121,6 +137,11 @@ struct EventConfig {
 
 /**
  * @brief Event filter for selective notifications
+ *
+ * filter_data is compared as a payload prefix: a subscriber holding
+ * filters for an event receives only samples whose payload starts
+ * with one of its filters' bytes. Events the subscriber holds no
+ * filter for are delivered unfiltered.
  */
 struct EventFilter {
     uint16_t event_id;
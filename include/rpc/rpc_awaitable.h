@@ -0,0 +1,253 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_RPC_AWAITABLE_H
+#define SOMEIP_RPC_AWAITABLE_H
+
+/**
+ * C++20 coroutine layer over RpcClient's async machinery.
+ *
+ * The library itself builds as C++17; this header activates only when
+ * the including translation unit is compiled with coroutine support
+ * (-std=c++20), so sequential diagnostic flows can be written as
+ *
+ *   RpcTask<int> sequence(RpcClient& client) {
+ *       auto a = co_await call(client, SERVICE, METHOD_A, params);
+ *       auto b = co_await call(client, SERVICE, METHOD_B, a.return_values);
+ *       co_return decode(b);
+ *   }
+ *
+ * instead of callback pyramids or thread-blocking sync calls.
+ */
+
+#if defined(__cpp_impl_coroutine)
+
+#include "rpc/rpc_client.h"
+#include <condition_variable>
+#include <coroutine>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace someip {
+namespace rpc {
+
+/**
+ * @brief Where a resumed coroutine continues running
+ *
+ * The default (empty) executor resumes inline on the transport's
+ * receive thread; handing one in moves resumption off that thread.
+ */
+using RpcExecutor = std::function<void(std::function<void()>)>;
+
+/**
+ * @brief Awaitable wrapping one call_method_async invocation
+ *
+ * The awaiter owns the parameter buffer and the response, so the only
+ * per-call allocations are the coroutine frame and whatever the
+ * underlying async path already does; the completion callback captures
+ * a single pointer and stays within std::function's inline storage.
+ */
+class RpcCallAwaitable {
+public:
+    RpcCallAwaitable(RpcClient& client, uint16_t service_id, MethodId method_id,
+                     std::vector<uint8_t> parameters, RpcTimeout timeout,
+                     RpcExecutor executor)
+        : client_(client), service_id_(service_id), method_id_(method_id),
+          parameters_(std::move(parameters)), timeout_(timeout),
+          executor_(std::move(executor)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    bool await_suspend(std::coroutine_handle<> handle) {
+        continuation_ = handle;
+
+        RpcCallHandle call_handle = client_.call_method_async(
+            service_id_, method_id_, parameters_,
+            [this](const RpcResponse& response) { complete(response); }, timeout_);
+
+        if (call_handle == 0) {
+            // Send failed synchronously: resume right away with an error
+            response_.emplace(service_id_, method_id_, uint16_t(0), uint16_t(0),
+                              RpcResult::NETWORK_ERROR);
+            return false;
+        }
+
+        return true;
+    }
+
+    RpcResponse await_resume() { return std::move(*response_); }
+
+private:
+    void complete(const RpcResponse& response) {
+        response_ = response;
+        if (executor_) {
+            executor_([handle = continuation_]() { handle.resume(); });
+        } else {
+            continuation_.resume();
+        }
+    }
+
+    RpcClient& client_;
+    uint16_t service_id_;
+    MethodId method_id_;
+    std::vector<uint8_t> parameters_;
+    RpcTimeout timeout_;
+    RpcExecutor executor_;
+    std::coroutine_handle<> continuation_;
+    std::optional<RpcResponse> response_;
+};
+
+/**
+ * @brief co_await entry point: call(client, service, method, params)
+ *
+ * GCC 12 note: brace-initialized vector literals inside a coroutine
+ * body ("call(c, s, m, {0x01})") trip a compiler bug ("array used as
+ * initializer") because of the initializer_list backing array; build
+ * the parameter vector with parentheses or a named variable instead.
+ */
+inline RpcCallAwaitable call(RpcClient& client, uint16_t service_id, MethodId method_id,
+                             std::vector<uint8_t> parameters, RpcTimeout timeout,
+                             RpcExecutor executor) {
+    return RpcCallAwaitable(client, service_id, method_id, std::move(parameters),
+                            timeout, std::move(executor));
+}
+
+inline RpcCallAwaitable call(RpcClient& client, uint16_t service_id, MethodId method_id,
+                             std::vector<uint8_t> parameters, RpcTimeout timeout) {
+    return call(client, service_id, method_id, std::move(parameters), timeout,
+                RpcExecutor());
+}
+
+inline RpcCallAwaitable call(RpcClient& client, uint16_t service_id, MethodId method_id,
+                             std::vector<uint8_t> parameters) {
+    return call(client, service_id, method_id, std::move(parameters), RpcTimeout(),
+                RpcExecutor());
+}
+
+namespace detail {
+
+struct SyncSignal {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done{false};
+};
+
+// One-shot coroutine used as a task continuation: resuming it fires
+// the signal and the frame frees itself (final_suspend never suspends)
+struct SignalTask {
+    struct promise_type {
+        SignalTask get_return_object() {
+            return SignalTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+};
+
+inline SignalTask make_signal_task(SyncSignal& signal) {
+    {
+        std::scoped_lock lock(signal.mutex);
+        signal.done = true;
+    }
+    signal.cv.notify_one();
+    co_return;
+}
+
+} // namespace detail
+
+/**
+ * @brief Lazily-started coroutine task carrying a result of type T
+ *
+ * Awaiting an RpcTask starts it and resumes the awaiter when it
+ * finishes; sync_wait() bridges back into non-coroutine code.
+ */
+template <typename T>
+class RpcTask {
+public:
+    struct promise_type {
+        std::optional<T> value;  // T need not be default-constructible
+        std::coroutine_handle<> continuation;
+
+        RpcTask get_return_object() {
+            return RpcTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<promise_type> handle) noexcept {
+                auto continuation = handle.promise().continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_value(T result) { value = std::move(result); }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    explicit RpcTask(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+    RpcTask(RpcTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+    RpcTask(const RpcTask&) = delete;
+    RpcTask& operator=(const RpcTask&) = delete;
+    RpcTask& operator=(RpcTask&&) = delete;
+
+    ~RpcTask() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Awaiting a task starts it; the task resumes us on completion
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> awaiter) {
+        handle_.promise().continuation = awaiter;
+        handle_.resume();
+    }
+    T await_resume() { return std::move(*handle_.promise().value); }
+
+    /**
+     * @brief Run the task to completion from non-coroutine code
+     *
+     * The task's continuation is a tiny self-destroying coroutine that
+     * fires the condition variable: by the time it runs, the task sits
+     * safely at its final suspend point, so destruction after the wait
+     * cannot race the producer thread.
+     */
+    T sync_wait() {
+        detail::SyncSignal signal;
+        handle_.promise().continuation = detail::make_signal_task(signal).handle;
+        handle_.resume();
+
+        std::unique_lock lock(signal.mutex);
+        signal.cv.wait(lock, [&signal] { return signal.done; });
+        return std::move(*handle_.promise().value);
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+} // namespace rpc
+} // namespace someip
+
+#endif // defined(__cpp_impl_coroutine)
+
+#endif // SOMEIP_RPC_AWAITABLE_H
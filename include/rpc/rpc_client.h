@@ -15,6 +15,7 @@
 #define SOMEIP_RPC_CLIENT_H
 
 #include "rpc/rpc_types.h"
+#include "common/latency_histogram.h"
 #include <memory>
 
 namespace someip {
@@ -37,7 +38,12 @@ public:
      * @brief Constructor
      * @param client_id Unique client identifier
      */
-    explicit RpcClient(uint16_t client_id);
+    /**
+     * @param client_id Client identifier for outgoing requests
+     * @param max_outstanding_calls In-flight call table size (rounded
+     *        up to a power of two); calls beyond it fail with handle 0
+     */
+    explicit RpcClient(uint16_t client_id, size_t max_outstanding_calls = 256);
 
     /**
      * @brief Destructor
@@ -74,6 +80,13 @@ public:
                                    const std::vector<uint8_t>& parameters,
                                    const RpcTimeout& timeout = RpcTimeout());
 
+    /**
+     * @brief Synchronous call lending the parameter buffer (no copy)
+     */
+    RpcSyncResult call_method_sync(uint16_t service_id, MethodId method_id,
+                                   std::vector<uint8_t>&& parameters,
+                                   const RpcTimeout& timeout = RpcTimeout());
+
     /**
      * @brief Asynchronous RPC method call
      *
@@ -89,6 +102,39 @@ public:
                                     RpcCallback callback,
                                     const RpcTimeout& timeout = RpcTimeout());
 
+    /**
+     * @brief Asynchronous call lending the parameter buffer (no copy)
+     */
+    RpcCallHandle call_method_async(uint16_t service_id, MethodId method_id,
+                                    std::vector<uint8_t>&& parameters,
+                                    RpcCallback callback,
+                                    const RpcTimeout& timeout = RpcTimeout());
+
+    /**
+     * @brief Opt into request batching
+     *
+     * While enabled, outgoing requests are packed back-to-back into a
+     * shared buffer and sent as one datagram when the buffer reaches
+     * max_batch_bytes, when the flush window elapses, or on an
+     * explicit flush(). A 30-getter control cycle then costs one
+     * datagram instead of 30.
+     *
+     * @param max_batch_bytes Flush when the packed size would exceed this
+     * @param flush_window Longest a request waits before being sent
+     */
+    void enable_request_batching(size_t max_batch_bytes = 1400,
+                                 std::chrono::milliseconds flush_window = std::chrono::milliseconds(1));
+
+    /**
+     * @brief Flush any batched requests and return to per-call sends
+     */
+    void disable_request_batching();
+
+    /**
+     * @brief Send any batched requests immediately
+     */
+    void flush();
+
     /**
      * @brief Cancel asynchronous RPC call
      *
@@ -114,7 +160,8 @@ public:
         uint32_t successful_calls{0};
         uint32_t failed_calls{0};
         uint32_t timeout_calls{0};
-        std::chrono::milliseconds average_response_time{0};
+        std::chrono::milliseconds average_response_time{0};  // Derived from the histogram mean
+        LatencyHistogram::Percentiles response_time{};        // p50/p95/p99/p99.9 in us
     };
     Statistics get_statistics() const;
 
@@ -15,6 +15,8 @@
 #define SOMEIP_RPC_SERVER_H
 
 #include "rpc/rpc_types.h"
+#include "common/latency_histogram.h"
+#include "transport/transport.h"
 #include <memory>
 #include <functional>
 
@@ -39,6 +41,52 @@ using MethodHandler = std::function<RpcResult(
     std::vector<uint8_t>& output_params
 )>;
 
+/**
+ * @brief Borrowed view of one incoming request
+ *
+ * data/size point straight into the received message's payload — no
+ * copy is made — and stay valid only for the handler's duration.
+ * Handlers that must keep the bytes copy what they need.
+ */
+struct RpcRequestView {
+    uint16_t client_id{0};
+    uint16_t session_id{0};
+    const uint8_t* data{nullptr};
+    size_t size{0};
+};
+
+/**
+ * @brief Zero-copy method handler
+ *
+ * Receives the request as a borrowed view and fills output_params,
+ * which is moved into the response message rather than copied.
+ */
+using MethodViewHandler = std::function<RpcResult(
+    const RpcRequestView& request,
+    std::vector<uint8_t>& output_params
+)>;
+
+/**
+ * @brief Where a method's handler runs
+ *
+ * INLINE_FAST handlers execute on the transport receive path (right
+ * for microsecond-scale work); OFFLOAD handlers are dispatched to the
+ * worker pool so a slow method cannot head-of-line block the rest of
+ * the service.
+ */
+enum class DispatchMode : uint8_t {
+    INLINE_FAST,
+    OFFLOAD
+};
+
+/**
+ * @brief RPC Server dispatch configuration
+ */
+struct RpcServerConfig {
+    size_t worker_count{2};   // Offload pool size; 0 forces everything inline
+    size_t queue_depth{64};   // Per-worker bound; overflow is shed with an error
+};
+
 /**
  * @brief SOME/IP RPC Server Interface
  *
@@ -50,8 +98,27 @@ public:
     /**
      * @brief Constructor
      * @param service_id Service identifier this server handles
+     * @param config Worker pool configuration for offloaded methods
+     */
+    explicit RpcServer(uint16_t service_id, const RpcServerConfig& config = RpcServerConfig());
+
+    /**
+     * @brief Host this service on a shared transport (demux mode)
+     *
+     * The server sends responses through the shared transport and
+     * expects inbound requests via handle_demuxed_message (wired from
+     * a ServiceDemux route); it owns no socket and spawns no receive
+     * thread of its own.
+     */
+    RpcServer(uint16_t service_id,
+              std::shared_ptr<transport::ITransport> shared_transport,
+              const RpcServerConfig& config = RpcServerConfig());
+
+    /**
+     * @brief Inject a demuxed inbound message (demux mode)
      */
-    explicit RpcServer(uint16_t service_id);
+    void handle_demuxed_message(MessagePtr message,
+                                const transport::Endpoint& sender);
 
     /**
      * @brief Destructor
@@ -82,7 +149,18 @@ public:
      * @param handler Function to handle method calls
      * @return true if registered successfully, false if method already exists
      */
-    bool register_method(MethodId method_id, MethodHandler handler);
+    bool register_method(MethodId method_id, MethodHandler handler,
+                         DispatchMode mode = DispatchMode::INLINE_FAST);
+
+    /**
+     * @brief Register a zero-copy handler (borrowed request view)
+     *
+     * The vector-based overload converts the payload to a vector per
+     * request; this one hands the handler a view into the receive
+     * buffer instead, saving a full payload copy on large uploads.
+     */
+    bool register_method(MethodId method_id, MethodViewHandler handler,
+                         DispatchMode mode = DispatchMode::INLINE_FAST);
 
     /**
      * @brief Unregister a method handler
@@ -92,6 +170,19 @@ public:
      */
     bool unregister_method(MethodId method_id);
 
+    /**
+     * @brief Freeze the method set into a flat dispatch table
+     *
+     * Builds a direct-indexed array over the registered method ids and
+     * publishes it atomically: from then on the request path resolves
+     * handlers with one indexed load — no lock, no hash — and
+     * register/unregister calls are refused. Call once after startup
+     * registration completes.
+     *
+     * @return true if frozen, false if already frozen or nothing registered
+     */
+    bool freeze();
+
     /**
      * @brief Check if method is registered
      *
@@ -124,7 +215,10 @@ public:
         uint32_t successful_calls{0};
         uint32_t failed_calls{0};
         uint32_t method_not_found_errors{0};
-        std::chrono::milliseconds average_processing_time{0};
+        uint32_t requests_offloaded{0};                       // Handed to the worker pool
+        uint32_t requests_shed{0};                            // Dropped: queues full
+        std::chrono::milliseconds average_processing_time{0};  // Derived from the histogram mean
+        LatencyHistogram::Percentiles processing_time{};        // p50/p95/p99/p99.9 in us
     };
     Statistics get_statistics() const;
 
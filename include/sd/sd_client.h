@@ -62,6 +62,21 @@ public:
      */
     void shutdown();
 
+    /**
+     * @brief Attach a memory-mapped persistent discovery cache
+     *
+     * Loads last-known (service, instance, endpoint) records whose TTL
+     * deadline has not passed into the available-services registry
+     * immediately — stale-but-usable until refuted by live discovery —
+     * so a restarted process can issue its first RPC in milliseconds
+     * instead of waiting out a FindService round trip or offer cycle.
+     * The cache is updated as offers and stop-offers reconcile.
+     *
+     * @param path Cache file path (created if absent)
+     * @return true if the cache is mapped
+     */
+    bool enable_persistent_cache(const std::string& path);
+
     /**
      * @brief Find available service instances
      *
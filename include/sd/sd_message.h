@@ -15,6 +15,9 @@
 #define SOMEIP_SD_MESSAGE_H
 
 #include "sd_types.h"
+#include <algorithm>
+#include <deque>
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -41,10 +44,20 @@ public:
     uint8_t get_index2() const { return index2_; }
     void set_index2(uint8_t index) { index2_ = index; }
 
-    virtual std::vector<uint8_t> serialize() const = 0;
+    /// Convenience wrapper over serialize_into
+    std::vector<uint8_t> serialize() const {
+        std::vector<uint8_t> out;
+        serialize_into(out);
+        return out;
+    }
+
+    /// Append the wire bytes to out without a temporary buffer
+    virtual void serialize_into(std::vector<uint8_t>& out) const = 0;
     virtual bool deserialize(const std::vector<uint8_t>& data, size_t& offset) = 0;
 
 protected:
+    void serialize_base_into(std::vector<uint8_t>& out) const;
+
     EntryType type_{EntryType::FIND_SERVICE};
     uint8_t index1_{0};
     uint8_t index2_{0};
@@ -71,7 +84,7 @@ public:
     uint8_t get_minor_version() const { return minor_version_; }
     void set_minor_version(uint8_t version) { minor_version_ = version; }
 
-    std::vector<uint8_t> serialize() const override;
+    void serialize_into(std::vector<uint8_t>& out) const override;
     bool deserialize(const std::vector<uint8_t>& data, size_t& offset) override;
 
 private:
@@ -101,7 +114,7 @@ public:
     uint8_t get_major_version() const { return major_version_; }
     void set_major_version(uint8_t version) { major_version_ = version; }
 
-    std::vector<uint8_t> serialize() const override;
+    void serialize_into(std::vector<uint8_t>& out) const override;
     bool deserialize(const std::vector<uint8_t>& data, size_t& offset) override;
 
 private:
@@ -122,10 +135,20 @@ public:
     OptionType get_type() const { return type_; }
     uint16_t get_length() const { return length_; }
 
-    virtual std::vector<uint8_t> serialize() const = 0;
+    /// Convenience wrapper over serialize_into
+    std::vector<uint8_t> serialize() const {
+        std::vector<uint8_t> out;
+        serialize_into(out);
+        return out;
+    }
+
+    /// Append the wire bytes to out without a temporary buffer
+    virtual void serialize_into(std::vector<uint8_t>& out) const = 0;
     virtual bool deserialize(const std::vector<uint8_t>& data, size_t& offset) = 0;
 
 protected:
+    void serialize_base_into(std::vector<uint8_t>& out) const;
+
     OptionType type_{OptionType::IPV4_ENDPOINT};
     uint16_t length_{0};
 };
@@ -150,7 +173,7 @@ public:
     void set_ipv4_address_from_string(const std::string& ip_address);
     std::string get_ipv4_address_string() const;
 
-    std::vector<uint8_t> serialize() const override;
+    void serialize_into(std::vector<uint8_t>& out) const override;
     bool deserialize(const std::vector<uint8_t>& data, size_t& offset) override;
 
 private:
@@ -159,6 +182,34 @@ private:
     uint16_t port_{0};         // Port in network byte order
 };
 
+/**
+ * @brief Configuration Option (free-form capability/config bytes)
+ *
+ * Carries capability strings such as "lz4" so peers can negotiate
+ * optional features like transparent payload compression.
+ */
+class ConfigurationOption : public SdOption {
+public:
+    ConfigurationOption() : SdOption(OptionType::CONFIGURATION) {}
+
+    const std::vector<uint8_t>& get_data() const { return data_; }
+    void set_data(std::vector<uint8_t> data) { data_ = std::move(data); }
+
+    void set_string(const std::string& value) {
+        data_.assign(value.begin(), value.end());
+    }
+    bool contains_string(const std::string& value) const {
+        return std::search(data_.begin(), data_.end(), value.begin(), value.end()) !=
+               data_.end();
+    }
+
+    void serialize_into(std::vector<uint8_t>& out) const override;
+    bool deserialize(const std::vector<uint8_t>& data, size_t& offset) override;
+
+private:
+    std::vector<uint8_t> data_;
+};
+
 /**
  * @brief IPv4 Multicast Option
  */
@@ -172,7 +223,7 @@ public:
     uint16_t get_port() const { return port_; }
     void set_port(uint16_t port) { port_ = port; }
 
-    std::vector<uint8_t> serialize() const override;
+    void serialize_into(std::vector<uint8_t>& out) const override;
     bool deserialize(const std::vector<uint8_t>& data, size_t& offset) override;
 
 private:
@@ -200,6 +251,7 @@ public:
     void add_option(std::unique_ptr<SdOption> option);
 
     std::vector<uint8_t> serialize() const;
+    void serialize_into(std::vector<uint8_t>& out) const;
     bool deserialize(const std::vector<uint8_t>& data);
 
     // Helper methods
@@ -230,6 +282,57 @@ private:
     std::vector<std::unique_ptr<SdOption>> options_;
 };
 
+/**
+ * @brief Reusable SD message builder with arena-style storage
+ *
+ * Entries and options live in pooled deques whose nodes survive
+ * reset(), and serialization appends into a retained buffer — so a
+ * subscribe/ack storm encodes thousands of messages with no heap
+ * allocation once the pools have warmed to the burst's high-water
+ * mark. References returned by the add_* methods stay valid until
+ * reset().
+ */
+class SdMessageBuilder {
+public:
+    SdMessageBuilder() = default;
+
+    void set_flags(uint8_t flags) { flags_ = flags; }
+
+    ServiceEntry& add_service_entry(EntryType type);
+    EventGroupEntry& add_eventgroup_entry(EntryType type);
+    IPv4EndpointOption& add_ipv4_endpoint_option();
+    ConfigurationOption& add_configuration_option();
+
+    size_t entry_count() const { return entry_order_.size(); }
+    size_t option_count() const { return option_order_.size(); }
+
+    /**
+     * @brief Serialize into the retained buffer (valid until reset)
+     *
+     * Byte-identical to assembling an SdMessage from the same parts.
+     */
+    const std::vector<uint8_t>& build();
+
+    /**
+     * @brief Start the next message, keeping all capacity
+     */
+    void reset();
+
+private:
+    std::deque<ServiceEntry> service_pool_;
+    std::deque<EventGroupEntry> eventgroup_pool_;
+    std::deque<IPv4EndpointOption> endpoint_pool_;
+    std::deque<ConfigurationOption> config_pool_;
+    size_t service_used_{0};
+    size_t eventgroup_used_{0};
+    size_t endpoint_used_{0};
+    size_t config_used_{0};
+    std::vector<std::pair<uint8_t, size_t>> entry_order_;   // (pool tag, index)
+    std::vector<std::pair<uint8_t, size_t>> option_order_;  // (pool tag, index)
+    std::vector<uint8_t> buffer_;
+    uint8_t flags_{0};
+};
+
 // Type aliases for convenience
 using SdEntryPtr = std::unique_ptr<SdEntry>;
 using SdOptionPtr = std::unique_ptr<SdOption>;
@@ -76,6 +76,7 @@ struct ServiceInstance {
     uint16_t port{0};
     uint8_t protocol{0x11};  // Default to UDP (0x11)
     uint32_t ttl_seconds{0};  // Time to live
+    bool supports_compression{false};  // Peer advertised the LZ4 capability
 
     ServiceInstance(uint16_t svc_id = 0, uint16_t inst_id = 0,
                    uint8_t maj_ver = 0, uint8_t min_ver = 0)
@@ -110,6 +111,11 @@ struct SdConfig {
     uint8_t repetition_multiplier{2};                   // Exponential backoff multiplier
     std::chrono::milliseconds cyclic_offer{30000};     // Cyclic offer interval (30s)
     std::chrono::milliseconds ttl{3600000};           // Default TTL (1 hour)
+    std::chrono::milliseconds find_aggregation_window{50};  // Coalesce identical finds
+    std::chrono::milliseconds max_response_delay{100};      // Randomized response pacing
+    uint32_t subscription_ttl_seconds{3600};                // Eventgroup subscription TTL
+    std::chrono::milliseconds renewal_cohort_window{1000};  // Renewal batching jitter
+    bool advertise_compression{false};                      // Offer the LZ4 capability
 };
 
 /**
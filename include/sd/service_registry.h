@@ -0,0 +1,206 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SD_SERVICE_REGISTRY_H
+#define SOMEIP_SD_SERVICE_REGISTRY_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace someip {
+namespace sd {
+
+/**
+ * @brief Hash-indexed registry of per-(service, instance) entries
+ *
+ * Replaces the linearly-scanned vectors in SdServerImpl/SdClientImpl:
+ * exact (service_id, instance_id) lookups are one hash probe, and a
+ * secondary per-service bucket answers wildcard-instance (0xFFFF)
+ * queries without touching unrelated services. Entry addresses are
+ * stable across inserts/erases (unordered_map nodes), so callers may
+ * hold pointers while the registry lock is held.
+ */
+template <typename T>
+class ServiceRegistry {
+public:
+    static constexpr uint16_t ANY_INSTANCE = 0xFFFF;
+
+    /**
+     * @brief Exact lookup; ANY_INSTANCE returns the service's first entry
+     */
+    T* find(uint16_t service_id, uint16_t instance_id) {
+        if (instance_id == ANY_INSTANCE) {
+            auto bucket = by_service_.find(service_id);
+            if (bucket == by_service_.end() || bucket->second.empty()) {
+                return nullptr;
+            }
+            instance_id = bucket->second.front();
+        }
+
+        auto it = entries_.find(make_key(service_id, instance_id));
+        return it == entries_.end() ? nullptr : &it->second;
+    }
+
+    const T* find(uint16_t service_id, uint16_t instance_id) const {
+        return const_cast<ServiceRegistry*>(this)->find(service_id, instance_id);
+    }
+
+    /**
+     * @brief All entries of one service (wildcard bucket)
+     */
+    std::vector<T*> find_all(uint16_t service_id) {
+        std::vector<T*> result;
+        auto bucket = by_service_.find(service_id);
+        if (bucket == by_service_.end()) {
+            return result;
+        }
+
+        result.reserve(bucket->second.size());
+        for (uint16_t instance_id : bucket->second) {
+            auto it = entries_.find(make_key(service_id, instance_id));
+            if (it != entries_.end()) {
+                result.push_back(&it->second);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Insert or replace; returns the stored entry
+     */
+    T& insert(uint16_t service_id, uint16_t instance_id, T value) {
+        uint32_t key = make_key(service_id, instance_id);
+        auto [it, inserted] = entries_.insert_or_assign(key, std::move(value));
+        if (inserted) {
+            by_service_[service_id].push_back(instance_id);
+        }
+        return it->second;
+    }
+
+    std::vector<const T*> find_all(uint16_t service_id) const {
+        std::vector<const T*> result;
+        auto bucket = by_service_.find(service_id);
+        if (bucket == by_service_.end()) {
+            return result;
+        }
+
+        result.reserve(bucket->second.size());
+        for (uint16_t instance_id : bucket->second) {
+            auto it = entries_.find(make_key(service_id, instance_id));
+            if (it != entries_.end()) {
+                result.push_back(&it->second);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Whether an exact entry exists
+     */
+    bool contains(uint16_t service_id, uint16_t instance_id) const {
+        return entries_.count(make_key(service_id, instance_id)) != 0;
+    }
+
+    bool erase(uint16_t service_id, uint16_t instance_id) {
+        if (entries_.erase(make_key(service_id, instance_id)) == 0) {
+            return false;
+        }
+
+        auto bucket = by_service_.find(service_id);
+        if (bucket != by_service_.end()) {
+            auto& instances = bucket->second;
+            for (auto it = instances.begin(); it != instances.end(); ++it) {
+                if (*it == instance_id) {
+                    instances.erase(it);
+                    break;
+                }
+            }
+            if (instances.empty()) {
+                by_service_.erase(bucket);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Visit every entry (iteration order unspecified)
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (auto& pair : entries_) {
+            fn(pair.second);
+        }
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (const auto& pair : entries_) {
+            fn(pair.second);
+        }
+    }
+
+    /**
+     * @brief Remove entries the predicate selects; returns count removed
+     */
+    template <typename Pred>
+    size_t erase_if(Pred&& pred) {
+        size_t removed = 0;
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (pred(it->second)) {
+                uint16_t service_id = static_cast<uint16_t>(it->first >> 16);
+                uint16_t instance_id = static_cast<uint16_t>(it->first & 0xFFFF);
+                it = entries_.erase(it);
+                ++removed;
+
+                auto bucket = by_service_.find(service_id);
+                if (bucket != by_service_.end()) {
+                    auto& instances = bucket->second;
+                    for (auto iit = instances.begin(); iit != instances.end(); ++iit) {
+                        if (*iit == instance_id) {
+                            instances.erase(iit);
+                            break;
+                        }
+                    }
+                    if (instances.empty()) {
+                        by_service_.erase(bucket);
+                    }
+                }
+            } else {
+                ++it;
+            }
+        }
+        return removed;
+    }
+
+    size_t size() const { return entries_.size(); }
+    bool empty() const { return entries_.empty(); }
+
+    void clear() {
+        entries_.clear();
+        by_service_.clear();
+    }
+
+private:
+    static uint32_t make_key(uint16_t service_id, uint16_t instance_id) {
+        return (static_cast<uint32_t>(service_id) << 16) | instance_id;
+    }
+
+    std::unordered_map<uint32_t, T> entries_;
+    std::unordered_map<uint16_t, std::vector<uint16_t>> by_service_;
+};
+
+} // namespace sd
+} // namespace someip
+
+#endif // SOMEIP_SD_SERVICE_REGISTRY_H
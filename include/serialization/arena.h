@@ -0,0 +1,134 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SERIALIZATION_ARENA_H
+#define SOMEIP_SERIALIZATION_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace someip {
+namespace serialization {
+
+/**
+ * @brief Monotonic block allocator for per-message decode results
+ *
+ * Allocations bump a pointer inside pre-allocated blocks and are never
+ * freed individually; reset() rewinds the whole arena in O(1) while
+ * keeping the blocks for reuse. Intended pattern: decode one message
+ * with all containers drawing from the arena, hand the results to the
+ * handler, then reset() before the next message — one allocation
+ * burst is amortized away instead of dozens of malloc/free pairs.
+ *
+ * Not thread-safe; use one Arena per decoding thread.
+ */
+class Arena {
+public:
+    static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+    explicit Arena(size_t block_size = kDefaultBlockSize);
+    ~Arena() = default;
+
+    // Non-copyable, non-movable (allocations point into the blocks)
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Allocate aligned storage from the current block
+     *
+     * Grows by a new block when the request does not fit; oversized
+     * requests get a dedicated block.
+     */
+    void* allocate(size_t bytes, size_t alignment);
+
+    /**
+     * @brief Rewind the arena, invalidating everything allocated from it
+     *
+     * Blocks are kept for reuse, so steady-state decoding stops hitting
+     * the system allocator entirely.
+     */
+    void reset();
+
+    /// Bytes handed out since construction or the last reset()
+    size_t get_bytes_used() const { return bytes_used_; }
+
+    /// Total block capacity currently held by the arena
+    size_t get_bytes_reserved() const;
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks_;
+    size_t block_size_;
+    size_t block_index_;  // Active block (== blocks_.size() when empty)
+    size_t offset_;       // Next free byte in the active block
+    size_t bytes_used_;
+};
+
+/**
+ * @brief Standard allocator adapter over an Arena
+ *
+ * Lets std containers draw their storage from a message-scoped arena.
+ * deallocate() is a no-op — memory is reclaimed by Arena::reset().
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena_) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {
+        // Reclaimed wholesale by Arena::reset()
+    }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ == other.arena_;
+    }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena_ != other.arena_;
+    }
+
+private:
+    template<typename U>
+    friend class ArenaAllocator;
+
+    Arena* arena_;
+};
+
+/// String type whose storage lives in an Arena
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+/// Vector type whose storage lives in an Arena
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace serialization
+} // namespace someip
+
+#endif // SOMEIP_SERIALIZATION_ARENA_H
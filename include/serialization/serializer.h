@@ -16,14 +16,86 @@
 
 #include <vector>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <cstring>
 #include <string>
 #include <memory>
 #include <optional>
+#include <type_traits>
 #include "../common/result.h"
+#include "arena.h"
 
 namespace someip {
 namespace serialization {
 
+namespace detail {
+
+/// Maps a lane width in bytes to the matching unsigned integer type
+template<size_t LaneSize> struct UnsignedLane;
+template<> struct UnsignedLane<2> { using type = uint16_t; };
+template<> struct UnsignedLane<4> { using type = uint32_t; };
+template<> struct UnsignedLane<8> { using type = uint64_t; };
+
+#if defined(__GNUC__) || defined(__clang__)
+inline uint16_t byteswap(uint16_t value) { return __builtin_bswap16(value); }
+inline uint32_t byteswap(uint32_t value) { return __builtin_bswap32(value); }
+inline uint64_t byteswap(uint64_t value) { return __builtin_bswap64(value); }
+#else
+inline uint16_t byteswap(uint16_t value) {
+    return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+inline uint32_t byteswap(uint32_t value) {
+    return ((value & 0xFF000000u) >> 24) | ((value & 0x00FF0000u) >> 8) |
+           ((value & 0x0000FF00u) << 8) | ((value & 0x000000FFu) << 24);
+}
+inline uint64_t byteswap(uint64_t value) {
+    return ((value & 0xFF00000000000000ULL) >> 56) |
+           ((value & 0x00FF000000000000ULL) >> 40) |
+           ((value & 0x0000FF0000000000ULL) >> 24) |
+           ((value & 0x000000FF00000000ULL) >> 8) |
+           ((value & 0x00000000FF000000ULL) << 8) |
+           ((value & 0x0000000000FF0000ULL) << 24) |
+           ((value & 0x000000000000FF00ULL) << 40) |
+           ((value & 0x00000000000000FFULL) << 56);
+}
+#endif
+
+/**
+ * @brief In-place byte reversal of each LaneSize-byte lane in a buffer
+ *
+ * Converts a packed primitive array between host and big-endian
+ * (network) order in one pass. The fixed-width load/swap/store loop is
+ * shaped so optimizing compilers vectorize it into SIMD byte shuffles
+ * (SSSE3 pshufb, NEON rev) without platform-specific intrinsics here.
+ * No-op on big-endian hosts and for single-byte lanes.
+ */
+template<size_t LaneSize>
+inline void bulk_byteswap(uint8_t* data, size_t lane_count) {
+    static_assert(LaneSize == 1 || LaneSize == 2 || LaneSize == 4 || LaneSize == 8,
+                  "Unsupported lane size for bulk byteswap");
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    (void)data;
+    (void)lane_count;  // Already in network order
+#else
+    if constexpr (LaneSize == 1) {
+        (void)data;
+        (void)lane_count;
+    } else {
+        using lane_t = typename UnsignedLane<LaneSize>::type;
+        for (size_t i = 0; i < lane_count; ++i) {
+            lane_t value;
+            std::memcpy(&value, data + i * LaneSize, LaneSize);
+            value = byteswap(value);
+            std::memcpy(data + i * LaneSize, &value, LaneSize);
+        }
+    }
+#endif
+}
+
+} // namespace detail
+
 /**
  * @brief Result of a deserialization operation
  *
@@ -106,16 +178,42 @@ public:
      */
     Serializer();
 
+    /**
+     * @brief Constructor with caller-provided output buffer
+     *
+     * The serializer appends to the given buffer instead of its internal
+     * one, so callers can reuse a single pre-reserved buffer across many
+     * messages and avoid per-message allocation. The buffer must outlive
+     * the serializer; existing contents are preserved and appended to.
+     *
+     * @param external_buffer Buffer to serialize into (not owned)
+     */
+    explicit Serializer(std::vector<uint8_t>& external_buffer);
+
     /**
      * @brief Destructor
      */
     ~Serializer() = default;
 
+    // Non-copyable (may reference an external buffer)
+    Serializer(const Serializer&) = delete;
+    Serializer& operator=(const Serializer&) = delete;
+
     /**
      * @brief Reset the serializer (clear buffer)
      */
     void reset();
 
+    /**
+     * @brief Pre-reserve buffer capacity
+     *
+     * Use together with SerializedSizeCounter to reserve exactly once
+     * before serializing a large structure.
+     *
+     * @param capacity Number of bytes to reserve
+     */
+    void reserve(size_t capacity);
+
     // Basic type serialization
     void serialize_bool(bool value);
     void serialize_uint8(uint8_t value);
@@ -135,16 +233,17 @@ public:
     void serialize_array(const std::vector<T>& array);
 
     // Get serialized data
-    const std::vector<uint8_t>& get_buffer() const { return buffer_; }
-    std::vector<uint8_t>&& move_buffer() { return std::move(buffer_); }
-    size_t get_size() const { return buffer_.size(); }
+    const std::vector<uint8_t>& get_buffer() const { return *buffer_; }
+    std::vector<uint8_t>&& move_buffer() { return std::move(*buffer_); }
+    size_t get_size() const { return buffer_->size(); }
 
     // Utility methods
     void align_to(size_t alignment);
     void add_padding(size_t bytes);
 
 private:
-    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> owned_buffer_;
+    std::vector<uint8_t>* buffer_;  // Points at owned_buffer_ or the external buffer
 
     // Helper methods for endianness conversion
     void append_be_uint16(uint16_t value);
@@ -157,6 +256,142 @@ private:
     void append_be_double(double value);
 };
 
+/**
+ * @brief Computes the exact serialized size of a value sequence
+ *
+ * This class mirrors the Serializer interface but only counts bytes
+ * instead of writing them. Run the same serialize_* calls against a
+ * counter first, then reserve the resulting size on the Serializer so
+ * a large structure is serialized with a single allocation.
+ */
+class SerializedSizeCounter {
+public:
+    void reset() { size_ = 0; }
+
+    // Basic type size accounting (mirrors Serializer)
+    void serialize_bool(bool) { size_ += sizeof(uint8_t); }
+    void serialize_uint8(uint8_t) { size_ += sizeof(uint8_t); }
+    void serialize_uint16(uint16_t) { size_ += sizeof(uint16_t); }
+    void serialize_uint32(uint32_t) { size_ += sizeof(uint32_t); }
+    void serialize_uint64(uint64_t) { size_ += sizeof(uint64_t); }
+    void serialize_int8(int8_t) { size_ += sizeof(int8_t); }
+    void serialize_int16(int16_t) { size_ += sizeof(int16_t); }
+    void serialize_int32(int32_t) { size_ += sizeof(int32_t); }
+    void serialize_int64(int64_t) { size_ += sizeof(int64_t); }
+    void serialize_float(float) { size_ += sizeof(uint32_t); }
+    void serialize_double(double) { size_ += sizeof(uint64_t); }
+
+    void serialize_string(const std::string& value) {
+        size_ += sizeof(uint32_t) + value.length();
+        align_to(4);
+    }
+
+    // Array size accounting
+    template<typename T>
+    void serialize_array(const std::vector<T>& array);
+
+    size_t get_size() const { return size_; }
+
+    // Utility methods (mirror Serializer)
+    void align_to(size_t alignment) {
+        size_ += (alignment - (size_ % alignment)) % alignment;
+    }
+    void add_padding(size_t bytes) { size_ += bytes; }
+
+private:
+    size_t size_ = 0;
+};
+
+/**
+ * @brief Intern table for repeated deserialized strings
+ *
+ * Telemetry payloads carry the same few hundred signal names millions
+ * of times; interning returns a pointer to one stored copy per
+ * distinct string, keyed by a hash of the wire bytes so lookup never
+ * constructs a throwaway std::string. Hand one table to
+ * Deserializer::set_intern_table and deserialize_string_interned
+ * returns const std::string* into the table — a hit is a hash probe
+ * and nothing else, no allocation.
+ */
+class StringInternTable {
+public:
+    /**
+     * @brief Intern the bytes, returning the stored copy
+     *
+     * The pointer stays valid for the table's lifetime; a hit costs a
+     * hash probe and nothing else — no allocation, no refcounting.
+     */
+    const std::string* intern(const uint8_t* data, size_t length) {
+        if (count_ * 2 >= slots_.size()) {
+            grow();
+        }
+
+        size_t hash = hash_bytes(data, length);
+        size_t mask = slots_.size() - 1;
+        size_t index = hash & mask;
+
+        // Open addressing: the probe stays in one flat array, so a hit
+        // is typically a single cache line
+        while (slots_[index].value) {
+            if (slots_[index].hash == hash && slots_[index].value->size() == length &&
+                std::memcmp(slots_[index].value->data(), data, length) == 0) {
+                ++hits_;
+                return slots_[index].value.get();
+            }
+            index = (index + 1) & mask;
+        }
+
+        slots_[index].hash = hash;
+        slots_[index].value = std::make_unique<const std::string>(
+            reinterpret_cast<const char*>(data), length);
+        ++count_;
+        ++misses_;
+        return slots_[index].value.get();
+    }
+
+    size_t size() const { return count_; }
+    uint64_t hit_count() const { return hits_; }
+    uint64_t miss_count() const { return misses_; }
+
+private:
+    static size_t hash_bytes(const uint8_t* data, size_t length) {
+        // FNV-1a over the wire bytes: no temporary string needed
+        size_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < length; ++i) {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    struct Slot {
+        size_t hash{0};
+        std::unique_ptr<const std::string> value;
+    };
+
+    void grow() {
+        size_t next_size = slots_.empty() ? 512 : slots_.size() * 2;
+        std::vector<Slot> next(next_size);
+        size_t mask = next_size - 1;
+        for (auto& slot : slots_) {
+            if (!slot.value) {
+                continue;
+            }
+            size_t index = slot.hash & mask;
+            while (next[index].value) {
+                index = (index + 1) & mask;
+            }
+            next[index] = std::move(slot);
+        }
+        slots_ = std::move(next);
+    }
+
+    std::vector<Slot> slots_{std::vector<Slot>(512)};
+    size_t count_{0};
+    uint64_t hits_{0};
+    uint64_t misses_{0};
+};
+
 /**
  * @brief SOME/IP data deserializer
  *
@@ -167,7 +402,7 @@ class Deserializer {
 public:
     /**
      * @brief Constructor
-     * @param data The data to deserialize from
+     * @param data The data to deserialize from (copied for lifetime extension)
      */
     explicit Deserializer(const std::vector<uint8_t>& data);
 
@@ -177,6 +412,25 @@ public:
      */
     explicit Deserializer(std::vector<uint8_t>&& data);
 
+    /**
+     * @brief Non-owning view constructor
+     *
+     * Parses in place over the caller's buffer without copying — the
+     * receive-path variant for parsing directly out of a transport
+     * buffer. The caller must keep the buffer alive and unchanged for
+     * the lifetime of the Deserializer.
+     *
+     * @param data Pointer to the data to deserialize from (not owned)
+     * @param size Number of bytes available at data
+     */
+    Deserializer(const uint8_t* data, size_t size);
+
+    // Copy/move rebase the read pointer when the source owns its data
+    Deserializer(const Deserializer& other);
+    Deserializer& operator=(const Deserializer& other);
+    Deserializer(Deserializer&& other) noexcept;
+    Deserializer& operator=(Deserializer&& other) noexcept;
+
     /**
      * @brief Destructor
      */
@@ -205,10 +459,33 @@ public:
     template<typename T>
     DeserializationResult<std::vector<T>> deserialize_array(size_t length);
 
+    /**
+     * @brief Attach an intern table (optional; caller-owned)
+     */
+    void set_intern_table(StringInternTable* table) { intern_table_ = table; }
+
+    /**
+     * @brief Interned string deserialization
+     *
+     * Requires an attached table; a previously seen string costs a
+     * hash probe over the wire bytes and returns a pointer into the
+     * table — no allocation, no copy. The pointer is valid for the
+     * table's lifetime.
+     */
+    DeserializationResult<const std::string*> deserialize_string_interned();
+
+    // Arena-backed variants: the produced containers draw their storage
+    // from the given arena so one message decode is a single resettable
+    // allocation burst instead of many individual mallocs
+    DeserializationResult<ArenaString> deserialize_string(Arena& arena);
+
+    template<typename T>
+    DeserializationResult<ArenaVector<T>> deserialize_array(size_t length, Arena& arena);
+
     // Status and navigation
-    bool is_valid() const { return position_ <= buffer_.size(); }
+    bool is_valid() const { return position_ <= size_; }
     size_t get_position() const { return position_; }
-    size_t get_remaining() const { return buffer_.size() - position_; }
+    size_t get_remaining() const { return size_ - position_; }
     bool set_position(size_t pos);
     void skip(size_t bytes);
 
@@ -216,8 +493,11 @@ public:
     void align_to(size_t alignment);
 
 private:
-    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> owned_buffer_;  // Empty in non-owning view mode
+    const uint8_t* data_;
+    size_t size_;
     size_t position_;
+    StringInternTable* intern_table_{nullptr};
 
     // Helper methods for endianness conversion
     std::optional<uint16_t> read_be_uint16();
@@ -237,84 +517,115 @@ void Serializer::serialize_array(const std::vector<T>& array) {
     // Serialize array length as uint32_t
     serialize_uint32(static_cast<uint32_t>(array.size()));
 
-    // Serialize each element
-    for (const auto& element : array) {
-        if constexpr (std::is_same_v<T, bool>) {
-            serialize_bool(element);
-        } else if constexpr (std::is_same_v<T, uint8_t>) {
-            serialize_uint8(element);
-        } else if constexpr (std::is_same_v<T, uint16_t>) {
-            serialize_uint16(element);
-        } else if constexpr (std::is_same_v<T, uint32_t>) {
-            serialize_uint32(element);
-        } else if constexpr (std::is_same_v<T, uint64_t>) {
-            serialize_uint64(element);
-        } else if constexpr (std::is_same_v<T, int8_t>) {
-            serialize_int8(element);
-        } else if constexpr (std::is_same_v<T, int16_t>) {
-            serialize_int16(element);
-        } else if constexpr (std::is_same_v<T, int32_t>) {
-            serialize_int32(element);
-        } else if constexpr (std::is_same_v<T, int64_t>) {
-            serialize_int64(element);
-        } else if constexpr (std::is_same_v<T, float>) {
-            serialize_float(element);
-        } else if constexpr (std::is_same_v<T, double>) {
-            serialize_double(element);
-        } else if constexpr (std::is_same_v<T, std::string>) {
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        // Bulk fast path for primitive elements: one resize, one memcpy
+        // of the packed array, then a single vectorizable byteswap pass
+        // instead of a per-element append with its own bounds handling.
+        const size_t byte_count = array.size() * sizeof(T);
+        const size_t old_size = buffer_->size();
+        buffer_->resize(old_size + byte_count);
+        if (byte_count > 0) {
+            std::memcpy(buffer_->data() + old_size, array.data(), byte_count);
+            detail::bulk_byteswap<sizeof(T)>(buffer_->data() + old_size, array.size());
+        }
+    } else {
+        // Serialize each element
+        for (const auto& element : array) {
+            if constexpr (std::is_same_v<T, bool>) {
+                serialize_bool(element);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                serialize_string(element);
+            } else {
+                // For complex types, static_assert will catch this at compile time
+                static_assert(sizeof(T) == 0, "Unsupported array element type for serialization");
+            }
+        }
+    }
+}
+
+template<typename T>
+void SerializedSizeCounter::serialize_array(const std::vector<T>& array) {
+    // Array length prefix
+    size_ += sizeof(uint32_t);
+
+    if constexpr (std::is_same_v<T, std::string>) {
+        for (const auto& element : array) {
             serialize_string(element);
-        } else {
-            // For complex types, static_assert will catch this at compile time
-            static_assert(sizeof(T) == 0, "Unsupported array element type for serialization");
         }
+    } else if constexpr (std::is_same_v<T, bool>) {
+        size_ += array.size() * sizeof(uint8_t);
+    } else {
+        static_assert(std::is_arithmetic_v<T>, "Unsupported array element type for serialization");
+        size_ += array.size() * sizeof(T);
     }
 }
 
 template<typename T>
 DeserializationResult<std::vector<T>> Deserializer::deserialize_array(size_t length) {
-    std::vector<T> result;
-    result.reserve(length);
-
-    for (size_t i = 0; i < length; ++i) {
-        DeserializationResult<T> element_result;
-
-        if constexpr (std::is_same_v<T, bool>) {
-            element_result = deserialize_bool();
-        } else if constexpr (std::is_same_v<T, uint8_t>) {
-            element_result = deserialize_uint8();
-        } else if constexpr (std::is_same_v<T, uint16_t>) {
-            element_result = deserialize_uint16();
-        } else if constexpr (std::is_same_v<T, uint32_t>) {
-            element_result = deserialize_uint32();
-        } else if constexpr (std::is_same_v<T, uint64_t>) {
-            element_result = deserialize_uint64();
-        } else if constexpr (std::is_same_v<T, int8_t>) {
-            element_result = deserialize_int8();
-        } else if constexpr (std::is_same_v<T, int16_t>) {
-            element_result = deserialize_int16();
-        } else if constexpr (std::is_same_v<T, int32_t>) {
-            element_result = deserialize_int32();
-        } else if constexpr (std::is_same_v<T, int64_t>) {
-            element_result = deserialize_int64();
-        } else if constexpr (std::is_same_v<T, float>) {
-            element_result = deserialize_float();
-        } else if constexpr (std::is_same_v<T, double>) {
-            element_result = deserialize_double();
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            element_result = deserialize_string();
-        } else {
-            // For complex types, static_assert will catch this at compile time
-            static_assert(sizeof(T) == 0, "Unsupported array element type for deserialization");
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+        // Bulk fast path for primitive elements: a single bounds check
+        // for the whole array, one memcpy and one vectorizable byteswap
+        // pass instead of a DeserializationResult per element.
+        const size_t remaining = size_ - position_;
+        if (length > remaining / sizeof(T)) {
+            return DeserializationResult<std::vector<T>>::error(Result::MALFORMED_MESSAGE);
+        }
+
+        std::vector<T> result(length);
+        const size_t byte_count = length * sizeof(T);
+        if (byte_count > 0) {
+            std::memcpy(result.data(), data_ + position_, byte_count);
+            detail::bulk_byteswap<sizeof(T)>(reinterpret_cast<uint8_t*>(result.data()), length);
+            position_ += byte_count;
         }
 
-        if (element_result.is_error()) {
-            return DeserializationResult<std::vector<T>>::error(element_result.get_error());
+        return DeserializationResult<std::vector<T>>::success(std::move(result));
+    } else {
+        std::vector<T> result;
+        result.reserve(length);
+
+        for (size_t i = 0; i < length; ++i) {
+            DeserializationResult<T> element_result;
+
+            if constexpr (std::is_same_v<T, bool>) {
+                element_result = deserialize_bool();
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                element_result = deserialize_string();
+            } else {
+                // For complex types, static_assert will catch this at compile time
+                static_assert(sizeof(T) == 0, "Unsupported array element type for deserialization");
+            }
+
+            if (element_result.is_error()) {
+                return DeserializationResult<std::vector<T>>::error(element_result.get_error());
+            }
+
+            result.push_back(element_result.move_value());
         }
 
-        result.push_back(element_result.move_value());
+        return DeserializationResult<std::vector<T>>::success(std::move(result));
+    }
+}
+
+template<typename T>
+DeserializationResult<ArenaVector<T>> Deserializer::deserialize_array(size_t length, Arena& arena) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>,
+                  "Arena-backed array deserialization supports primitive element types");
+
+    const size_t remaining = size_ - position_;
+    if (length > remaining / sizeof(T)) {
+        return DeserializationResult<ArenaVector<T>>::error(Result::MALFORMED_MESSAGE);
+    }
+
+    ArenaVector<T> result(length, T{}, ArenaAllocator<T>(arena));
+    const size_t byte_count = length * sizeof(T);
+    if (byte_count > 0) {
+        std::memcpy(result.data(), data_ + position_, byte_count);
+        detail::bulk_byteswap<sizeof(T)>(reinterpret_cast<uint8_t*>(result.data()), length);
+        position_ += byte_count;
     }
 
-    return DeserializationResult<std::vector<T>>::success(std::move(result));
+    return DeserializationResult<ArenaVector<T>>::success(std::move(result));
 }
 
 } // namespace serialization
@@ -0,0 +1,208 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SERIALIZATION_STREAMING_DESERIALIZER_H
+#define SOMEIP_SERIALIZATION_STREAMING_DESERIALIZER_H
+
+#include "serializer.h"
+#include <cstring>
+
+namespace someip {
+namespace serialization {
+
+/**
+ * @brief Incremental deserializer for partially-received streams
+ *
+ * Accepts byte chunks as they arrive from a socket and lets callers
+ * decode fields before the full frame has been buffered. Each
+ * deserialize_* call is transactional: when the buffered bytes do not
+ * cover the whole field it returns Result::INSUFFICIENT_DATA without
+ * consuming anything, and the same call can be retried after the next
+ * feed(). Consumed bytes are trimmed lazily so long-running connections
+ * do not grow the buffer without bound.
+ */
+class StreamingDeserializer {
+public:
+    StreamingDeserializer() : position_(0) {}
+
+    /**
+     * @brief Append a received chunk to the pending data
+     */
+    void feed(const uint8_t* data, size_t size) {
+        compact();
+        buffer_.insert(buffer_.end(), data, data + size);
+    }
+
+    void feed(const std::vector<uint8_t>& chunk) {
+        feed(chunk.data(), chunk.size());
+    }
+
+    // Basic type deserialization; suspends with INSUFFICIENT_DATA when
+    // the field runs past the buffered bytes
+    DeserializationResult<bool> deserialize_bool() {
+        return run_field([](Deserializer& d) { return d.deserialize_bool(); });
+    }
+    DeserializationResult<uint8_t> deserialize_uint8() {
+        return run_field([](Deserializer& d) { return d.deserialize_uint8(); });
+    }
+    DeserializationResult<uint16_t> deserialize_uint16() {
+        return run_field([](Deserializer& d) { return d.deserialize_uint16(); });
+    }
+    DeserializationResult<uint32_t> deserialize_uint32() {
+        return run_field([](Deserializer& d) { return d.deserialize_uint32(); });
+    }
+    DeserializationResult<uint64_t> deserialize_uint64() {
+        return run_field([](Deserializer& d) { return d.deserialize_uint64(); });
+    }
+    DeserializationResult<int8_t> deserialize_int8() {
+        return run_field([](Deserializer& d) { return d.deserialize_int8(); });
+    }
+    DeserializationResult<int16_t> deserialize_int16() {
+        return run_field([](Deserializer& d) { return d.deserialize_int16(); });
+    }
+    DeserializationResult<int32_t> deserialize_int32() {
+        return run_field([](Deserializer& d) { return d.deserialize_int32(); });
+    }
+    DeserializationResult<int64_t> deserialize_int64() {
+        return run_field([](Deserializer& d) { return d.deserialize_int64(); });
+    }
+    DeserializationResult<float> deserialize_float() {
+        return run_field([](Deserializer& d) { return d.deserialize_float(); });
+    }
+    DeserializationResult<double> deserialize_double() {
+        return run_field([](Deserializer& d) { return d.deserialize_double(); });
+    }
+
+    /**
+     * @brief Deserialize a string; the length prefix is re-read on retry
+     *
+     * The whole field including its trailing alignment padding must be
+     * buffered before anything is consumed, so a retry never starts
+     * mid-padding.
+     */
+    DeserializationResult<std::string> deserialize_string() {
+        Deserializer peek(buffer_.data() + position_, get_buffered());
+        auto length_result = peek.deserialize_uint32();
+        if (length_result.is_error()) {
+            return DeserializationResult<std::string>::error(Result::INSUFFICIENT_DATA);
+        }
+
+        // Serializer pads strings relative to the STREAM origin, so the
+        // trailing padding must be computed on absolute offsets — a
+        // per-field view would misjudge it whenever the field itself
+        // starts unaligned (e.g. after a bool)
+        const size_t absolute_start = consumed_ + position_;
+        const size_t absolute_field_end =
+            absolute_start + sizeof(uint32_t) + length_result.get_value();
+        const size_t absolute_padded_end =
+            (absolute_field_end + 3) & ~static_cast<size_t>(3);
+        const size_t needed = absolute_padded_end - absolute_start;
+        if (get_buffered() < needed) {
+            return DeserializationResult<std::string>::error(Result::INSUFFICIENT_DATA);
+        }
+
+        std::string value(
+            reinterpret_cast<const char*>(buffer_.data() + position_ + sizeof(uint32_t)),
+            length_result.get_value());
+        position_ += needed;
+        return DeserializationResult<std::string>::success(std::move(value));
+    }
+
+    template<typename T>
+    DeserializationResult<std::vector<T>> deserialize_array(size_t length) {
+        Deserializer view(buffer_.data() + position_, get_buffered());
+        auto result = view.template deserialize_array<T>(length);
+        if (result.is_error()) {
+            return DeserializationResult<std::vector<T>>::error(Result::INSUFFICIENT_DATA);
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            // String elements always end 4-aligned; an unaligned end at
+            // the buffer boundary means trailing padding is still in
+            // flight, so suspend instead of committing a partial skip
+            if (view.get_remaining() == 0 && view.get_position() % 4 != 0) {
+                return DeserializationResult<std::vector<T>>::error(Result::INSUFFICIENT_DATA);
+            }
+        }
+        position_ += view.get_position();
+        return result;
+    }
+
+    /**
+     * @brief Skip bytes (e.g. an uninteresting field); transactional too
+     */
+    Result skip(size_t bytes) {
+        if (get_buffered() < bytes) {
+            return Result::INSUFFICIENT_DATA;
+        }
+        position_ += bytes;
+        return Result::SUCCESS;
+    }
+
+    /// Number of not-yet-consumed bytes currently buffered
+    size_t get_buffered() const { return buffer_.size() - position_; }
+
+    /// Total bytes consumed since construction or the last reset
+    size_t get_consumed() const { return consumed_ + position_; }
+
+    /**
+     * @brief Drop all pending data and bookkeeping (e.g. on reconnect)
+     */
+    void reset() {
+        buffer_.clear();
+        position_ = 0;
+        consumed_ = 0;
+    }
+
+private:
+    // Run one field decode as a transaction over the unconsumed bytes.
+    // Bounds failures become INSUFFICIENT_DATA and consume nothing, so
+    // a retry after the next chunk re-reads the field from its start.
+    template<typename F>
+    auto run_field(F&& op) -> decltype(op(std::declval<Deserializer&>())) {
+        Deserializer view(buffer_.data() + position_, buffer_.size() - position_);
+        auto result = op(view);
+        if (result.is_error()) {
+            return std::remove_reference_t<decltype(result)>::error(Result::INSUFFICIENT_DATA);
+        }
+        position_ += view.get_position();
+        return result;
+    }
+
+    // Trim the consumed prefix once it dominates the buffer, amortizing
+    // the move so feed() stays O(chunk) on average
+    void compact() {
+        if (position_ > kCompactThreshold && position_ > buffer_.size() / 2) {
+            // memmove + resize instead of vector::erase: same effect,
+            // but dodges a GCC 12 -Warray-bounds false positive that
+            // the erase form triggers when inlined at -O2
+            size_t live = buffer_.size() - position_;
+            if (live > 0) {
+                std::memmove(buffer_.data(), buffer_.data() + position_, live);
+            }
+            buffer_.resize(live);
+            consumed_ += position_;
+            position_ = 0;
+        }
+    }
+
+    static constexpr size_t kCompactThreshold = 4096;
+
+    std::vector<uint8_t> buffer_;
+    size_t position_;
+    size_t consumed_ = 0;
+};
+
+} // namespace serialization
+} // namespace someip
+
+#endif // SOMEIP_SERIALIZATION_STREAMING_DESERIALIZER_H
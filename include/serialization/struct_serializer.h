@@ -0,0 +1,301 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_SERIALIZATION_STRUCT_SERIALIZER_H
+#define SOMEIP_SERIALIZATION_STRUCT_SERIALIZER_H
+
+#include <tuple>
+#include <utility>
+#include "serializer.h"
+
+namespace someip {
+namespace serialization {
+
+/**
+ * @brief Compile-time field description of a user-defined struct
+ *
+ * Specialize this template for each struct that should be serializable
+ * through serialize_struct/deserialize_struct, listing the members in
+ * wire order:
+ *
+ * @code
+ * struct SensorReading {
+ *     uint32_t timestamp;
+ *     float temperature;
+ *     std::string unit;
+ * };
+ *
+ * template<>
+ * struct someip::serialization::StructDescriptor<SensorReading> {
+ *     static constexpr auto fields() {
+ *         return std::make_tuple(&SensorReading::timestamp,
+ *                                &SensorReading::temperature,
+ *                                &SensorReading::unit);
+ *     }
+ * };
+ * @endcode
+ *
+ * Supported field types are the arithmetic types handled by Serializer,
+ * std::string, std::vector of those, and nested structs that have their
+ * own StructDescriptor specialization.
+ */
+template<typename T>
+struct StructDescriptor;
+
+namespace detail {
+
+/// Extracts the member type M from a pointer-to-member M C::*
+template<typename T>
+struct MemberObjectType;
+template<typename C, typename M>
+struct MemberObjectType<M C::*> {
+    using type = M;
+};
+
+/// Detects whether a StructDescriptor specialization exists for T
+template<typename T, typename = void>
+struct HasStructDescriptor : std::false_type {};
+template<typename T>
+struct HasStructDescriptor<T, std::void_t<decltype(StructDescriptor<T>::fields())>>
+    : std::true_type {};
+
+template<typename T>
+struct IsVector : std::false_type {};
+template<typename U>
+struct IsVector<std::vector<U>> : std::true_type {};
+
+template<typename Field>
+constexpr bool field_has_fixed_wire_size();
+template<typename Field>
+constexpr size_t field_fixed_wire_size();
+
+/// True when every field of the described struct has a fixed wire size
+template<typename T>
+constexpr bool struct_has_fixed_wire_size() {
+    return std::apply(
+        [](auto... members) {
+            return (field_has_fixed_wire_size<
+                        typename MemberObjectType<decltype(members)>::type>() &&
+                    ... && true);
+        },
+        StructDescriptor<T>::fields());
+}
+
+/// Total wire size of the described struct (only valid when fixed)
+template<typename T>
+constexpr size_t struct_fixed_wire_size() {
+    return std::apply(
+        [](auto... members) {
+            return (field_fixed_wire_size<
+                        typename MemberObjectType<decltype(members)>::type>() +
+                    ... + 0);
+        },
+        StructDescriptor<T>::fields());
+}
+
+template<typename Field>
+constexpr bool field_has_fixed_wire_size() {
+    if constexpr (std::is_arithmetic_v<Field>) {
+        return true;
+    } else if constexpr (HasStructDescriptor<Field>::value) {
+        return struct_has_fixed_wire_size<Field>();
+    } else {
+        return false;  // Strings and vectors are length-dependent
+    }
+}
+
+template<typename Field>
+constexpr size_t field_fixed_wire_size() {
+    if constexpr (std::is_arithmetic_v<Field>) {
+        return sizeof(Field);
+    } else if constexpr (HasStructDescriptor<Field>::value) {
+        return struct_fixed_wire_size<Field>();
+    } else {
+        return 0;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief True when T's serialized size is a compile-time constant
+ */
+template<typename T>
+constexpr bool has_fixed_wire_size_v = detail::struct_has_fixed_wire_size<T>();
+
+/**
+ * @brief Compile-time serialized size of T (only when has_fixed_wire_size_v<T>)
+ */
+template<typename T>
+constexpr size_t fixed_wire_size_v = detail::struct_fixed_wire_size<T>();
+
+template<typename T>
+void serialize_struct(Serializer& serializer, const T& value);
+template<typename T>
+DeserializationResult<T> deserialize_struct(Deserializer& deserializer);
+
+namespace detail {
+
+template<typename Field>
+void serialize_field(Serializer& serializer, const Field& field) {
+    if constexpr (std::is_same_v<Field, bool>) {
+        serializer.serialize_bool(field);
+    } else if constexpr (std::is_same_v<Field, uint8_t>) {
+        serializer.serialize_uint8(field);
+    } else if constexpr (std::is_same_v<Field, uint16_t>) {
+        serializer.serialize_uint16(field);
+    } else if constexpr (std::is_same_v<Field, uint32_t>) {
+        serializer.serialize_uint32(field);
+    } else if constexpr (std::is_same_v<Field, uint64_t>) {
+        serializer.serialize_uint64(field);
+    } else if constexpr (std::is_same_v<Field, int8_t>) {
+        serializer.serialize_int8(field);
+    } else if constexpr (std::is_same_v<Field, int16_t>) {
+        serializer.serialize_int16(field);
+    } else if constexpr (std::is_same_v<Field, int32_t>) {
+        serializer.serialize_int32(field);
+    } else if constexpr (std::is_same_v<Field, int64_t>) {
+        serializer.serialize_int64(field);
+    } else if constexpr (std::is_same_v<Field, float>) {
+        serializer.serialize_float(field);
+    } else if constexpr (std::is_same_v<Field, double>) {
+        serializer.serialize_double(field);
+    } else if constexpr (std::is_same_v<Field, std::string>) {
+        serializer.serialize_string(field);
+    } else if constexpr (IsVector<Field>::value) {
+        serializer.serialize_array(field);
+    } else if constexpr (HasStructDescriptor<Field>::value) {
+        serialize_struct(serializer, field);
+    } else {
+        static_assert(sizeof(Field) == 0, "Unsupported field type for struct serialization");
+    }
+}
+
+template<typename Field>
+DeserializationResult<Field> deserialize_field(Deserializer& deserializer) {
+    if constexpr (std::is_same_v<Field, bool>) {
+        return deserializer.deserialize_bool();
+    } else if constexpr (std::is_same_v<Field, uint8_t>) {
+        return deserializer.deserialize_uint8();
+    } else if constexpr (std::is_same_v<Field, uint16_t>) {
+        return deserializer.deserialize_uint16();
+    } else if constexpr (std::is_same_v<Field, uint32_t>) {
+        return deserializer.deserialize_uint32();
+    } else if constexpr (std::is_same_v<Field, uint64_t>) {
+        return deserializer.deserialize_uint64();
+    } else if constexpr (std::is_same_v<Field, int8_t>) {
+        return deserializer.deserialize_int8();
+    } else if constexpr (std::is_same_v<Field, int16_t>) {
+        return deserializer.deserialize_int16();
+    } else if constexpr (std::is_same_v<Field, int32_t>) {
+        return deserializer.deserialize_int32();
+    } else if constexpr (std::is_same_v<Field, int64_t>) {
+        return deserializer.deserialize_int64();
+    } else if constexpr (std::is_same_v<Field, float>) {
+        return deserializer.deserialize_float();
+    } else if constexpr (std::is_same_v<Field, double>) {
+        return deserializer.deserialize_double();
+    } else if constexpr (std::is_same_v<Field, std::string>) {
+        return deserializer.deserialize_string();
+    } else if constexpr (IsVector<Field>::value) {
+        auto length_result = deserializer.deserialize_uint32();
+        if (length_result.is_error()) {
+            return DeserializationResult<Field>::error(length_result.get_error());
+        }
+        auto array_result = deserializer.deserialize_array<typename Field::value_type>(
+            length_result.get_value());
+        if (array_result.is_error()) {
+            return DeserializationResult<Field>::error(array_result.get_error());
+        }
+        return DeserializationResult<Field>::success(array_result.move_value());
+    } else if constexpr (HasStructDescriptor<Field>::value) {
+        return deserialize_struct<Field>(deserializer);
+    } else {
+        static_assert(sizeof(Field) == 0, "Unsupported field type for struct deserialization");
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Serialize a described struct field by field in wire order
+ *
+ * When every field has a fixed wire size the total is a compile-time
+ * constant and the output buffer is grown exactly once up front, so the
+ * per-field writes run without reallocation and the compiler can fuse
+ * adjacent fixed-size appends.
+ */
+template<typename T>
+void serialize_struct(Serializer& serializer, const T& value) {
+    static_assert(detail::HasStructDescriptor<T>::value,
+                  "No StructDescriptor specialization for this type");
+
+    if constexpr (has_fixed_wire_size_v<T>) {
+        serializer.reserve(serializer.get_size() + fixed_wire_size_v<T>);
+    }
+
+    std::apply(
+        [&](auto... members) {
+            (detail::serialize_field(serializer, value.*members), ...);
+        },
+        StructDescriptor<T>::fields());
+}
+
+/**
+ * @brief Deserialize a described struct field by field in wire order
+ *
+ * For fixed-size structs a single up-front bounds check covers the whole
+ * struct, so truncated input is rejected before any field is decoded.
+ */
+template<typename T>
+DeserializationResult<T> deserialize_struct(Deserializer& deserializer) {
+    static_assert(detail::HasStructDescriptor<T>::value,
+                  "No StructDescriptor specialization for this type");
+
+    if constexpr (has_fixed_wire_size_v<T>) {
+        if (deserializer.get_remaining() < fixed_wire_size_v<T>) {
+            return DeserializationResult<T>::error(Result::MALFORMED_MESSAGE);
+        }
+    }
+
+    T value{};
+    Result error = Result::SUCCESS;
+
+    std::apply(
+        [&](auto... members) {
+            ([&] {
+                if (error != Result::SUCCESS) {
+                    return;
+                }
+                using Field = typename detail::MemberObjectType<decltype(members)>::type;
+                auto field_result = detail::deserialize_field<Field>(deserializer);
+                if (field_result.is_error()) {
+                    error = field_result.get_error();
+                    return;
+                }
+                value.*members = field_result.move_value();
+            }(),
+             ...);
+        },
+        StructDescriptor<T>::fields());
+
+    if (error != Result::SUCCESS) {
+        return DeserializationResult<T>::error(error);
+    }
+    return DeserializationResult<T>::success(std::move(value));
+}
+
+} // namespace serialization
+} // namespace someip
+
+#endif // SOMEIP_SERIALIZATION_STRUCT_SERIALIZER_H
@@ -16,11 +16,101 @@
 
 #include "someip/types.h"
 #include <vector>
+#include <cstring>
 #include <memory>
 #include <chrono>
 
 namespace someip {
 
+/**
+ * @brief Small-buffer-optimized payload storage
+ *
+ * Most SOME/IP traffic is tiny (heartbeats, few-byte sensor values),
+ * so payloads up to INLINE_CAPACITY bytes live directly inside the
+ * Message with no heap allocation; larger payloads spill to a heap
+ * vector whose capacity is kept across clear() for reuse by pooled
+ * messages. The interface mirrors the subset of std::vector that the
+ * stack uses, and an implicit conversion to std::vector<uint8_t> keeps
+ * existing callers working.
+ */
+class PayloadBuffer {
+public:
+    static constexpr size_t INLINE_CAPACITY = 64;
+
+    PayloadBuffer() : size_(0), inline_(true) {}
+
+    // Implicit conversions from vector keep set_payload call sites working
+    PayloadBuffer(const std::vector<uint8_t>& data) : size_(0), inline_(true) {
+        assign(data.data(), data.size());
+    }
+    PayloadBuffer(std::vector<uint8_t>&& data) : size_(0), inline_(true) {
+        if (data.size() <= INLINE_CAPACITY) {
+            assign(data.data(), data.size());
+        } else {
+            heap_ = std::move(data);
+            inline_ = false;
+        }
+    }
+
+    void assign(const uint8_t* data, size_t size) {
+        if (size <= INLINE_CAPACITY) {
+            if (size > 0) {
+                std::memcpy(inline_storage_, data, size);
+            }
+            size_ = size;
+            inline_ = true;
+            heap_.clear();  // Keep spill capacity for later large payloads
+        } else {
+            heap_.assign(data, data + size);
+            inline_ = false;
+            size_ = 0;
+        }
+    }
+
+    const uint8_t* data() const { return inline_ ? inline_storage_ : heap_.data(); }
+    uint8_t* data() { return inline_ ? inline_storage_ : heap_.data(); }
+    size_t size() const { return inline_ ? size_ : heap_.size(); }
+    bool empty() const { return size() == 0; }
+    size_t capacity() const { return inline_ ? INLINE_CAPACITY : heap_.capacity(); }
+
+    const uint8_t* begin() const { return data(); }
+    const uint8_t* end() const { return data() + size(); }
+
+    uint8_t operator[](size_t index) const { return data()[index]; }
+
+    void clear() {
+        size_ = 0;
+        inline_ = true;
+        heap_.clear();  // Capacity retained for reuse
+    }
+
+    /// Materialize an owning vector (copies; for legacy callers)
+    operator std::vector<uint8_t>() const {
+        return std::vector<uint8_t>(begin(), end());
+    }
+
+private:
+    uint8_t inline_storage_[INLINE_CAPACITY] = {};  // Value-initialized: the defaulted copy/move reads the full array
+    std::vector<uint8_t> heap_;  // Used when the payload exceeds INLINE_CAPACITY
+    size_t size_;                // Valid in inline mode only
+    bool inline_;
+};
+
+inline bool operator==(const PayloadBuffer& lhs, const PayloadBuffer& rhs) {
+    return lhs.size() == rhs.size() &&
+           (lhs.size() == 0 || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+inline bool operator!=(const PayloadBuffer& lhs, const PayloadBuffer& rhs) {
+    return !(lhs == rhs);
+}
+inline bool operator==(const PayloadBuffer& lhs, const std::vector<uint8_t>& rhs) {
+    return lhs.size() == rhs.size() &&
+           (lhs.size() == 0 || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+inline bool operator==(const std::vector<uint8_t>& lhs, const PayloadBuffer& rhs) {
+    return rhs == lhs;
+}
+
 /**
  * @brief SOME/IP message structure
  *
@@ -89,9 +179,17 @@ public:
     void set_return_code(ReturnCode code) { return_code_ = code; }
 
     // Payload accessors
-    const std::vector<uint8_t>& get_payload() const { return payload_; }
-    void set_payload(const std::vector<uint8_t>& payload) { payload_ = payload; update_length(); }
+    const PayloadBuffer& get_payload() const { return payload_; }
+    size_t get_payload_capacity() const { return payload_.capacity(); }
+    void set_payload(const std::vector<uint8_t>& payload) {
+        payload_.assign(payload.data(), payload.size());
+        update_length();
+    }
     void set_payload(std::vector<uint8_t>&& payload) { payload_ = std::move(payload); update_length(); }
+    void set_payload(const uint8_t* data, size_t size) {
+        payload_.assign(data, size);
+        update_length();
+    }
 
     // Service and method ID convenience accessors
     uint16_t get_service_id() const { return message_id_.service_id; }
@@ -106,8 +204,31 @@ public:
     uint16_t get_session_id() const { return request_id_.session_id; }
     void set_session_id(uint16_t session_id) { request_id_.session_id = session_id; }
 
+    // Constants
+    static constexpr size_t HEADER_SIZE = 16;
+
     // Serialization methods
     std::vector<uint8_t> serialize() const;
+
+    /**
+     * @brief Append the serialized message (header + payload) to out
+     *
+     * Lets callers serialize once into a reusable buffer and send the
+     * same bytes to many destinations or retransmissions.
+     */
+    void serialize_into(std::vector<uint8_t>& out) const;
+
+    /**
+     * @brief Serialize only the 16-byte header into a caller buffer
+     *
+     * Enables scatter-gather sends: the header goes into a small stack
+     * buffer while the payload is referenced in place, so large
+     * payloads are never copied just to prepend the header.
+     *
+     * @param buffer Destination with at least HEADER_SIZE bytes
+     */
+    void serialize_header(uint8_t* buffer) const;
+
     bool deserialize(const std::vector<uint8_t>& data);
 
     // Validation methods
@@ -127,6 +248,14 @@ public:
     std::chrono::steady_clock::time_point get_timestamp() const { return timestamp_; }
     void update_timestamp() { timestamp_ = std::chrono::steady_clock::now(); }
 
+    /**
+     * @brief Reset to a freshly-constructed state, keeping payload capacity
+     *
+     * Used by MessagePool so recycled messages reuse their payload
+     * buffer instead of reallocating it.
+     */
+    void reset_for_reuse();
+
     // String representation for debugging
     std::string to_string() const;
 
@@ -140,14 +269,13 @@ private:
     MessageType message_type_;       // 1 byte
     ReturnCode return_code_;         // 1 byte
 
-    // Payload
-    std::vector<uint8_t> payload_;
+    // Payload (small-buffer optimized)
+    PayloadBuffer payload_;
 
     // Metadata
     std::chrono::steady_clock::time_point timestamp_;
 
     // Constants
-    static constexpr size_t HEADER_SIZE = 16;
     static constexpr size_t MIN_MESSAGE_SIZE = HEADER_SIZE;
     static constexpr size_t DEFAULT_MAX_PAYLOAD_SIZE = 1400; // Ethernet MTU minus headers
     static constexpr size_t MAX_TCP_PAYLOAD_SIZE = 65535; // Much larger for TCP
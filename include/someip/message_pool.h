@@ -0,0 +1,88 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_MESSAGE_POOL_H
+#define SOMEIP_MESSAGE_POOL_H
+
+#include "someip/message.h"
+#include <mutex>
+#include <vector>
+
+namespace someip {
+
+/**
+ * @brief Thread-safe pool of reusable Message objects
+ *
+ * acquire() hands out a MessagePtr whose control block returns the
+ * Message to the pool on last release instead of freeing it. Returned
+ * messages keep their payload buffer capacity, so once the pool has
+ * warmed up to the traffic's high-water mark, steady-state receive
+ * processing performs no heap allocation per packet.
+ *
+ * The transports draw from the process-wide default pool; components
+ * with unusual message sizes can own a dedicated pool instead.
+ */
+class MessagePool : public std::enable_shared_from_this<MessagePool> {
+public:
+    static constexpr size_t kDefaultMaxPooled = 1024;
+
+    /**
+     * @brief Pool usage counters for telemetry
+     */
+    struct Statistics {
+        uint64_t acquired = 0;          ///< Total acquire() calls
+        uint64_t pool_hits = 0;         ///< Acquires served from the free list
+        uint64_t pool_misses = 0;       ///< Acquires that had to allocate
+        uint64_t released = 0;          ///< Messages returned to the pool
+        uint64_t dropped = 0;           ///< Releases freed because the pool was full
+        size_t pooled = 0;              ///< Messages currently in the free list
+        size_t payload_high_water = 0;  ///< Largest payload capacity seen
+    };
+
+    /**
+     * @brief Create a pool
+     * @param max_pooled Free-list cap; releases beyond it free the message
+     */
+    static std::shared_ptr<MessagePool> create(size_t max_pooled = kDefaultMaxPooled);
+
+    ~MessagePool();
+
+    /**
+     * @brief Process-wide pool shared by the transports
+     */
+    static const std::shared_ptr<MessagePool>& get_default();
+
+    /**
+     * @brief Get a recycled (or fresh) message, reset to default state
+     */
+    MessagePtr acquire();
+
+    /**
+     * @brief Current usage counters
+     */
+    Statistics get_statistics() const;
+
+private:
+    explicit MessagePool(size_t max_pooled);
+
+    void release(Message* message);
+
+    mutable std::mutex mutex_;
+    std::vector<Message*> free_list_;
+    size_t max_pooled_;
+    Statistics statistics_;
+};
+
+} // namespace someip
+
+#endif // SOMEIP_MESSAGE_POOL_H
@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_MESSAGE_VIEW_H
+#define SOMEIP_MESSAGE_VIEW_H
+
+#include "someip/message.h"
+
+namespace someip {
+
+/**
+ * @brief Zero-copy view of a received SOME/IP message
+ *
+ * Parses the 16-byte header in place over a transport receive buffer
+ * and exposes the payload as a pointer+length pair without copying a
+ * single payload byte. Handlers that only inspect the message work
+ * directly on the view; to_message() converts to an owning Message
+ * only when the data must outlive the receive buffer.
+ *
+ * The view does not own the underlying bytes: the buffer must stay
+ * alive and unchanged while the view (or its payload pointer) is used.
+ */
+class MessageView {
+public:
+    /**
+     * @brief Construct an invalid (empty) view
+     */
+    MessageView();
+
+    /**
+     * @brief Parse a message header in place over a receive buffer
+     *
+     * Performs the same header and length validation as
+     * Message::deserialize but leaves the payload in the caller's
+     * buffer.
+     *
+     * @param data Start of the datagram/frame (not owned)
+     * @param size Number of bytes available at data
+     * @return true when the buffer holds a complete, valid message
+     */
+    bool parse(const uint8_t* data, size_t size);
+    bool parse(const std::vector<uint8_t>& data);
+
+    /**
+     * @brief Whether the last parse() produced a valid message
+     */
+    bool is_valid() const { return valid_; }
+
+    // Header field accessors (valid only after a successful parse)
+    MessageId get_message_id() const { return message_id_; }
+    uint32_t get_length() const { return length_; }
+    RequestId get_request_id() const { return request_id_; }
+    uint8_t get_protocol_version() const { return protocol_version_; }
+    uint8_t get_interface_version() const { return interface_version_; }
+    MessageType get_message_type() const { return message_type_; }
+    ReturnCode get_return_code() const { return return_code_; }
+
+    uint16_t get_service_id() const { return message_id_.service_id; }
+    uint16_t get_method_id() const { return message_id_.method_id; }
+    uint16_t get_client_id() const { return request_id_.client_id; }
+    uint16_t get_session_id() const { return request_id_.session_id; }
+
+    // Payload view (points into the caller's buffer)
+    const uint8_t* get_payload_data() const { return payload_data_; }
+    size_t get_payload_size() const { return payload_size_; }
+
+    // Utility methods
+    bool is_request() const { return someip::is_request(message_type_); }
+    bool is_response() const { return someip::is_response(message_type_); }
+    bool uses_tp() const { return someip::uses_tp(message_type_); }
+    bool is_success() const { return someip::is_success(return_code_); }
+
+    /**
+     * @brief Materialize an owning Message from this view
+     *
+     * This is the only point where the payload is copied; call it when
+     * the handler needs to keep the message beyond the receive buffer's
+     * lifetime.
+     */
+    Message to_message() const;
+
+    /**
+     * @brief Materialize a shared owning Message from this view
+     */
+    MessagePtr to_message_ptr() const;
+
+private:
+    MessageId message_id_;
+    uint32_t length_;
+    RequestId request_id_;
+    uint8_t protocol_version_;
+    uint8_t interface_version_;
+    MessageType message_type_;
+    ReturnCode return_code_;
+
+    const uint8_t* payload_data_;
+    size_t payload_size_;
+    bool valid_;
+};
+
+} // namespace someip
+
+#endif // SOMEIP_MESSAGE_VIEW_H
@@ -17,7 +17,10 @@
 #include "tp_types.h"
 #include "../someip/message.h"
 #include <memory>
+#include <atomic>
 #include <unordered_map>
+#include "common/stats_counters.h"
+#include <string>
 #include <mutex>
 
 namespace someip {
@@ -91,6 +94,17 @@ public:
      */
     TpResult get_next_segment(uint32_t transfer_id, TpSegment& segment);
 
+    /**
+     * @brief Zero-copy variant: view of the next segment to send
+     *
+     * data points into the transfer's retained buffer and stays valid
+     * until the transfer completes or is cancelled. Pair it with the
+     * TP header (generated at send time) in a vectored send.
+     * done is set when no segments remain.
+     */
+    TpResult get_next_segment_view(uint32_t transfer_id, TpSegmentHeader& header,
+                                   const uint8_t*& data, size_t& length, bool& done);
+
     /**
      * @brief Handle received TP segment
      *
@@ -107,7 +121,77 @@ public:
      * @param segments_acknowledged List of segment offsets that were acknowledged
      * @return SUCCESS if acknowledgment processed
      */
-    TpResult acknowledge_segments(uint32_t transfer_id, const std::vector<uint16_t>& segments_acknowledged);
+    /**
+     * segments_acknowledged carries the segment_offset values the
+     * receiver has (its SACK bitmap flattened): acked segments are
+     * marked, the window base slides over the contiguous prefix, and
+     * unacked segments below the highest ack become fast-retransmit
+     * candidates served by get_retransmit_segment_view.
+     */
+    TpResult acknowledge_segments(uint32_t transfer_id, const std::vector<uint32_t>& segments_acknowledged);
+
+    /**
+     * @brief Pull the next segment needing retransmission, if any
+     *
+     * Serves SACK gaps (fast retransmit) and unacked segments older
+     * than retry_timeout; a segment exceeding max_retries fails the
+     * transfer with TIMEOUT. available=false means nothing to resend.
+     */
+    TpResult get_retransmit_segment_view(uint32_t transfer_id, TpSegmentHeader& header,
+                                         const uint8_t*& data, size_t& length,
+                                         bool& available);
+
+    /**
+     * @brief Set a transfer's scheduling priority (0 = highest)
+     */
+    TpResult set_transfer_priority(uint32_t transfer_id, uint8_t priority);
+
+    /**
+     * @brief Pull the next paced batch of segments to transmit
+     *
+     * Token-bucket pacing at pacing_rate_bytes_per_sec (0 = unpaced)
+     * with a pacing_burst_segments bucket; transfers are served
+     * strictly by priority so a firmware download cannot starve a
+     * diagnostic transfer, and each transfer's sliding window still
+     * applies. Returns up to max_items; an empty batch means nothing
+     * is currently sendable (window closed, no tokens, or done).
+     */
+    TpResult get_transmit_batch(std::vector<TpTransmitItem>& batch, size_t max_items);
+
+    /**
+     * @brief Zero-copy file transfer source
+     *
+     * Maps the file read-only (madvise sequential readahead), builds
+     * segment views directly over the mapping — the only copy is the
+     * first segment's small header+chunk buffer — and registers the
+     * transfer like any other. The mapping lives until the transfer
+     * completes or is cancelled.
+     *
+     * @param path Source file
+     * @param message_id Service/method bits for the SOME/IP header
+     * @param transfer_id Output transfer handle
+     */
+    TpResult segment_file(const std::string& path, uint32_t message_id,
+                          uint32_t& transfer_id);
+
+    /**
+     * @brief Chunk sink writing reassembled ranges straight to a file
+     *
+     * Pair with set_chunk_sink on the receiving manager: in-order
+     * ranges are pwritten at their offsets, so a 200MB OTA image never
+     * materializes in RAM.
+     */
+    static TpChunkSink make_file_chunk_sink(const std::string& path);
+
+    /**
+     * @brief Install the streaming chunk sink (see TpReassembler)
+     */
+    void set_chunk_sink(TpChunkSink sink);
+
+    /**
+     * @brief Receiver-side SACK: segment offsets received so far
+     */
+    bool get_reassembly_sack(uint8_t sequence_number, std::vector<uint32_t>& received_offsets) const;
 
     /**
      * @brief Cancel an ongoing transfer
@@ -167,19 +251,46 @@ public:
     void update_config(const TpConfig& config);
 
 private:
+    // Transfer table sharded by transfer_id: concurrent transfers from
+    // different peers contend only within their own shard
+    static constexpr size_t TRANSFER_SHARDS = 8;  // Power of two
+    struct TransferShard {
+        mutable std::mutex mutex;
+        std::unordered_map<uint32_t, TpTransfer> transfers;
+    };
+
+    TransferShard& shard_for(uint32_t transfer_id) {
+        return transfer_shards_[transfer_id & (TRANSFER_SHARDS - 1)];
+    }
+    const TransferShard& shard_for(uint32_t transfer_id) const {
+        return transfer_shards_[transfer_id & (TRANSFER_SHARDS - 1)];
+    }
+
     TpConfig config_;
     std::unique_ptr<TpSegmenter> segmenter_;
     std::unique_ptr<TpReassembler> reassembler_;
 
-    std::unordered_map<uint32_t, TpTransfer> active_transfers_;
-    mutable std::mutex transfers_mutex_;
+    TransferShard transfer_shards_[TRANSFER_SHARDS];
+    std::atomic<size_t> active_transfer_count_{0};
+
+    // Token-bucket pacing state
+    std::mutex scheduler_mutex_;
+    double pacing_tokens_{-1.0};  // Negative = not yet initialized (starts full)
+    std::chrono::steady_clock::time_point last_refill_{std::chrono::steady_clock::now()};
 
     TpCompletionCallback completion_callback_;
     TpProgressCallback progress_callback_;
     TpMessageCallback message_callback_;
 
-    uint32_t next_transfer_id_{1};
-    TpStatistics statistics_;
+    std::atomic<uint32_t> next_transfer_id_{1};
+    // Contention-free counters (the shards would otherwise race on a
+    // plain struct); TpStatistics snapshots are built on read
+    StatsCounter messages_segmented_{"tp.messages_segmented"};
+    StatsCounter messages_reassembled_{"tp.messages_reassembled"};
+    StatsCounter segments_sent_{"tp.segments_sent"};
+    StatsCounter segments_received_{"tp.segments_received"};
+    StatsCounter retransmissions_{"tp.retransmissions"};
+    StatsCounter timeouts_{"tp.timeouts"};
 
     void cleanup_completed_transfers();
     void update_statistics(const TpSegment& segment, bool sent);
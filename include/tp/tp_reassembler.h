@@ -15,6 +15,7 @@
 #define SOMEIP_TP_REASSEMBLER_H
 
 #include "tp_types.h"
+#include <map>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -81,6 +82,24 @@ public:
      */
     void cancel_reassembly(uint32_t message_id);
 
+    /**
+     * @brief Install the streaming chunk sink
+     *
+     * With a sink installed, transfers whose message_length exceeds
+     * max_message_size flow through streaming reassembly: in-order
+     * byte ranges are delivered incrementally and resident memory is
+     * bounded by reorder_window_bytes regardless of transfer size.
+     */
+    void set_chunk_sink(TpChunkSink sink);
+
+    /**
+     * @brief Segment offsets received for an in-progress reassembly
+     *
+     * The flattened SACK the receiver sends back; false when no
+     * reassembly with that sequence number is active.
+     */
+    bool get_received_offsets(uint8_t sequence_number, std::vector<uint32_t>& offsets) const;
+
     /**
      * @brief Process timeouts and cleanup stale reassembly buffers
      * Should be called periodically
@@ -107,6 +126,28 @@ private:
     mutable std::mutex config_mutex_;
     mutable std::mutex buffers_mutex_;
 
+    // Recycled received_data vectors, kept at high-water capacity so
+    // new inbound transfers stop hammering the allocator
+    static constexpr size_t MAX_POOLED_DATA_BUFFERS = 16;
+    std::vector<std::vector<uint8_t>> data_pool_;
+
+    std::vector<uint8_t> take_pooled_data();
+    void recycle_data(std::vector<uint8_t>&& data);
+
+    // Streaming (oversized) reassembly: only the reorder window is
+    // resident; in-order prefixes leave through the chunk sink
+    struct StreamingReassembly {
+        uint64_t total_length{0};
+        uint64_t delivered{0};
+        std::map<uint64_t, std::vector<uint8_t>> pending;  // Out-of-order slices
+        size_t pending_bytes{0};
+    };
+
+    bool process_streaming_segment(const TpSegment& segment);
+
+    TpChunkSink chunk_sink_;
+    std::unordered_map<uint8_t, StreamingReassembly> streaming_;
+
     TpConfig get_config_copy() const;
     bool validate_segment(const TpSegment& segment) const;
     TpReassemblyBuffer* find_or_create_buffer(const TpSegment& segment);
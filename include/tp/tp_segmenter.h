@@ -54,6 +54,15 @@ public:
      */
     TpResult segment_message(const Message& message, std::vector<TpSegment>& segments);
 
+    /**
+     * @brief Zero-copy segmentation: views over one retained buffer
+     *
+     * Serializes the message once into out.buffer and describes every
+     * segment as an (offset, length) view — no per-segment payload
+     * copies. Byte content of each view matches the owning overload.
+     */
+    TpResult segment_message(const Message& message, TpSegmentedMessage& out);
+
     /**
      * @brief Segment raw message data into TP segments
      *
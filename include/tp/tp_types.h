@@ -59,6 +59,12 @@ struct TpConfig {
     std::chrono::milliseconds reassembly_timeout{5000}; // Timeout for reassembly
     uint32_t max_concurrent_transfers{10}; // Maximum concurrent transfers
     bool enable_acknowledgments{true};     // Enable acknowledgment mechanism
+    uint32_t window_size{32};              // Segments in flight before acks gate sending
+    uint32_t pacing_rate_bytes_per_sec{0}; // Token-bucket rate; 0 = unpaced
+    uint32_t pacing_burst_segments{8};     // Bucket depth, in max-size segments
+    uint32_t reorder_window_bytes{1048576}; // Streaming-mode out-of-order budget
+    bool enable_compression{false};         // LZ4 payloads before segmentation
+    uint32_t compression_threshold{4096};   // Min payload size to compress
 };
 
 /**
@@ -66,7 +72,7 @@ struct TpConfig {
  */
 struct TpSegmentHeader {
     uint32_t message_length{0};     // Total message length
-    uint16_t segment_offset{0};     // Offset of this segment in the message
+    uint32_t segment_offset{0};     // Offset of this segment in the message
     uint16_t segment_length{0};     // Length of this segment's payload
     uint8_t sequence_number{0};     // Sequence number for ordering
     TpMessageType message_type{TpMessageType::SINGLE_MESSAGE};  // Type of TP message
@@ -86,6 +92,71 @@ struct TpSegment {
     TpSegment() = default;
 };
 
+/**
+ * @brief Non-owning segment view over a segmented message's buffer
+ */
+struct TpSegmentView {
+    TpSegmentHeader header;
+    size_t buffer_offset{0};  // Into buffer, or the external mapping
+    size_t length{0};
+    bool external{false};     // Points into the mmap'd source
+};
+
+/**
+ * @brief A segmented message: one retained copy plus segment views
+ *
+ * Segmenting a 1MB message costs exactly one serialization into
+ * buffer; every segment is an (offset, length) view into it, so the
+ * bytes are never copied per segment. Per-segment TP headers are
+ * generated at send time into a scratch buffer and paired with the
+ * view via vectored send.
+ */
+struct TpSegmentedMessage {
+    std::vector<uint8_t> buffer;
+    std::vector<TpSegmentView> views;
+
+    // File-backed transfers: views may point into an mmap'd region
+    // instead of buffer (view.external == true); the mapping is owned
+    // here and released when the transfer is destroyed
+    const uint8_t* external_data{nullptr};
+    size_t external_size{0};
+    int external_fd{-1};
+
+    TpSegmentedMessage() = default;
+    TpSegmentedMessage(const TpSegmentedMessage&) = delete;
+    TpSegmentedMessage& operator=(const TpSegmentedMessage&) = delete;
+
+    TpSegmentedMessage(TpSegmentedMessage&& other) noexcept { move_from(other); }
+    TpSegmentedMessage& operator=(TpSegmentedMessage&& other) noexcept {
+        if (this != &other) {
+            release();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    ~TpSegmentedMessage() { release(); }
+
+    const uint8_t* data(const TpSegmentView& view) const {
+        return view.external ? external_data + view.buffer_offset
+                             : buffer.data() + view.buffer_offset;
+    }
+
+private:
+    void move_from(TpSegmentedMessage& other) {
+        buffer = std::move(other.buffer);
+        views = std::move(other.views);
+        external_data = other.external_data;
+        external_size = other.external_size;
+        external_fd = other.external_fd;
+        other.external_data = nullptr;
+        other.external_size = 0;
+        other.external_fd = -1;
+    }
+
+    void release();  // munmap/close, defined in tp_manager.cpp
+};
+
 /**
  * @brief TP message being reassembled
  */
@@ -94,6 +165,7 @@ struct TpReassemblyBuffer {
     uint32_t total_length{0};                  // Total expected message length
     std::vector<uint8_t> received_data;     // Buffer for received data
     std::vector<bool> received_segments;    // Track which segments received
+    std::vector<uint32_t> received_offsets; // Segment offsets received (SACK source)
     std::chrono::steady_clock::time_point start_time{std::chrono::steady_clock::now()};
     uint8_t last_sequence_number{0};
     bool complete{false};
@@ -104,8 +176,16 @@ struct TpReassemblyBuffer {
         start_time = std::chrono::steady_clock::now();
     }
 
-    bool is_segment_received(uint16_t offset, uint16_t length) const;
-    void mark_segment_received(uint16_t offset, uint16_t length);
+    /// Adopt a recycled data buffer (capacity retained, no allocation)
+    TpReassemblyBuffer(uint32_t msg_id, uint32_t length, std::vector<uint8_t>&& recycled)
+        : message_id(msg_id), total_length(length), received_data(std::move(recycled)) {
+        received_data.clear();
+        received_data.resize(length);
+        start_time = std::chrono::steady_clock::now();
+    }
+
+    bool is_segment_received(uint32_t offset, uint32_t length) const;
+    void mark_segment_received(uint32_t offset, uint32_t length);
     bool is_complete() const;
     std::vector<uint8_t> get_complete_message() const;
 };
@@ -132,12 +212,21 @@ struct TpTransfer {
     uint32_t transfer_id{0};
     uint32_t message_id{0};
     TpTransferState state{TpTransferState::IDLE};
-    std::vector<TpSegment> segments;
+    std::vector<TpSegment> segments;          // Legacy owning storage
+    TpSegmentedMessage segmented;             // View-based storage (one copy)
     size_t next_segment_to_send{0};
     std::chrono::steady_clock::time_point start_time{std::chrono::steady_clock::now()};
     std::chrono::steady_clock::time_point last_activity{std::chrono::steady_clock::now()};
     uint32_t retry_count{0};
 
+    // Sliding-window / SACK state (per segment view)
+    std::vector<bool> acked;
+    std::vector<uint32_t> send_counts;
+    std::vector<std::chrono::steady_clock::time_point> send_times;
+    size_t window_base{0};          // First unacked segment index
+    size_t highest_acked_index{0};  // For gap (fast-retransmit) detection
+    uint8_t priority{4};            // 0 = highest; scheduler serves low values first
+
     TpTransfer() = default;
 
     TpTransfer(uint32_t id, uint32_t msg_id)
@@ -147,6 +236,19 @@ struct TpTransfer {
     }
 };
 
+/**
+ * @brief One scheduled segment ready for the wire
+ *
+ * data points into the transfer's retained buffer; batches align with
+ * the transport's sendmmsg/GSO submission paths.
+ */
+struct TpTransmitItem {
+    uint32_t transfer_id{0};
+    TpSegmentHeader header;
+    const uint8_t* data{nullptr};
+    size_t length{0};
+};
+
 /**
  * @brief TP callback types
  */
@@ -154,6 +256,19 @@ using TpCompletionCallback = std::function<void(uint32_t transfer_id, TpResult r
 using TpProgressCallback = std::function<void(uint32_t transfer_id, uint32_t bytes_transferred, uint32_t total_bytes)>;
 using TpMessageCallback = std::function<void(uint32_t message_id, const std::vector<uint8_t>& data)>;
 
+/**
+ * @brief Streaming-mode chunk delivery
+ *
+ * In-order completed byte ranges of an oversized transfer are handed
+ * out incrementally: offset is the position within the reassembled
+ * payload, final_chunk marks the range that completes it. data is
+ * valid only for the call's duration — sinks stream to their own
+ * storage (a file, an mmap) as bytes arrive.
+ */
+using TpChunkSink = std::function<void(uint8_t sequence_number, uint64_t offset,
+                                       const uint8_t* data, size_t length,
+                                       bool final_chunk)>;
+
 /**
  * @brief TP statistics
  */
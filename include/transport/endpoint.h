@@ -16,6 +16,7 @@
 
 #include <string>
 #include <cstdint>
+#include <netinet/in.h>
 
 namespace someip {
 namespace transport {
@@ -77,10 +78,32 @@ public:
 
     // Accessors
     const std::string& get_address() const { return address_; }
-    void set_address(const std::string& address) { address_ = address; }
+    void set_address(const std::string& address) {
+        address_ = address;
+        parse_binary();
+    }
+
+    /**
+     * @brief Parsed IPv4 address in network byte order (0 if unparsed)
+     */
+    uint32_t get_binary_address() const { return binary_addr_; }
+
+    /**
+     * @brief Ready-made sockaddr for send paths; nullptr if the
+     *        address did not parse as IPv4
+     *
+     * Built once when the address is set, so per-packet sends copy 16
+     * bytes instead of re-running inet_pton on the same peer string.
+     */
+    const sockaddr_in* cached_sockaddr() const {
+        return binary_valid_ ? &sockaddr_cache_ : nullptr;
+    }
 
     uint16_t get_port() const { return port_; }
-    void set_port(uint16_t port) { port_ = port; }
+    void set_port(uint16_t port) {
+        port_ = port;
+        sockaddr_cache_.sin_port = htons(port);
+    }
 
     TransportProtocol get_protocol() const { return protocol_; }
     void set_protocol(TransportProtocol protocol) { protocol_ = protocol; }
@@ -103,10 +126,18 @@ public:
     };
 
 private:
+    void parse_binary();
+
     std::string address_;
     uint16_t port_;
     TransportProtocol protocol_;
 
+    // Binary form: comparison/hash key and send-path sockaddr, built
+    // whenever the address/port is set
+    uint32_t binary_addr_{0};     // Network byte order
+    bool binary_valid_{false};
+    sockaddr_in sockaddr_cache_{};
+
     // Helper methods
     bool is_valid_ipv4(const std::string& address) const;
     bool is_valid_ipv6(const std::string& address) const;
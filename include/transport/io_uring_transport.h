@@ -0,0 +1,163 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_IO_URING_TRANSPORT_H
+#define SOMEIP_TRANSPORT_IO_URING_TRANSPORT_H
+
+#if defined(__linux__)
+
+#include "transport/transport.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief io_uring-based UDP transport (Linux only)
+ *
+ * Implements ITransport over a raw io_uring: a pool of receive slots
+ * is kept armed with RECVMSG submissions so bursts complete without
+ * per-packet syscalls, sends are queued as SENDMSG submissions into
+ * pooled slots and flushed in batches, and a single poller thread
+ * reaps all completions. Uses direct io_uring_setup/io_uring_enter
+ * syscalls, so no external liburing dependency is needed.
+ *
+ * Call is_supported() before constructing on kernels that may lack
+ * io_uring; start() returns NOT_IMPLEMENTED when the ring cannot be
+ * created.
+ */
+class IoUringUdpTransport : public ITransport {
+public:
+    /**
+     * @brief Whether the running kernel supports io_uring
+     */
+    static bool is_supported();
+
+    /**
+     * @brief Constructor
+     * @param local_endpoint Local endpoint to bind to
+     */
+    explicit IoUringUdpTransport(const Endpoint& local_endpoint);
+
+    /**
+     * @brief Destructor
+     */
+    ~IoUringUdpTransport() override;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Ring dimensions
+    static constexpr unsigned RING_ENTRIES = 256;
+    static constexpr size_t RECEIVE_SLOTS = 16;
+    static constexpr size_t SEND_SLOTS = 64;
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 65536;  // Full-size UDP datagrams
+
+private:
+    // One pre-armed receive submission worth of state
+    struct ReceiveSlot {
+        std::vector<uint8_t> buffer;
+        iovec iov;
+        msghdr msg;
+        sockaddr_in addr;
+    };
+
+    // One in-flight send worth of state (holds the bytes until the
+    // completion arrives)
+    struct SendSlot {
+        std::vector<uint8_t> data;
+        iovec iov;
+        msghdr msg;
+        sockaddr_in addr;
+    };
+
+    Endpoint local_endpoint_;
+    int socket_fd_{-1};
+    std::atomic<bool> running_{false};
+    std::thread poller_thread_;
+    ITransportListener* listener_{nullptr};
+
+    // Thread-safe message queue (same consumer interface as UdpTransport)
+    std::queue<MessagePtr> receive_queue_;
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+
+    // Ring state (all SQ access under ring_mutex_)
+    std::mutex ring_mutex_;
+    int ring_fd_{-1};
+    unsigned sq_entry_count_{0};
+    unsigned cq_entry_count_{0};
+    void* sq_ring_ptr_{nullptr};
+    size_t sq_ring_size_{0};
+    void* cq_ring_ptr_{nullptr};
+    size_t cq_ring_size_{0};
+    io_uring_sqe* sqes_{nullptr};
+    size_t sqes_size_{0};
+    unsigned* sq_head_{nullptr};
+    unsigned* sq_tail_{nullptr};
+    unsigned* sq_mask_{nullptr};
+    unsigned* sq_array_{nullptr};
+    unsigned* cq_head_{nullptr};
+    unsigned* cq_tail_{nullptr};
+    unsigned* cq_mask_{nullptr};
+    io_uring_cqe* cqes_{nullptr};
+    unsigned pending_submissions_{0};
+
+    std::vector<ReceiveSlot> receive_slots_;
+    std::vector<SendSlot> send_slots_;
+    std::vector<size_t> free_send_slots_;
+
+    // Private methods
+    Result create_socket();
+    Result bind_socket();
+    bool setup_ring();
+    void teardown_ring();
+    io_uring_sqe* get_sqe();
+    int submit_locked(unsigned wait_for);
+    void post_receive(size_t slot_index);
+    void post_nop();
+    void poller_loop();
+    void handle_receive_completion(size_t slot_index, int result);
+    sockaddr_in create_sockaddr(const Endpoint& endpoint) const;
+    Endpoint sockaddr_to_endpoint(const sockaddr_in& addr) const;
+
+    // Disable copy and assignment
+    IoUringUdpTransport(const IoUringUdpTransport&) = delete;
+    IoUringUdpTransport& operator=(const IoUringUdpTransport&) = delete;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // defined(__linux__)
+
+#endif // SOMEIP_TRANSPORT_IO_URING_TRANSPORT_H
@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_PRIORITY_SEND_QUEUE_H
+#define SOMEIP_TRANSPORT_PRIORITY_SEND_QUEUE_H
+
+#include "transport/transport.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Egress traffic classes, highest priority first
+ */
+enum class TrafficClass : uint8_t {
+    CONTROL = 0,   // Deadline-critical control events
+    RPC = 1,       // Requests and responses
+    EVENTS = 2,    // Notifications
+    BULK = 3       // TP segments, firmware, diagnostics dumps
+};
+
+/**
+ * @brief Priority-classed egress scheduler over any ITransport
+ *
+ * Callers enqueue messages tagged with a traffic class; a drain
+ * thread dequeues weighted-strictly — higher classes first, but
+ * after kStarvationGrant consecutive higher-class sends one lower-
+ * class message is granted so bulk never fully starves — and sends
+ * through the wrapped transport. A saturating TP transfer can no
+ * longer head-of-line block a 10ms-deadline control event inside our
+ * own stack. Per-class DSCP marking stays with the transport sockets
+ * (see UdpTransport::set_dscp); one queue per marked transport gives
+ * per-class code points.
+ */
+class PrioritySendQueue {
+public:
+    static constexpr size_t CLASS_COUNT = 4;
+    static constexpr size_t kStarvationGrant = 16;  // Higher-class sends per lower grant
+    static constexpr size_t kPerClassDepth = 1024;
+
+    explicit PrioritySendQueue(ITransport& transport);
+    ~PrioritySendQueue();
+
+    PrioritySendQueue(const PrioritySendQueue&) = delete;
+    PrioritySendQueue& operator=(const PrioritySendQueue&) = delete;
+
+    void start();
+    void stop();
+
+    /**
+     * @brief Queue a message for classed egress
+     * @return false when the class queue is at depth (shed)
+     */
+    bool enqueue(MessagePtr message, const Endpoint& endpoint, TrafficClass traffic_class);
+
+    /**
+     * @brief Block until every queued message has been sent
+     */
+    void flush();
+
+    uint64_t sent_count(TrafficClass traffic_class) const {
+        return sent_[static_cast<size_t>(traffic_class)].load();
+    }
+    uint64_t shed_count(TrafficClass traffic_class) const {
+        return shed_[static_cast<size_t>(traffic_class)].load();
+    }
+
+private:
+    struct Entry {
+        MessagePtr message;
+        Endpoint endpoint;
+    };
+
+    void drain_loop();
+    bool pick_next(Entry& entry, size_t& class_index);
+
+    ITransport& transport_;
+    std::atomic<bool> running_{false};
+    std::thread drain_thread_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable idle_cv_;
+    std::array<std::deque<Entry>, CLASS_COUNT> queues_;
+    size_t consecutive_high_{0};
+
+    std::array<std::atomic<uint64_t>, CLASS_COUNT> sent_{};
+    std::array<std::atomic<uint64_t>, CLASS_COUNT> shed_{};
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_PRIORITY_SEND_QUEUE_H
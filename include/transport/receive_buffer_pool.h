@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_RECEIVE_BUFFER_POOL_H
+#define SOMEIP_TRANSPORT_RECEIVE_BUFFER_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Thread-safe pool of full-size receive buffers
+ *
+ * Hands out buffers large enough for a maximum-length UDP datagram so
+ * nothing is silently truncated, and recycles them so the receive
+ * paths stop allocating per packet: a released buffer keeps its
+ * capacity and the next acquire() reuses it. Buffer size is set per
+ * pool, so a deployment running jumbo frames can size a dedicated
+ * pool instead of taking the 64KB default.
+ *
+ * The transports draw from the process-wide default pool; release()
+ * accepts any buffer but only re-pools ones whose capacity matches,
+ * so shrunken or foreign vectors never poison the free list.
+ */
+class ReceiveBufferPool {
+public:
+    /// Enough for the largest possible UDP datagram
+    static constexpr size_t FULL_DATAGRAM_SIZE = 65536;
+    static constexpr size_t kDefaultMaxPooled = 64;
+
+    /**
+     * @brief Pool usage counters for telemetry
+     */
+    struct Statistics {
+        uint64_t acquired = 0;     ///< Total acquire() calls
+        uint64_t pool_hits = 0;    ///< Acquires served from the free list
+        uint64_t pool_misses = 0;  ///< Acquires that had to allocate
+        uint64_t released = 0;     ///< Buffers returned to the pool
+        uint64_t dropped = 0;      ///< Releases freed (pool full or wrong size)
+        size_t pooled = 0;         ///< Buffers currently in the free list
+    };
+
+    /**
+     * @brief Create a pool
+     * @param buffer_size Capacity of every buffer the pool hands out
+     * @param max_pooled Free-list cap; releases beyond it free the buffer
+     */
+    explicit ReceiveBufferPool(size_t buffer_size = FULL_DATAGRAM_SIZE,
+                               size_t max_pooled = kDefaultMaxPooled);
+
+    /**
+     * @brief Process-wide pool of FULL_DATAGRAM_SIZE buffers shared by the transports
+     */
+    static const std::shared_ptr<ReceiveBufferPool>& get_default();
+
+    /**
+     * @brief Get a recycled (or fresh) buffer, sized to buffer_size()
+     */
+    std::vector<uint8_t> acquire();
+
+    /**
+     * @brief Return a buffer for reuse
+     *
+     * Buffers whose capacity no longer matches buffer_size() (or that
+     * arrive when the free list is full) are simply freed.
+     */
+    void release(std::vector<uint8_t> buffer);
+
+    size_t buffer_size() const { return buffer_size_; }
+
+    /**
+     * @brief Current usage counters
+     */
+    Statistics get_statistics() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> free_list_;
+    size_t buffer_size_;
+    size_t max_pooled_;
+    Statistics statistics_;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_RECEIVE_BUFFER_POOL_H
@@ -0,0 +1,80 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_SERVICE_DEMUX_H
+#define SOMEIP_TRANSPORT_SERVICE_DEMUX_H
+
+#include "transport/transport.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Shared-endpoint service demultiplexer
+ *
+ * One transport instance hosts any number of services: the demux
+ * installs itself as the transport's listener and routes every
+ * inbound message by Message::get_service_id() through a flat
+ * direct-indexed handler table — one socket and one receive thread
+ * for a 14-service process instead of fourteen of each. Handler
+ * slots swap atomically, so dispatch is lock-free and registration
+ * can happen while traffic flows.
+ */
+class ServiceDemux : public ITransportListener {
+public:
+    using ServiceHandler = std::function<void(MessagePtr, const Endpoint&)>;
+
+    /**
+     * @param transport Shared transport; the demux becomes its listener
+     */
+    explicit ServiceDemux(ITransport& transport);
+
+    /**
+     * @brief Route a service id to a handler (replaces any previous)
+     */
+    void register_service(uint16_t service_id, ServiceHandler handler);
+
+    /**
+     * @brief Remove a service's route
+     */
+    void unregister_service(uint16_t service_id);
+
+    /**
+     * @brief Messages that matched no registered service
+     */
+    uint64_t unrouted_count() const { return unrouted_.load(); }
+
+    // ITransportListener
+    void on_message_received(MessagePtr message, const Endpoint& sender) override;
+    void on_messages_received(
+        const std::vector<std::pair<MessagePtr, Endpoint>>& messages) override;
+    void on_connection_lost(const Endpoint& endpoint) override;
+    void on_connection_established(const Endpoint& endpoint) override;
+    void on_error(Result error) override;
+
+private:
+    ITransport& transport_;
+
+    // Flat table: one atomic shared_ptr slot per possible service id
+    static constexpr size_t SLOT_COUNT = 65536;
+    std::unique_ptr<std::shared_ptr<const ServiceHandler>[]> handlers_;
+    std::atomic<uint64_t> unrouted_{0};
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_SERVICE_DEMUX_H
@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_SHARDED_UDP_TRANSPORT_H
+#define SOMEIP_TRANSPORT_SHARDED_UDP_TRANSPORT_H
+
+#include "transport/transport.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include <netinet/in.h>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief SO_REUSEPORT-sharded UDP transport
+ *
+ * Binds N sockets with SO_REUSEPORT to the same local endpoint so the
+ * kernel spreads incoming datagrams across them by flow hash. Each
+ * shard runs its own receive thread (pinned to a core where the
+ * platform allows it) draining into its own queue, so ingest scales
+ * with cores instead of capping out at one receive thread. The shards
+ * are presented to the application as one logical ITransport:
+ * receive_message() round-robins across the shard queues and the
+ * listener sees a single stream of callbacks.
+ *
+ * Ordering is preserved per flow (the kernel keeps one flow on one
+ * shard) but not across flows, same as any multi-queue NIC setup.
+ */
+class ShardedUdpTransport : public ITransport {
+public:
+    /**
+     * @brief Constructor
+     * @param local_endpoint Local endpoint every shard binds to
+     * @param shard_count Number of sockets/threads; 0 picks default_shard_count()
+     */
+    explicit ShardedUdpTransport(const Endpoint& local_endpoint, size_t shard_count = 0);
+
+    /**
+     * @brief Destructor
+     */
+    ~ShardedUdpTransport() override;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    /**
+     * @brief Number of shards this transport runs
+     */
+    size_t get_shard_count() const { return shards_.size(); }
+
+    /**
+     * @brief Default shard count: one per core, capped at MAX_SHARDS
+     */
+    static size_t default_shard_count();
+
+    // Batch size for the per-shard recvmmsg fast path
+    static constexpr size_t RECEIVE_BATCH_SIZE = 32;
+    static constexpr size_t MAX_SHARDS = 16;
+
+private:
+    // One socket + receive thread + queue; heap-allocated because the
+    // mutex makes the struct immovable
+    struct Shard {
+        int socket_fd{-1};
+        std::thread receive_thread;
+        std::queue<MessagePtr> receive_queue;
+        std::mutex queue_mutex;
+        std::condition_variable queue_cv;
+    };
+
+    Endpoint local_endpoint_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> consume_cursor_{0};
+    ITransportListener* listener_{nullptr};
+
+    // All sends go out through shard 0's socket
+    std::mutex send_mutex_;
+
+    static constexpr size_t MAX_UDP_PAYLOAD = 65507;
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 65536;
+
+    // Private methods
+    Result create_shard_socket(Shard& shard);
+    void receive_loop(size_t shard_index);
+    void pin_current_thread(size_t shard_index);
+    sockaddr_in create_sockaddr(const Endpoint& endpoint) const;
+    Endpoint sockaddr_to_endpoint(const sockaddr_in& addr) const;
+
+    // Disable copy and assignment
+    ShardedUdpTransport(const ShardedUdpTransport&) = delete;
+    ShardedUdpTransport& operator=(const ShardedUdpTransport&) = delete;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_SHARDED_UDP_TRANSPORT_H
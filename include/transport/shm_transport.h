@@ -0,0 +1,122 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_SHM_TRANSPORT_H
+#define SOMEIP_TRANSPORT_SHM_TRANSPORT_H
+
+#if defined(__linux__)
+
+#include "transport/transport.h"
+#include "transport/spsc_ring.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief Shared-memory transport for same-host peers (Linux only)
+ *
+ * Each transport owns one shm segment, named after its local endpoint
+ * port, holding a lock-free multi-producer ring of fixed-size frame
+ * slots (per-slot sequence numbers, same scheme as SpscRing) plus a
+ * futex word for wakeup. send_message maps the destination port's
+ * segment (cached per endpoint) and enqueues the serialized frame
+ * directly — no socket, no NIC path, sub-microsecond latency for
+ * intra-host event delivery.
+ *
+ * Peer selection: use is_same_host() to decide between this and a
+ * socket transport when discovery reports the publisher's address.
+ */
+class ShmTransport : public ITransport {
+public:
+    /**
+     * @brief Whether two endpoints are on the same host
+     *
+     * True when the remote address is a loopback address or equals the
+     * local address — the condition under which this transport can
+     * replace the UDP path.
+     */
+    static bool is_same_host(const Endpoint& local, const Endpoint& remote);
+
+    /**
+     * @brief Constructor
+     * @param local_endpoint Local endpoint; the port names the shm segment
+     */
+    explicit ShmTransport(const Endpoint& local_endpoint);
+
+    /**
+     * @brief Destructor
+     */
+    ~ShmTransport() override;
+
+    // ITransport interface implementation
+    [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
+    MessagePtr receive_message() override;
+    Result connect(const Endpoint& endpoint) override;
+    Result disconnect() override;
+    bool is_connected() const override;
+    Endpoint get_local_endpoint() const override;
+    void set_listener(ITransportListener* listener) override;
+    Result start() override;
+    Result stop() override;
+    bool is_running() const override;
+
+    // Ring geometry: 256 slots of 8KB ≈ 2MB per segment
+    static constexpr size_t SLOT_COUNT = 256;   // Power of two
+    static constexpr size_t SLOT_SIZE = 8192;   // Max frame per slot
+
+private:
+    struct Segment;       // Shm layout, defined in the .cpp
+    struct MappedPeer {
+        int fd{-1};
+        Segment* segment{nullptr};
+    };
+
+    Endpoint local_endpoint_;
+    std::string shm_name_;
+    std::atomic<bool> running_{false};
+    std::thread receive_thread_;
+    ITransportListener* listener_{nullptr};
+
+    int shm_fd_{-1};
+    Segment* segment_{nullptr};
+
+    // Destination segments mapped on first send, cached per port
+    std::mutex peers_mutex_;
+    std::unordered_map<uint16_t, MappedPeer> peers_;
+
+    // Lock-free SPSC handoff from the receive thread to the consumer
+    SpscRing<MessagePtr> receive_queue_;
+
+    // Private methods
+    bool create_segment();
+    void destroy_segment();
+    Segment* map_peer(uint16_t port);
+    void receive_loop();
+    static std::string segment_name(uint16_t port);
+
+    // Disable copy and assignment
+    ShmTransport(const ShmTransport&) = delete;
+    ShmTransport& operator=(const ShmTransport&) = delete;
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // defined(__linux__)
+
+#endif // SOMEIP_TRANSPORT_SHM_TRANSPORT_H
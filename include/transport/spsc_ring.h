@@ -0,0 +1,192 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TRANSPORT_SPSC_RING_H
+#define SOMEIP_TRANSPORT_SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace someip {
+namespace transport {
+
+/**
+ * @brief What a full ring does with the next push
+ */
+enum class OverflowPolicy : uint8_t {
+    DROP_NEWEST,  ///< Reject the incoming element, keep the backlog
+    DROP_OLDEST   ///< Evict the oldest queued element to make room
+};
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring buffer
+ *
+ * Replaces the mutex/condvar receive queues on the transport hot path:
+ * exactly one thread (the receive loop) pushes and exactly one thread
+ * (the receive_message() caller) pops, so in steady state each side
+ * touches only its own index — no locks, no syscalls, no priority
+ * inversion.
+ *
+ * Capacity is rounded up to a power of two. Overflow is explicit:
+ * DROP_NEWEST refuses the push, DROP_OLDEST evicts the head; both
+ * keep counters so drops are observable instead of silent. Cells
+ * carry per-slot sequence numbers (Vyukov-style) because under
+ * DROP_OLDEST the producer briefly acts as a second consumer to
+ * evict, and the sequences keep that safe without widening the
+ * element type to an atomic.
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity, OverflowPolicy policy = OverflowPolicy::DROP_NEWEST)
+        : policy_(policy) {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        cells_ = std::make_unique<Cell[]>(rounded);
+        mask_ = rounded - 1;
+        for (size_t i = 0; i < rounded; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Producer side: enqueue one element
+     * @return true if the element was stored, false if dropped (DROP_NEWEST)
+     */
+    bool push(T value) {
+        while (true) {
+            size_t pos = tail_.load(std::memory_order_relaxed);
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Slot free: claim it (uncontended, we are the only producer)
+                tail_.store(pos + 1, std::memory_order_relaxed);
+                cell.value = std::move(value);
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            if (diff < 0) {
+                // Ring full
+                if (policy_ == OverflowPolicy::DROP_NEWEST) {
+                    dropped_newest_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                if (evict_oldest()) {
+                    dropped_oldest_.fetch_add(1, std::memory_order_relaxed);
+                }
+                // Either we evicted or the consumer freed a slot; retry
+            }
+            // diff > 0 cannot happen with a single producer; loop re-reads
+        }
+    }
+
+    /**
+     * @brief Consumer side: dequeue one element
+     * @return true if an element was written to out, false if empty
+     */
+    bool pop(T& out) {
+        return pop_internal(out);
+    }
+
+    /**
+     * @brief Approximate number of queued elements
+     */
+    size_t size() const {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_t capacity() const { return mask_ + 1; }
+
+    OverflowPolicy policy() const { return policy_; }
+
+    /**
+     * @brief Elements evicted to make room (DROP_OLDEST)
+     */
+    uint64_t dropped_oldest() const {
+        return dropped_oldest_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Elements refused because the ring was full (DROP_NEWEST)
+     */
+    uint64_t dropped_newest() const {
+        return dropped_newest_.load(std::memory_order_relaxed);
+    }
+
+    // Disable copy and assignment (atomics are not copyable anyway)
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    // Shared dequeue core: the consumer calls it through pop(), the
+    // producer through evict_oldest(); the head CAS arbitrates the two
+    bool pop_internal(T& out) {
+        while (true) {
+            size_t pos = head_.load(std::memory_order_relaxed);
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            if (diff < 0) {
+                return false;  // Empty
+            }
+
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    out = std::move(cell.value);
+                    cell.value = T{};
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+                continue;  // Lost the slot to the other dequeuer
+            }
+
+            // diff > 0: another dequeuer already claimed this slot; re-read head
+        }
+    }
+
+    bool evict_oldest() {
+        T discard;
+        return pop_internal(discard);
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_{0};
+    OverflowPolicy policy_;
+    std::atomic<size_t> head_{0};  // Consumer index (CAS: producer evicts too)
+    std::atomic<size_t> tail_{0};  // Producer index
+    std::atomic<uint64_t> dropped_oldest_{0};
+    std::atomic<uint64_t> dropped_newest_{0};
+};
+
+} // namespace transport
+} // namespace someip
+
+#endif // SOMEIP_TRANSPORT_SPSC_RING_H
@@ -15,11 +15,16 @@
 #define SOMEIP_TRANSPORT_TCP_TRANSPORT_H
 
 #include "transport/transport.h"
+#include "transport/spsc_ring.h"
+#include <sys/uio.h>
+#include <array>
 #include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
 #include <thread>
 #include <mutex>
-#include <queue>
-#include <condition_variable>
+#include <unordered_map>
 
 namespace someip {
 namespace transport {
@@ -34,6 +39,19 @@ enum class TcpConnectionState : uint8_t {
     DISCONNECTING
 };
 
+/**
+ * @brief One MSG_ZEROCOPY send whose pages the kernel still references
+ *
+ * The held MessagePtr keeps the payload bytes alive (and the header
+ * copy lives here) until the kernel's completion notification for
+ * last_seq arrives on the socket error queue.
+ */
+struct TcpZeroCopyBlock {
+    uint32_t last_seq{0};
+    MessagePtr message;
+    std::array<uint8_t, 16> header{};
+};
+
 /**
  * @brief TCP Connection Information
  */
@@ -42,7 +60,23 @@ struct TcpConnection {
     Endpoint remote_endpoint;
     TcpConnectionState state{TcpConnectionState::DISCONNECTED};
     std::chrono::steady_clock::time_point last_activity{std::chrono::steady_clock::now()};
+
+    // Framing stage: bytes land at the tail, frames are consumed by
+    // advancing receive_head — no per-frame data movement. The dead
+    // prefix is compacted only when it outgrows the live remainder.
     std::vector<uint8_t> receive_buffer;
+    size_t receive_head{0};
+
+    bool outbound{false};  // We dialed it (reconnect candidate)
+
+    // MSG_ZEROCOPY bookkeeping (Linux; unused elsewhere). The send
+    // mutex serializes zero-copy sends per connection so the sequence
+    // accounting matches the kernel's sendmsg order; it is heap-held so
+    // the struct stays movable and the lock survives map rehashing
+    bool zerocopy_enabled{false};
+    uint32_t zerocopy_next_seq{0};
+    std::deque<std::unique_ptr<TcpZeroCopyBlock>> zerocopy_inflight;
+    std::shared_ptr<std::mutex> zerocopy_send_mutex{std::make_shared<std::mutex>()};
 
     TcpConnection() = default;
 
@@ -66,6 +100,15 @@ struct TcpTransportConfig {
     size_t max_connections{10};                             // Max concurrent connections
     bool keep_alive{true};                                  // TCP keep-alive
     std::chrono::milliseconds keep_alive_interval{30000};   // Keep-alive interval
+    size_t receive_queue_capacity{1024};                    // Bounded receive ring size
+    OverflowPolicy overflow_policy{OverflowPolicy::DROP_NEWEST};  // Full-ring behavior
+    bool zerocopy_enabled{false};                           // Opt into MSG_ZEROCOPY sends
+    size_t zerocopy_threshold{16384};                       // Min payload for zero-copy
+    bool enable_compression{false};                         // LZ4 payloads (consenting peers)
+    size_t compression_threshold{4096};                     // Min payload size to compress
+    bool auto_reconnect{false};                             // Re-dial lost outbound peers
+    std::chrono::milliseconds reconnect_base{100};          // Backoff start
+    std::chrono::milliseconds reconnect_max{5000};          // Backoff ceiling
 };
 
 /**
@@ -73,6 +116,14 @@ struct TcpTransportConfig {
  *
  * Provides reliable, connection-oriented transport for SOME/IP messages
  * using TCP sockets. Supports both client and server modes.
+ *
+ * Connections live in a table keyed by socket and by remote endpoint:
+ * one event loop (epoll on Linux, poll elsewhere) services accepts and
+ * reads for every connection, so a server scales to hundreds of
+ * concurrent clients on a single thread instead of one connection per
+ * transport object. send_message routes by destination endpoint; with
+ * exactly one live connection the endpoint may be anything, preserving
+ * the old single-connection behavior.
  */
 class TcpTransport : public ITransport {
 public:
@@ -108,6 +159,28 @@ public:
      */
     [[nodiscard]] Result send_message(const Message& message, const Endpoint& endpoint) override;
 
+    /**
+     * @brief Send a shared message, using MSG_ZEROCOPY when profitable
+     *
+     * With zerocopy_enabled in the config and a payload at or above
+     * zerocopy_threshold, the payload pages go to the NIC without a
+     * copy; the MessagePtr is held until the kernel's completion
+     * notification so the bytes stay pinned safely. Callers must not
+     * mutate the message after passing it here. Falls back to the
+     * plain vectored send otherwise (and on non-Linux platforms).
+     *
+     * @param message The message to send (shared ownership)
+     * @param endpoint The destination endpoint
+     * @return Result of the operation
+     */
+    [[nodiscard]] Result send_message(const MessagePtr& message, const Endpoint& endpoint);
+
+    /**
+     * @brief Pre-serialized send routed by endpoint
+     */
+    [[nodiscard]] Result send_serialized(const std::vector<uint8_t>& data,
+                                         const Endpoint& endpoint) override;
+
     /**
      * @brief Receive a message (non-blocking)
      * @return Received message or nullptr if no message available
@@ -178,33 +251,89 @@ public:
 
     /**
      * @brief Accept incoming connection (server mode)
+     *
+     * Accepts are normally handled inside the event loop; this remains
+     * for callers that drive accepts manually before start(). The
+     * returned connection is registered in the connection table.
+     *
      * @return New connection socket FD or -1 on error
      */
     int accept_connection();
 
+    /**
+     * @brief Pre-connect warm standby connections to a peer
+     *
+     * One connection enters the routing table; the rest idle as warm
+     * standbys promoted instantly when the active connection drops, so
+     * post-failure calls skip the full dial latency. With
+     * auto_reconnect configured, consumed standbys are replenished in
+     * the background with exponential backoff.
+     */
+    Result warm_up(const Endpoint& endpoint, size_t standby_count);
+
+    /**
+     * @brief Number of live connections in the table
+     */
+    size_t get_connection_count() const;
+
+    /**
+     * @brief Warm standby connections currently held for a peer
+     */
+    size_t standby_count(const Endpoint& endpoint) const;
+
+    /**
+     * @brief Sends that went out via MSG_ZEROCOPY
+     */
+    uint64_t get_zerocopy_sends() const { return zerocopy_sends_.load(); }
+
+    /**
+     * @brief Messages evicted from a full receive ring (DROP_OLDEST)
+     */
+    uint64_t get_dropped_oldest() const { return message_queue_.dropped_oldest(); }
+
+    /**
+     * @brief Messages refused by a full receive ring (DROP_NEWEST)
+     */
+    uint64_t get_dropped_newest() const { return message_queue_.dropped_newest(); }
+
 private:
     TcpTransportConfig config_;
     Endpoint local_endpoint_;
-    TcpConnection connection_;
     ITransportListener* listener_{nullptr};
 
-    // Threading
+    // Threading: one event loop services sockets, accepts, wakeups and
+    // the idle-sweep timer — no helper threads
     std::atomic<bool> running_{false};
-    std::thread receive_thread_;
-    std::thread connection_thread_;
+    std::thread event_thread_;
 
-    // Connection management
+    // Connection table (fd-keyed) plus the endpoint index used to
+    // route sends; both guarded by connection_mutex_
+    mutable std::mutex connection_mutex_;
+    std::unordered_map<int, TcpConnection> connections_;
+    std::map<Endpoint, int> endpoint_to_fd_;
     std::atomic<size_t> active_connections_{0};
+    std::atomic<uint64_t> zerocopy_sends_{0};
+
+    // Warm standby sockets per peer + background reconnect queue
+    mutable std::mutex standby_mutex_;
+    std::map<Endpoint, std::vector<int>> standby_;
+    struct ReconnectEntry {
+        Endpoint endpoint;
+        std::chrono::steady_clock::time_point next_attempt;
+        std::chrono::milliseconds backoff{0};
+    };
+    std::vector<ReconnectEntry> reconnect_queue_;
+    std::thread reconnect_thread_;
+
+    // Lock-free SPSC receive ring (producer: event loop, consumer:
+    // receive_message)
+    SpscRing<std::pair<MessagePtr, Endpoint>> message_queue_;
 
-    // Message queue
-    std::queue<std::pair<MessagePtr, Endpoint>> message_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
-
-    // Connection management
-    std::mutex connection_mutex_;
     bool server_mode_{false};
-    int listen_socket_fd_{-1};
+    int listen_socket_fd_{-1};   // The socket created by initialize()
+    int epoll_fd_{-1};           // Linux event loop handle
+    int timer_fd_{-1};           // Idle-sweep timer (Linux timerfd)
+    int wakeup_fds_[2]{-1, -1};  // eventfd on Linux ([1] unused), self-pipe elsewhere
 
     // Helper methods
     Result create_socket();
@@ -212,11 +341,27 @@ private:
     Result setup_socket_options(int socket_fd, bool blocking = true);
     Result connect_internal(const Endpoint& endpoint);
     void disconnect_internal();
-    void receive_loop();
-    void connection_monitor_loop();
+    void event_loop();
+    void sweep_idle_connections();
+    void register_connection(int socket_fd, const Endpoint& remote_endpoint,
+                             bool outbound = false);
+    void close_connection(int socket_fd, bool notify);
+    void handle_accept();
+    void handle_readable(int socket_fd);
+    void watch_fd(int fd);
+    void unwatch_fd(int fd);
+    void wake_event_loop();
+    int lookup_route(const Endpoint& endpoint) const;
+    int dial(const Endpoint& endpoint, std::chrono::milliseconds timeout);
+    void reconnect_loop();
+    void schedule_reconnect(const Endpoint& endpoint);
+    Result send_zerocopy(int socket_fd, const MessagePtr& message);
+    size_t reap_zerocopy_completions(int socket_fd);
     Result send_data(int socket_fd, const std::vector<uint8_t>& data);
+    Result send_vectored(int socket_fd, iovec* iov, int iov_count);
     Result receive_data(int socket_fd, std::vector<uint8_t>& data);
-    bool parse_message_from_buffer(std::vector<uint8_t>& buffer, MessagePtr& message);
+    bool parse_message_from_buffer(TcpConnection& connection, MessagePtr& message);
+    static void compact_receive_buffer(TcpConnection& connection);
 
     // Message parsing
     static const size_t SOMEIP_HEADER_SIZE = 16;
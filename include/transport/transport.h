@@ -19,6 +19,8 @@
 #include "common/result.h"
 #include <memory>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace someip {
 namespace transport {
@@ -40,6 +42,22 @@ public:
      */
     virtual void on_message_received(MessagePtr message, const Endpoint& sender) = 0;
 
+    /**
+     * @brief Called when several messages arrive together (batched I/O)
+     *
+     * Transports that drain multiple datagrams per syscall deliver them
+     * as one group so downstream processing can amortize locking. The
+     * default implementation simply forwards each message to
+     * on_message_received.
+     *
+     * @param messages The received messages with their senders
+     */
+    virtual void on_messages_received(const std::vector<std::pair<MessagePtr, Endpoint>>& messages) {
+        for (const auto& entry : messages) {
+            on_message_received(entry.first, entry.second);
+        }
+    }
+
     /**
      * @brief Called when connection to endpoint is lost
      * @param endpoint The endpoint that lost connection
@@ -77,6 +95,25 @@ public:
      */
     [[nodiscard]] virtual Result send_message(const Message& message, const Endpoint& endpoint) = 0;
 
+    /**
+     * @brief Send pre-serialized message bytes to an endpoint
+     *
+     * The fan-out/retransmission fast path: callers serialize once
+     * (Message::serialize_into) and hand the same buffer to many
+     * sends without per-destination re-serialization. The default
+     * raises NOT_IMPLEMENTED for transports that have not opted in.
+     *
+     * @param data Full serialized message (header + payload)
+     * @param endpoint The destination endpoint
+     * @return Result of the operation
+     */
+    [[nodiscard]] virtual Result send_serialized(const std::vector<uint8_t>& data,
+                                                 const Endpoint& endpoint) {
+        (void)data;
+        (void)endpoint;
+        return Result::NOT_IMPLEMENTED;
+    }
+
     /**
      * @brief Receive a message (non-blocking)
      * @return Received message or nullptr if no message available
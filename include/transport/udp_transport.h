@@ -15,16 +15,47 @@
 #define SOMEIP_TRANSPORT_UDP_TRANSPORT_H
 
 #include "transport/transport.h"
+#include "transport/spsc_ring.h"
+#include "core/event_loop.h"
 #include <thread>
 #include <atomic>
 #include <mutex>
-#include <queue>
-#include <condition_variable>
 #include <netinet/in.h>
 
 namespace someip {
 namespace transport {
 
+/**
+ * @brief Socket buffer tuning for a transport
+ */
+struct SocketTuningConfig {
+    size_t initial_rcvbuf{0};               // 0 = kernel default
+    size_t initial_sndbuf{0};               // 0 = kernel default
+    bool adaptive{false};                   // Grow rcvbuf when the kernel drops
+    size_t rcvbuf_ceiling{8 * 1024 * 1024}; // Adaptive growth limit
+};
+
+/**
+ * @brief Kernel-visible socket health, surfaced per transport
+ */
+struct SocketStats {
+    uint64_t kernel_drops{0};   // Datagrams the kernel dropped (SO_RXQ_OVFL)
+    size_t current_rcvbuf{0};   // Effective receive buffer bytes
+    uint32_t buffer_growths{0}; // Adaptive resizes performed
+};
+
+/**
+ * @brief Latency-critical tuning for a transport's receive path
+ */
+struct LowLatencyConfig {
+    bool busy_poll{true};            // SO_BUSY_POLL + userspace spin
+    int busy_poll_us{50};            // Kernel busy-poll budget
+    uint32_t spin_us{100};           // Userspace spin before backing off to poll()
+    int pinned_core{-1};             // CPU to pin the receive thread to (-1 = none)
+    int sched_fifo_priority{0};      // SCHED_FIFO priority (>0 to enable; needs privilege)
+    bool direct_dispatch{true};      // Listener called in-loop, queue bypassed
+};
+
 /**
  * @brief UDP transport implementation
  *
@@ -36,8 +67,12 @@ public:
     /**
      * @brief Constructor
      * @param local_endpoint Local endpoint to bind to
+     * @param receive_queue_capacity Bounded receive ring size (rounded up to a power of two)
+     * @param overflow_policy What a full receive ring does with the next datagram
      */
-    explicit UdpTransport(const Endpoint& local_endpoint);
+    explicit UdpTransport(const Endpoint& local_endpoint,
+                          size_t receive_queue_capacity = DEFAULT_RECEIVE_QUEUE_CAPACITY,
+                          OverflowPolicy overflow_policy = OverflowPolicy::DROP_NEWEST);
 
     /**
      * @brief Destructor
@@ -56,10 +91,127 @@ public:
     Result stop() override;
     bool is_running() const override;
 
-    // Multicast support
-    Result join_multicast_group(const std::string& multicast_address);
+    /**
+     * @brief Send several messages with a single syscall where possible
+     *
+     * On Linux the batch is submitted through sendmmsg in chunks of
+     * kSendBatchSize; elsewhere it falls back to per-message sends.
+     * Stops at the first failing message.
+     *
+     * @param messages Messages with their destination endpoints
+     * @return Result of the operation
+     */
+    [[nodiscard]] Result send_messages(const std::vector<std::pair<MessagePtr, Endpoint>>& messages);
+
+    /**
+     * @brief Send a pre-packed datagram of back-to-back messages
+     *
+     * Used by request batching: several serialized SOME/IP messages
+     * are concatenated and sent as one datagram; the receive path
+     * splits them again via the header length fields.
+     */
+    Result send_packed(const std::vector<uint8_t>& data, const Endpoint& endpoint) {
+        return send_data(data, endpoint);
+    }
+
+    /**
+     * @brief Pre-serialized send: one datagram, no re-serialization
+     */
+    [[nodiscard]] Result send_serialized(const std::vector<uint8_t>& data,
+                                         const Endpoint& endpoint) override {
+        return send_data(data, endpoint);
+    }
+
+    // Multicast support. interface_address pins the membership/egress
+    // interface (deployments with several NICs — or loopback-only test
+    // rigs — need this); empty lets the kernel route.
+    Result join_multicast_group(const std::string& multicast_address,
+                                const std::string& interface_address = std::string());
     Result leave_multicast_group(const std::string& multicast_address);
 
+    /**
+     * @brief Pin outgoing multicast traffic to an interface
+     *
+     * Also enables multicast loopback so same-host subscribers see
+     * the datagrams.
+     */
+    Result set_multicast_interface(const std::string& interface_address);
+
+    /**
+     * @brief Configure socket buffer sizes and adaptive growth
+     *
+     * Call before start(). With adaptive on, the receive loop watches
+     * the kernel's per-socket drop counter (SO_RXQ_OVFL) and doubles
+     * SO_RCVBUF toward the ceiling whenever new drops appear — silent
+     * UDP loss becomes observable and self-correcting.
+     */
+    Result configure_socket_tuning(const SocketTuningConfig& config);
+
+    /**
+     * @brief Kernel drop counter and current buffer sizes
+     */
+    SocketStats get_socket_stats() const;
+
+    /**
+     * @brief Mark this socket's egress with a DSCP code point
+     *
+     * Per-class marking: give each traffic class its own transport and
+     * DSCP so switches can honor the classes end to end.
+     */
+    Result set_dscp(uint8_t dscp);
+
+    /**
+     * @brief Enable the latency-critical receive mode
+     *
+     * Call before start(). Busy-polling burns a core for deterministic
+     * sub-100us turnaround: the kernel polls the NIC (SO_BUSY_POLL),
+     * the receive thread spins before falling back to poll(), it can
+     * be pinned to an isolated core and raised to SCHED_FIFO, and
+     * messages go straight to the listener on the receive thread with
+     * no queue handoff.
+     */
+    Result enable_low_latency_mode(const LowLatencyConfig& config);
+
+    /**
+     * @brief Service this transport from a shared event loop
+     *
+     * Call before start(): instead of spawning a dedicated receive
+     * thread, the socket registers with the loop and datagrams are
+     * drained on its thread — N transports, one poller. The loop must
+     * outlive the transport's running interval.
+     */
+    Result attach_to_event_loop(EventLoop& loop);
+
+    /**
+     * @brief Whether the running kernel supports UDP GSO (UDP_SEGMENT)
+     *
+     * Checked once per process; send_messages uses the GSO super-packet
+     * path only when this returns true.
+     */
+    static bool is_gso_supported();
+
+    /**
+     * @brief Messages evicted from a full receive ring (DROP_OLDEST)
+     */
+    uint64_t get_dropped_oldest() const { return receive_queue_.dropped_oldest(); }
+
+    /**
+     * @brief Messages refused by a full receive ring (DROP_NEWEST)
+     */
+    uint64_t get_dropped_newest() const { return receive_queue_.dropped_newest(); }
+
+    // Batch sizes for the recvmmsg/sendmmsg fast paths
+    static constexpr size_t RECEIVE_BATCH_SIZE = 32;  // Datagrams drained per recvmmsg
+    static constexpr size_t SEND_BATCH_SIZE = 32;     // Datagrams submitted per sendmmsg
+
+    // Default bound for the lock-free receive ring
+    static constexpr size_t DEFAULT_RECEIVE_QUEUE_CAPACITY = 1024;
+
+    // GSO coalescing limits: one super-packet per syscall, split into
+    // per-datagram segments by the kernel/NIC
+    static constexpr size_t GSO_MAX_BYTES = 65000;   // Super-packet byte budget
+    static constexpr size_t GSO_MAX_SEGMENTS = 64;   // Kernel segment cap
+
 private:
     Endpoint local_endpoint_;
     int socket_fd_{-1};
@@ -67,23 +219,36 @@ private:
     std::thread receive_thread_;
     ITransportListener* listener_{nullptr};
 
-    // Thread-safe message queue
-    std::queue<MessagePtr> receive_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
+    // Lock-free SPSC receive ring (producer: receive_loop, consumer:
+    // receive_message)
+    SpscRing<MessagePtr> receive_queue_;
 
     // Socket management
     std::mutex socket_mutex_;
+    bool gro_enabled_{false};  // Kernel accepted UDP_GRO on our socket
+    EventLoop* event_loop_{nullptr};  // Non-null: shared-loop mode, no receive thread
+    bool low_latency_{false};
+    LowLatencyConfig low_latency_config_;
+    SocketTuningConfig tuning_;
+    bool rxq_ovfl_enabled_{false};
+    std::atomic<uint64_t> kernel_drops_{0};
+    std::atomic<uint32_t> buffer_growths_{0};
+    void maybe_grow_rcvbuf(uint64_t observed_drops);
 
     // Constants
     static constexpr size_t MAX_UDP_PAYLOAD = 65507; // Maximum UDP payload size
-    static constexpr size_t RECEIVE_BUFFER_SIZE = 8192;
+    // Full-size receive buffers (pooled): no datagram is ever truncated
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 65536;
 
     // Private methods
     Result create_socket();
     Result bind_socket();
     Result configure_multicast(const Endpoint& endpoint);
     void receive_loop();
+    void drain_socket_event();
+    Result send_messages_gso(const std::vector<std::pair<MessagePtr, Endpoint>>& messages);
+    Result send_gso_packet(const std::vector<uint8_t>& data, uint16_t segment_size,
+                           const Endpoint& endpoint);
     Result send_data(const std::vector<uint8_t>& data, const Endpoint& endpoint);
     Result receive_data(std::vector<uint8_t>& data, Endpoint& sender);
     sockaddr_in create_sockaddr(const Endpoint& endpoint) const;
@@ -0,0 +1,217 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "common/lz4_codec.h"
+#include <cstring>
+
+namespace someip {
+namespace lz4 {
+
+namespace {
+
+constexpr size_t MIN_MATCH = 4;
+constexpr size_t LAST_LITERALS = 5;   // Block format: final bytes are literals
+constexpr size_t MFLIMIT = 12;        // No matches starting in the last 12 bytes
+constexpr size_t HASH_BITS = 13;
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, 4);
+    return value;
+}
+
+uint32_t hash32(uint32_t value) {
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+void write_length(std::vector<uint8_t>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+} // namespace
+
+std::vector<uint8_t> compress_block(const uint8_t* src, size_t size) {
+    std::vector<uint8_t> out;
+    out.reserve(size / 2 + 16);
+
+    if (size < MFLIMIT + MIN_MATCH) {
+        // Too small to match: one literals-only sequence
+        size_t literal_length = size;
+        uint8_t token = static_cast<uint8_t>(literal_length >= 15 ? 15 : literal_length) << 4;
+        out.push_back(token);
+        if (literal_length >= 15) {
+            write_length(out, literal_length - 15);
+        }
+        out.insert(out.end(), src, src + size);
+        return out;
+    }
+
+    uint32_t table[1u << HASH_BITS] = {0};  // Position + 1 (0 = empty)
+
+    size_t anchor = 0;
+    size_t position = 0;
+    size_t match_limit = size - MFLIMIT;
+
+    while (position < match_limit) {
+        uint32_t sequence = read32(src + position);
+        uint32_t hash = hash32(sequence);
+        size_t candidate = table[hash];
+        table[hash] = static_cast<uint32_t>(position + 1);
+
+        bool matched = candidate != 0 && (position - (candidate - 1)) <= 65535 &&
+                       read32(src + candidate - 1) == sequence;
+        if (!matched) {
+            ++position;
+            continue;
+        }
+
+        size_t match_start = candidate - 1;
+
+        // Extend the match forward, leaving the final literals alone
+        size_t match_length = MIN_MATCH;
+        size_t max_match = size - LAST_LITERALS - position;
+        while (match_length < max_match &&
+               src[match_start + match_length] == src[position + match_length]) {
+            ++match_length;
+        }
+
+        // Emit [literals][match]
+        size_t literal_length = position - anchor;
+        size_t ml_token = match_length - MIN_MATCH;
+        uint8_t token = static_cast<uint8_t>((literal_length >= 15 ? 15 : literal_length) << 4 |
+                                             (ml_token >= 15 ? 15 : ml_token));
+        out.push_back(token);
+        if (literal_length >= 15) {
+            write_length(out, literal_length - 15);
+        }
+        out.insert(out.end(), src + anchor, src + anchor + literal_length);
+
+        uint16_t offset = static_cast<uint16_t>(position - match_start);
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>(offset >> 8));
+        if (ml_token >= 15) {
+            write_length(out, ml_token - 15);
+        }
+
+        position += match_length;
+        anchor = position;
+    }
+
+    // Final literals-only sequence
+    size_t literal_length = size - anchor;
+    uint8_t token = static_cast<uint8_t>((literal_length >= 15 ? 15 : literal_length) << 4);
+    out.push_back(token);
+    if (literal_length >= 15) {
+        write_length(out, literal_length - 15);
+    }
+    out.insert(out.end(), src + anchor, src + size);
+
+    return out;
+}
+
+bool decompress_block(const uint8_t* src, size_t size, std::vector<uint8_t>& out,
+                      size_t original_size) {
+    out.clear();
+    out.reserve(original_size);
+
+    size_t position = 0;
+    while (position < size) {
+        uint8_t token = src[position++];
+
+        // Literals
+        size_t literal_length = token >> 4;
+        if (literal_length == 15) {
+            uint8_t extra;
+            do {
+                if (position >= size) return false;
+                extra = src[position++];
+                literal_length += extra;
+            } while (extra == 255);
+        }
+        if (position + literal_length > size) return false;
+        out.insert(out.end(), src + position, src + position + literal_length);
+        position += literal_length;
+
+        if (position >= size) {
+            break;  // Final sequence has no match part
+        }
+
+        // Match
+        if (position + 2 > size) return false;
+        uint16_t offset = static_cast<uint16_t>(src[position]) |
+                          (static_cast<uint16_t>(src[position + 1]) << 8);
+        position += 2;
+        if (offset == 0 || offset > out.size()) return false;
+
+        size_t match_length = (token & 0x0F);
+        if (match_length == 15) {
+            uint8_t extra;
+            do {
+                if (position >= size) return false;
+                extra = src[position++];
+                match_length += extra;
+            } while (extra == 255);
+        }
+        match_length += MIN_MATCH;
+
+        // Byte-by-byte: overlapping copies are part of the format
+        size_t copy_from = out.size() - offset;
+        for (size_t i = 0; i < match_length; ++i) {
+            out.push_back(out[copy_from + i]);
+        }
+    }
+
+    return out.size() == original_size;
+}
+
+bool compress_payload(const std::vector<uint8_t>& payload, std::vector<uint8_t>& out) {
+    std::vector<uint8_t> block = compress_block(payload.data(), payload.size());
+    if (block.empty() || PAYLOAD_HEADER_SIZE + block.size() >= payload.size()) {
+        return false;  // Not worth sending compressed
+    }
+
+    out.clear();
+    out.reserve(PAYLOAD_HEADER_SIZE + block.size());
+    out.insert(out.end(), PAYLOAD_MAGIC, PAYLOAD_MAGIC + 4);
+    uint32_t original = static_cast<uint32_t>(payload.size());
+    out.push_back(static_cast<uint8_t>(original & 0xFF));
+    out.push_back(static_cast<uint8_t>((original >> 8) & 0xFF));
+    out.push_back(static_cast<uint8_t>((original >> 16) & 0xFF));
+    out.push_back(static_cast<uint8_t>((original >> 24) & 0xFF));
+    out.insert(out.end(), block.begin(), block.end());
+    return true;
+}
+
+bool is_compressed_payload(const uint8_t* data, size_t size) {
+    return size >= PAYLOAD_HEADER_SIZE && std::memcmp(data, PAYLOAD_MAGIC, 4) == 0;
+}
+
+bool decompress_payload(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+    if (!is_compressed_payload(data, size)) {
+        return false;
+    }
+
+    uint32_t original = static_cast<uint32_t>(data[4]) |
+                        (static_cast<uint32_t>(data[5]) << 8) |
+                        (static_cast<uint32_t>(data[6]) << 16) |
+                        (static_cast<uint32_t>(data[7]) << 24);
+    return decompress_block(data + PAYLOAD_HEADER_SIZE, size - PAYLOAD_HEADER_SIZE,
+                            out, original);
+}
+
+} // namespace lz4
+} // namespace someip
@@ -18,6 +18,7 @@ std::string to_string(Result result) {
         {Result::INVALID_PROTOCOL_VERSION, "INVALID_PROTOCOL_VERSION"},
         {Result::INVALID_INTERFACE_VERSION, "INVALID_INTERFACE_VERSION"},
         {Result::MALFORMED_MESSAGE, "MALFORMED_MESSAGE"},
+        {Result::INSUFFICIENT_DATA, "INSUFFICIENT_DATA"},
         {Result::INVALID_SESSION_ID, "INVALID_SESSION_ID"},
         {Result::SESSION_EXPIRED, "SESSION_EXPIRED"},
         {Result::SESSION_NOT_FOUND, "SESSION_NOT_FOUND"},
@@ -0,0 +1,44 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "common/stats_counters.h"
+#include <algorithm>
+
+namespace someip {
+
+StatsCounter::StatsCounter(const char* name)
+    : name_(name) {
+    StatsRegistry::instance().register_counter(this);
+}
+
+StatsCounter::~StatsCounter() {
+    StatsRegistry::instance().unregister_counter(this);
+}
+
+StatsRegistry& StatsRegistry::instance() {
+    static StatsRegistry registry;
+    return registry;
+}
+
+void StatsRegistry::register_counter(StatsCounter* counter) {
+    std::scoped_lock lock(mutex_);
+    counters_.push_back(counter);
+}
+
+void StatsRegistry::unregister_counter(StatsCounter* counter) {
+    std::scoped_lock lock(mutex_);
+    counters_.erase(std::remove(counters_.begin(), counters_.end(), counter),
+                    counters_.end());
+}
+
+} // namespace someip
@@ -0,0 +1,211 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "common/timer_wheel.h"
+#include <algorithm>
+
+namespace someip {
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick)
+    : tick_(tick) {
+    wheels_.resize(LEVELS);
+    for (auto& wheel : wheels_) {
+        wheel.resize(SLOTS_PER_LEVEL);
+    }
+}
+
+TimerWheel::~TimerWheel() {
+    stop();
+}
+
+void TimerWheel::start() {
+    std::scoped_lock lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    worker_ = std::thread(&TimerWheel::tick_loop, this);
+}
+
+void TimerWheel::stop() {
+    {
+        std::scoped_lock lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(std::chrono::milliseconds delay, Callback callback,
+                                         std::chrono::milliseconds jitter) {
+    std::scoped_lock lock(mutex_);
+
+    Timer timer;
+    timer.id = next_id_++;
+    timer.period = std::chrono::milliseconds(0);
+    timer.jitter = jitter;
+    timer.callback = std::move(callback);
+    arm_locked(std::move(timer), delay);
+    return next_id_ - 1;
+}
+
+TimerWheel::TimerId TimerWheel::schedule_recurring(std::chrono::milliseconds period,
+                                                   Callback callback,
+                                                   std::chrono::milliseconds jitter) {
+    std::scoped_lock lock(mutex_);
+
+    Timer timer;
+    timer.id = next_id_++;
+    timer.period = period;
+    timer.jitter = jitter;
+    timer.callback = std::move(callback);
+    arm_locked(std::move(timer), period);
+    return next_id_ - 1;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    std::scoped_lock lock(mutex_);
+
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+        // Possibly firing right now: flag it so a recurring timer is
+        // not re-armed after its in-flight callback returns
+        if (firing_.count(id) != 0) {
+            cancelled_while_firing_.insert(id);
+            return true;
+        }
+        return false;
+    }
+
+    size_t level = it->second.first / SLOTS_PER_LEVEL;
+    size_t slot_index = it->second.first % SLOTS_PER_LEVEL;
+    wheels_[level][slot_index].erase(it->second.second);
+    index_.erase(it);
+    return true;
+}
+
+size_t TimerWheel::pending_count() const {
+    std::scoped_lock lock(mutex_);
+    return index_.size();
+}
+
+void TimerWheel::arm_locked(Timer timer, std::chrono::milliseconds delay) {
+    if (timer.jitter.count() > 0) {
+        auto draw = std::uniform_int_distribution<int64_t>(0, timer.jitter.count())(jitter_rng_);
+        delay += std::chrono::milliseconds(draw);
+    }
+
+    uint64_t delay_ticks = static_cast<uint64_t>(
+        std::max<int64_t>(1, (delay.count() + tick_.count() - 1) / tick_.count()));
+    timer.deadline_tick = current_tick_ + delay_ticks;
+    place_locked(std::move(timer));
+}
+
+void TimerWheel::place_locked(Timer timer) {
+    uint64_t remaining = timer.deadline_tick - current_tick_;
+
+    // Pick the level whose span covers the remaining ticks; the slot
+    // within it is the deadline's digit at that level
+    size_t level = 0;
+    uint64_t span = SLOTS_PER_LEVEL;
+    while (level + 1 < LEVELS && remaining >= span) {
+        ++level;
+        span *= SLOTS_PER_LEVEL;
+    }
+
+    uint64_t level_shift = 1;
+    for (size_t i = 0; i < level; ++i) {
+        level_shift *= SLOTS_PER_LEVEL;
+    }
+    size_t slot_index =
+        static_cast<size_t>((timer.deadline_tick / level_shift) % SLOTS_PER_LEVEL);
+
+    TimerId id = timer.id;
+    auto& slot = wheels_[level][slot_index];
+    slot.push_back(std::move(timer));
+    index_[id] = {level * SLOTS_PER_LEVEL + slot_index, std::prev(slot.end())};
+}
+
+void TimerWheel::cascade_locked(size_t level, size_t slot_index) {
+    Slot moved;
+    moved.splice(moved.begin(), wheels_[level][slot_index]);
+
+    for (auto& timer : moved) {
+        index_.erase(timer.id);
+        place_locked(std::move(timer));
+    }
+}
+
+void TimerWheel::tick_loop() {
+    std::unique_lock lock(mutex_);
+
+    while (running_) {
+        cv_.wait_for(lock, tick_);
+        if (!running_) {
+            break;
+        }
+
+        ++current_tick_;
+
+        // Cascade longer timers down when a higher level's digit turns
+        uint64_t shift = SLOTS_PER_LEVEL;
+        for (size_t level = 1; level < LEVELS && current_tick_ % shift == 0; ++level) {
+            cascade_locked(level,
+                           static_cast<size_t>((current_tick_ / shift) % SLOTS_PER_LEVEL));
+            shift *= SLOTS_PER_LEVEL;
+        }
+
+        // Fire everything due in the level-0 slot
+        Slot due;
+        auto& slot = wheels_[0][current_tick_ % SLOTS_PER_LEVEL];
+        for (auto it = slot.begin(); it != slot.end();) {
+            if (it->deadline_tick <= current_tick_) {
+                auto next = std::next(it);
+                due.splice(due.end(), slot, it);
+                it = next;
+            } else {
+                ++it;
+            }
+        }
+
+        for (auto& timer : due) {
+            index_.erase(timer.id);
+            firing_.insert(timer.id);
+        }
+
+        // Callbacks run without the lock so they may (re)schedule
+        lock.unlock();
+        for (auto& timer : due) {
+            if (timer.callback) {
+                timer.callback();
+            }
+        }
+        lock.lock();
+
+        // Re-arm recurrences that were not cancelled mid-flight
+        for (auto& timer : due) {
+            firing_.erase(timer.id);
+            bool cancelled = cancelled_while_firing_.erase(timer.id) != 0;
+            if (timer.period.count() > 0 && running_ && !cancelled) {
+                arm_locked(std::move(timer), timer.period);
+            }
+        }
+    }
+}
+
+} // namespace someip
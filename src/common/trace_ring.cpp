@@ -0,0 +1,67 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "common/trace_ring.h"
+#include <algorithm>
+
+namespace someip {
+
+std::mutex TraceRing::registry_mutex_;
+std::vector<std::shared_ptr<TraceRing::ThreadRing>> TraceRing::registry_;
+
+TraceRing::ThreadRing& TraceRing::local_ring() {
+    // The shared_ptr keeps the ring alive in the registry after the
+    // thread exits, so post-mortem dumps still see its records
+    static thread_local std::shared_ptr<ThreadRing> ring = [] {
+        auto created = std::make_shared<ThreadRing>();
+        std::scoped_lock lock(registry_mutex_);
+        registry_.push_back(created);
+        return created;
+    }();
+    return *ring;
+}
+
+std::vector<std::shared_ptr<TraceRing::ThreadRing>> TraceRing::all_rings() {
+    std::scoped_lock lock(registry_mutex_);
+    return registry_;
+}
+
+std::vector<TraceRecord> TraceRing::snapshot_span(uint32_t span_id) {
+    std::vector<TraceRecord> records;
+    dump([&](const TraceRecord& record) {
+        if (record.span_id == span_id) {
+            records.push_back(record);
+        }
+    });
+
+    std::sort(records.begin(), records.end(),
+              [](const TraceRecord& a, const TraceRecord& b) {
+                  return a.timestamp_ns < b.timestamp_ns;
+              });
+    return records;
+}
+
+const char* TraceRing::site_name(TraceSite site) {
+    switch (site) {
+        case TraceSite::RECEIVE: return "receive";
+        case TraceSite::QUEUE_PUSH: return "queue_push";
+        case TraceSite::QUEUE_POP: return "queue_pop";
+        case TraceSite::DESERIALIZE: return "deserialize";
+        case TraceSite::DISPATCH: return "dispatch";
+        case TraceSite::HANDLER_RETURN: return "handler_return";
+        case TraceSite::SEND: return "send";
+    }
+    return "unknown";
+}
+
+} // namespace someip
@@ -0,0 +1,239 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "core/event_loop.h"
+#include <unistd.h>
+#include <fcntl.h>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#else
+#include <poll.h>
+#endif
+
+namespace someip {
+
+EventLoop::EventLoop() = default;
+
+EventLoop::~EventLoop() {
+    stop();
+}
+
+void EventLoop::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+
+#if defined(__linux__)
+    wakeup_fds_[0] = eventfd(0, EFD_NONBLOCK);
+    epoll_fd_ = epoll_create1(0);
+    if (wakeup_fds_[0] >= 0 && epoll_fd_ >= 0) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = wakeup_fds_[0];
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fds_[0], &event);
+    }
+
+    // Register descriptors added before start()
+    {
+        std::scoped_lock lock(mutex_);
+        for (const auto& [fd, callback] : callbacks_) {
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = fd;
+            epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+        }
+    }
+#else
+    if (pipe(wakeup_fds_) == 0) {
+        fcntl(wakeup_fds_[0], F_SETFL, O_NONBLOCK);
+        fcntl(wakeup_fds_[1], F_SETFL, O_NONBLOCK);
+    }
+#endif
+
+    thread_ = std::thread(&EventLoop::loop, this);
+}
+
+void EventLoop::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    wake();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+
+#if defined(__linux__)
+    if (epoll_fd_ >= 0) {
+        close(epoll_fd_);
+        epoll_fd_ = -1;
+    }
+#endif
+    for (int& fd : wakeup_fds_) {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+}
+
+bool EventLoop::add_fd(int fd, FdCallback on_readable) {
+    {
+        std::scoped_lock lock(mutex_);
+        callbacks_[fd] = std::move(on_readable);
+    }
+
+#if defined(__linux__)
+    if (epoll_fd_ >= 0) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0) {
+            std::scoped_lock lock(mutex_);
+            callbacks_.erase(fd);
+            return false;
+        }
+    }
+#endif
+
+    wake();
+    return true;
+}
+
+void EventLoop::remove_fd(int fd) {
+    {
+        std::scoped_lock lock(mutex_);
+        callbacks_.erase(fd);
+    }
+
+#if defined(__linux__)
+    if (epoll_fd_ >= 0) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    }
+#endif
+
+    wake();
+}
+
+void EventLoop::post(Task task) {
+    {
+        std::scoped_lock lock(mutex_);
+        pending_tasks_.push_back(std::move(task));
+    }
+    wake();
+}
+
+size_t EventLoop::watched_fd_count() const {
+    std::scoped_lock lock(mutex_);
+    return callbacks_.size();
+}
+
+void EventLoop::wake() {
+#if defined(__linux__)
+    if (wakeup_fds_[0] >= 0) {
+        uint64_t value = 1;
+        ssize_t written = write(wakeup_fds_[0], &value, sizeof(value));
+        (void)written;
+    }
+#else
+    if (wakeup_fds_[1] >= 0) {
+        uint8_t byte = 0;
+        ssize_t written = write(wakeup_fds_[1], &byte, 1);
+        (void)written;
+    }
+#endif
+}
+
+void EventLoop::loop() {
+    while (running_) {
+        // Drain posted tasks first
+        std::vector<Task> tasks;
+        {
+            std::scoped_lock lock(mutex_);
+            tasks.swap(pending_tasks_);
+        }
+        for (auto& task : tasks) {
+            task();
+        }
+
+#if defined(__linux__)
+        epoll_event events[64];
+        int ready = epoll_wait(epoll_fd_, events, 64, 100);
+        if (ready < 0) {
+            continue;  // EINTR etc.
+        }
+
+        for (int i = 0; i < ready && running_; ++i) {
+            int fd = events[i].data.fd;
+            if (fd == wakeup_fds_[0]) {
+                uint64_t drain = 0;
+                while (read(wakeup_fds_[0], &drain, sizeof(drain)) > 0) {
+                }
+                continue;
+            }
+
+            FdCallback callback;
+            {
+                std::scoped_lock lock(mutex_);
+                auto it = callbacks_.find(fd);
+                if (it == callbacks_.end()) {
+                    continue;  // Removed while queued
+                }
+                callback = it->second;  // Copy so removal mid-call is safe
+            }
+            callback();
+        }
+#else
+        std::vector<pollfd> poll_fds;
+        poll_fds.push_back({wakeup_fds_[0], POLLIN, 0});
+        {
+            std::scoped_lock lock(mutex_);
+            for (const auto& [fd, callback] : callbacks_) {
+                poll_fds.push_back({fd, POLLIN, 0});
+            }
+        }
+
+        if (poll(poll_fds.data(), poll_fds.size(), 100) <= 0) {
+            continue;
+        }
+
+        for (const pollfd& entry : poll_fds) {
+            if (!running_ || (entry.revents & POLLIN) == 0) {
+                continue;
+            }
+            if (entry.fd == wakeup_fds_[0]) {
+                uint8_t drain[16];
+                while (read(wakeup_fds_[0], drain, sizeof(drain)) > 0) {
+                }
+                continue;
+            }
+
+            FdCallback callback;
+            {
+                std::scoped_lock lock(mutex_);
+                auto it = callbacks_.find(entry.fd);
+                if (it == callbacks_.end()) {
+                    continue;
+                }
+                callback = it->second;
+            }
+            callback();
+        }
+#endif
+    }
+}
+
+} // namespace someip
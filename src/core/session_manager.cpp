@@ -15,69 +15,106 @@
 
 namespace someip {
 
-SessionManager::SessionManager() = default;
+SessionManager::SessionManager()
+    : slots_(std::make_unique<SessionSlot[]>(SLOT_COUNT)) {
+}
 
 uint16_t SessionManager::create_session(uint16_t client_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    uint16_t session_id = get_next_session_id();
+    // Rotating CAS claim: with sessions sparse relative to 65536 slots
+    // this succeeds on the first probe in practice, and a removed
+    // session's slot is recyclable the moment it frees — the rotating
+    // counter is the free list
+    while (true) {
+        uint16_t candidate = next_session_id_.fetch_add(1, std::memory_order_relaxed);
+        if (candidate == 0) {
+            continue;  // SOME/IP session IDs should not be 0
+        }
 
-    auto session = std::make_shared<Session>(session_id, client_id);
-    sessions_[session_id] = session;
+        SessionSlot& slot = slots_[candidate];
+        uint8_t expected = static_cast<uint8_t>(SessionState::INACTIVE);
+        if (slot.state.compare_exchange_strong(expected,
+                                               static_cast<uint8_t>(SessionState::ACTIVE),
+                                               std::memory_order_acq_rel)) {
+            slot.client_id.store(client_id, std::memory_order_relaxed);
+            slot.last_activity_ns.store(now_ns(), std::memory_order_relaxed);
+            active_count_.fetch_add(1, std::memory_order_relaxed);
+            return candidate;
+        }
 
-    return session_id;
+        // Also reclaim EXPIRED slots in passing
+        expected = static_cast<uint8_t>(SessionState::EXPIRED);
+        if (slot.state.compare_exchange_strong(expected,
+                                               static_cast<uint8_t>(SessionState::ACTIVE),
+                                               std::memory_order_acq_rel)) {
+            slot.client_id.store(client_id, std::memory_order_relaxed);
+            slot.last_activity_ns.store(now_ns(), std::memory_order_relaxed);
+            active_count_.fetch_add(1, std::memory_order_relaxed);
+            return candidate;
+        }
+    }
 }
 
 std::shared_ptr<Session> SessionManager::get_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
+    const SessionSlot& slot = slots_[session_id];
 
-    auto it = sessions_.find(session_id);
-    if (it != sessions_.end()) {
-        return it->second;
+    auto state = static_cast<SessionState>(slot.state.load(std::memory_order_acquire));
+    if (state == SessionState::INACTIVE) {
+        return nullptr;
     }
 
-    return nullptr;
+    // Snapshot view; the slot array itself holds no heap objects
+    auto session = std::make_shared<Session>(session_id,
+                                             slot.client_id.load(std::memory_order_relaxed));
+    session->state = state;
+    session->last_activity =
+        std::chrono::steady_clock::time_point(std::chrono::nanoseconds(
+            slot.last_activity_ns.load(std::memory_order_relaxed)));
+    return session;
 }
 
 void SessionManager::remove_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    sessions_.erase(session_id);
+    SessionSlot& slot = slots_[session_id];
+    uint8_t previous = slot.state.exchange(static_cast<uint8_t>(SessionState::INACTIVE),
+                                           std::memory_order_acq_rel);
+    if (previous == static_cast<uint8_t>(SessionState::ACTIVE)) {
+        active_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
 }
 
 bool SessionManager::validate_session(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it == sessions_.end()) {
-        return false;
-    }
-
-    return it->second->state == SessionState::ACTIVE;
+    return slots_[session_id].state.load(std::memory_order_acquire) ==
+           static_cast<uint8_t>(SessionState::ACTIVE);
 }
 
 void SessionManager::update_session_activity(uint16_t session_id) {
-    std::scoped_lock lock(sessions_mutex_);
-
-    auto it = sessions_.find(session_id);
-    if (it != sessions_.end()) {
-        it->second->update_activity();
+    SessionSlot& slot = slots_[session_id];
+    if (slot.state.load(std::memory_order_acquire) ==
+        static_cast<uint8_t>(SessionState::ACTIVE)) {
+        slot.last_activity_ns.store(now_ns(), std::memory_order_relaxed);
     }
 }
 
 size_t SessionManager::cleanup_expired_sessions(std::chrono::seconds timeout) {
-    std::scoped_lock lock(sessions_mutex_);
+    int64_t deadline_ns =
+        now_ns() - std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
 
     size_t cleaned_count = 0;
-    auto it = sessions_.begin();
+    for (size_t i = 1; i < SLOT_COUNT; ++i) {
+        SessionSlot& slot = slots_[i];
+        if (slot.state.load(std::memory_order_acquire) !=
+            static_cast<uint8_t>(SessionState::ACTIVE)) {
+            continue;
+        }
+        if (slot.last_activity_ns.load(std::memory_order_relaxed) > deadline_ns) {
+            continue;
+        }
 
-    while (it != sessions_.end()) {
-        if (it->second->is_expired(timeout)) {
-            it->second->state = SessionState::EXPIRED;
-            it = sessions_.erase(it);
+        uint8_t expected = static_cast<uint8_t>(SessionState::ACTIVE);
+        if (slot.state.compare_exchange_strong(expected,
+                                               static_cast<uint8_t>(SessionState::EXPIRED),
+                                               std::memory_order_acq_rel)) {
+            active_count_.fetch_sub(1, std::memory_order_relaxed);
             cleaned_count++;
-        } else {
-            ++it;
         }
     }
 
@@ -85,37 +122,12 @@ size_t SessionManager::cleanup_expired_sessions(std::chrono::seconds timeout) {
 }
 
 uint16_t SessionManager::get_next_session_id() {
-    // Find the next available session ID for this client
-    // SOME/IP session IDs should not be 0
-    uint16_t candidate = next_session_id_;
-
-    // Simple linear search for available ID (could be optimized)
-    while (sessions_.find(candidate) != sessions_.end()) {
-        candidate++;
-        if (candidate == 0) { // Wrap around, skip 0
-            candidate = 1;
-        }
-    }
-
-    next_session_id_ = candidate + 1;
-    if (next_session_id_ == 0) {
-        next_session_id_ = 1;
-    }
-
-    return candidate;
+    uint16_t candidate = next_session_id_.load(std::memory_order_relaxed);
+    return candidate == 0 ? 1 : candidate;
 }
 
 size_t SessionManager::get_active_session_count() const {
-    std::scoped_lock lock(sessions_mutex_);
-
-    size_t count = 0;
-    for (const auto& pair : sessions_) {
-        if (pair.second->state == SessionState::ACTIVE) {
-            count++;
-        }
-    }
-
-    return count;
+    return active_count_.load(std::memory_order_relaxed);
 }
 
 } // namespace someip
@@ -13,10 +13,12 @@
 
 #include "events/event_publisher.h"
 #include "events/event_types.h"
+#include "common/latency_histogram.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
 #include "transport/transport.h"
 #include "someip/message.h"
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <mutex>
@@ -67,8 +69,9 @@ public:
         stop_publish_timer();
 
         // Clear all subscriptions and events
-        std::scoped_lock subs_lock(subscriptions_mutex_);
-        subscriptions_.clear();
+        update_subscriptions([](SubscriberTable& table) {
+            table.clear();
+        });
 
         std::scoped_lock events_lock(events_mutex_);
         registered_events_.clear();
@@ -109,78 +112,190 @@ public:
             return false;
         }
 
+        auto publish_start = std::chrono::steady_clock::now();
+
         std::scoped_lock events_lock(events_mutex_);
         auto event_it = registered_events_.find(event_id);
         if (event_it == registered_events_.end()) {
             return false;
         }
 
-        // Create event notification
-        EventNotification notification(service_id_, instance_id_, event_id);
-        notification.event_data = data;
-        notification.session_id = next_session_id_++;
+        // The notification is built once; the scatter-gather send path
+        // references its payload in place, so only the 16-byte header
+        // is re-emitted per destination
+        Message someip_message(MessageId(service_id_, event_id),
+                               RequestId(0, next_session_id_++),
+                               MessageType::NOTIFICATION, ReturnCode::E_OK);
+        someip_message.set_payload(data);
 
-        // Send to all subscribed clients for this event's eventgroup
-        std::scoped_lock subs_lock(subscriptions_mutex_);
+        auto snapshot = subscriber_snapshot();
         auto eventgroup_id = event_it->second.eventgroup_id;
 
-        auto sub_it = subscriptions_.find(eventgroup_id);
-        if (sub_it != subscriptions_.end()) {
-            for (const auto& client_info : sub_it->second) {
-                send_event_notification(notification, client_info.endpoint);
-            }
+        // Serialize exactly once; every destination reuses the bytes
+        serialized_notification_.clear();
+        someip_message.serialize_into(serialized_notification_);
+
+        // A populous group gets one multicast datagram instead of N
+        // unicasts; subscribers filter locally in that mode
+        if (const MulticastConfig* multicast = multicast_for(*snapshot, eventgroup_id)) {
+            Result result =
+                transport_->send_serialized(serialized_notification_, multicast->endpoint);
+            publish_latency_.record(std::chrono::steady_clock::now() - publish_start);
+            return result == Result::SUCCESS;
         }
 
+        // Send to each recipient this sample's payload selects; the
+        // snapshot makes the fan-out lock-free and each distinct
+        // filter predicate is evaluated once
+        for_each_recipient(*snapshot, eventgroup_id, event_id, data,
+                           [&](const ClientInfo& client_info) {
+                               Result result = transport_->send_serialized(
+                                   serialized_notification_, client_info.endpoint);
+                               if (result != Result::SUCCESS) {
+                                   // Log error or handle failure
+                               }
+                           });
+
+        publish_latency_.record(std::chrono::steady_clock::now() - publish_start);
         return true;
     }
 
+    bool publish_events(const std::vector<EventSample>& samples) {
+        if (!running_ || samples.empty()) {
+            return false;
+        }
+
+        auto publish_start = std::chrono::steady_clock::now();
+
+        // One lock acquisition and one subscriber walk for the whole
+        // tick's worth of samples; the subscriber table is a lock-free
+        // snapshot
+        std::scoped_lock events_lock(events_mutex_);
+        auto snapshot = subscriber_snapshot();
+
+        // Grouped by destination so the transport can coalesce
+        // same-endpoint runs into single sendmmsg/GSO submissions
+        std::map<transport::Endpoint, std::vector<MessagePtr>> per_endpoint;
+
+        for (const auto& sample : samples) {
+            auto event_it = registered_events_.find(sample.event_id);
+            if (event_it == registered_events_.end()) {
+                continue;  // Unregistered samples are skipped
+            }
+
+            auto eventgroup_id = event_it->second.eventgroup_id;
+            MessagePtr message;
+            auto make_message = [&]() {
+                if (!message) {
+                    message = std::make_shared<Message>(
+                        MessageId(service_id_, sample.event_id),
+                        RequestId(0, next_session_id_++),
+                        MessageType::NOTIFICATION, ReturnCode::E_OK);
+                    message->set_payload(sample.data);
+                }
+                return message;
+            };
+
+            if (const MulticastConfig* multicast = multicast_for(*snapshot, eventgroup_id)) {
+                per_endpoint[multicast->endpoint].push_back(make_message());
+                continue;
+            }
+
+            for_each_recipient(*snapshot, eventgroup_id, sample.event_id, sample.data,
+                               [&](const ClientInfo& client_info) {
+                                   per_endpoint[client_info.endpoint].push_back(make_message());
+                               });
+        }
+
+        bool all_sent = true;
+        std::vector<std::pair<MessagePtr, transport::Endpoint>> batch;
+        for (auto& [endpoint, messages] : per_endpoint) {
+            batch.clear();
+            batch.reserve(messages.size());
+            for (auto& message : messages) {
+                batch.emplace_back(std::move(message), endpoint);
+            }
+            if (transport_->send_messages(batch) != Result::SUCCESS) {
+                all_sent = false;
+            }
+        }
+
+        publish_latency_.record(std::chrono::steady_clock::now() - publish_start);
+        return all_sent;
+    }
+
     bool publish_field(uint16_t event_id, const std::vector<uint8_t>& data) {
         // Fields are published immediately like events
         return publish_event(event_id, data);
     }
 
+    bool set_eventgroup_multicast(uint16_t eventgroup_id, const std::string& multicast_address,
+                                  uint16_t port, size_t subscriber_threshold,
+                                  const std::string& interface_address) {
+        transport::Endpoint endpoint(multicast_address, port,
+                                     transport::TransportProtocol::MULTICAST_UDP);
+        if (!endpoint.is_valid()) {
+            return false;
+        }
+
+        if (!interface_address.empty() &&
+            transport_->set_multicast_interface(interface_address) != Result::SUCCESS) {
+            return false;
+        }
+
+        update_snapshot([&](Snapshot& snapshot) {
+            snapshot.multicast[eventgroup_id] = MulticastConfig{endpoint, subscriber_threshold};
+        });
+
+        return true;
+    }
+
     bool handle_subscription(uint16_t eventgroup_id, uint16_t client_id,
                            const std::vector<EventFilter>& filters) {
 
-        std::scoped_lock subs_lock(subscriptions_mutex_);
-
         // Create client info (simplified - using localhost for demo)
         ClientInfo client_info;
         client_info.client_id = client_id;
         client_info.endpoint = transport::Endpoint("127.0.0.1", 30500);  // TODO: Get from SD
         client_info.filters = filters;
 
-        auto& clients = subscriptions_[eventgroup_id];
-        auto it = std::find_if(clients.begin(), clients.end(),
-            [client_id](const ClientInfo& info) {
-                return info.client_id == client_id;
-            });
+        update_subscriptions([&](SubscriberTable& table) {
+            auto& clients = table[eventgroup_id];
+            auto it = std::find_if(clients.begin(), clients.end(),
+                [client_id](const ClientInfo& info) {
+                    return info.client_id == client_id;
+                });
 
-        if (it == clients.end()) {
-            clients.push_back(client_info);
-        } else {
-            *it = client_info;  // Update existing
-        }
+            if (it == clients.end()) {
+                clients.push_back(client_info);
+            } else {
+                *it = client_info;  // Update existing
+            }
+        });
 
         return true;
     }
 
     bool handle_unsubscription(uint16_t eventgroup_id, uint16_t client_id) {
-        std::scoped_lock subs_lock(subscriptions_mutex_);
+        bool found = false;
 
-        auto sub_it = subscriptions_.find(eventgroup_id);
-        if (sub_it == subscriptions_.end()) {
-            return false;
-        }
+        update_subscriptions([&](SubscriberTable& table) {
+            auto sub_it = table.find(eventgroup_id);
+            if (sub_it == table.end()) {
+                return;
+            }
+            found = true;
 
-        auto& clients = sub_it->second;
-        auto it = std::remove_if(clients.begin(), clients.end(),
-            [client_id](const ClientInfo& info) {
-                return info.client_id == client_id;
-            });
+            auto& clients = sub_it->second;
+            auto it = std::remove_if(clients.begin(), clients.end(),
+                [client_id](const ClientInfo& info) {
+                    return info.client_id == client_id;
+                });
 
-        clients.erase(it, clients.end());
-        return true;
+            clients.erase(it, clients.end());
+        });
+
+        return found;
     }
 
     std::vector<uint16_t> get_registered_events() const {
@@ -195,10 +310,10 @@ public:
     }
 
     std::vector<uint16_t> get_subscriptions(uint16_t eventgroup_id) const {
-        std::scoped_lock subs_lock(subscriptions_mutex_);
+        auto snapshot = subscriber_snapshot();
 
-        auto it = subscriptions_.find(eventgroup_id);
-        if (it == subscriptions_.end()) {
+        auto it = snapshot->table.find(eventgroup_id);
+        if (it == snapshot->table.end()) {
             return {};
         }
 
@@ -215,8 +330,24 @@ public:
     }
 
     EventPublisher::Statistics get_statistics() const {
-        // TODO: Implement statistics tracking
-        return EventPublisher::Statistics{};
+        EventPublisher::Statistics stats;
+        stats.publish_time = publish_latency_.snapshot();
+        stats.average_publish_time =
+            std::chrono::milliseconds(stats.publish_time.mean_us / 1000);
+
+        {
+            std::scoped_lock events_lock(events_mutex_);
+            stats.events_registered = static_cast<uint32_t>(registered_events_.size());
+        }
+
+        auto snapshot = subscriber_snapshot();
+        size_t active = 0;
+        for (const auto& [eventgroup_id, clients] : snapshot->table) {
+            active += clients.size();
+        }
+        stats.subscriptions_active = static_cast<uint32_t>(active);
+
+        return stats;
     }
 
 private:
@@ -226,6 +357,163 @@ private:
         std::vector<EventFilter> filters;
     };
 
+    using SubscriberTable = std::unordered_map<uint16_t, std::vector<ClientInfo>>;
+
+    // One distinct filter predicate, pre-decoded at subscription time
+    // and shared by every client that registered it
+    struct CompiledPredicate {
+        std::vector<uint8_t> prefix;
+        std::vector<size_t> clients;  // Indices into the group's client vector
+    };
+
+    // Per-event compiled filter state for one eventgroup
+    struct EventFilterIndex {
+        std::vector<CompiledPredicate> predicates;  // Deduped; each evaluated once per sample
+        std::vector<char> has_filter;               // Client index -> constrained for this event
+    };
+
+    struct GroupIndex {
+        std::unordered_map<uint16_t, EventFilterIndex> by_event;
+    };
+
+    // Multicast switch-over point for one eventgroup
+    struct MulticastConfig {
+        transport::Endpoint endpoint;
+        size_t subscriber_threshold{0};
+    };
+
+    // Copy-on-write snapshot: the subscriber table, the filter index
+    // compiled from it, and per-group multicast configuration.
+    // Publishes read it with no locking; the rare subscription changes
+    // copy, mutate, recompile and swap.
+    struct Snapshot {
+        SubscriberTable table;
+        std::unordered_map<uint16_t, GroupIndex> group_indexes;
+        std::unordered_map<uint16_t, MulticastConfig> multicast;
+    };
+
+    std::shared_ptr<const Snapshot> subscriber_snapshot() const {
+        return std::atomic_load(&subscriptions_);
+    }
+
+    // Serialized by subscriptions_mutex_; readers are unaffected
+    template <typename MutateFn>
+    void update_snapshot(MutateFn&& mutate) {
+        std::scoped_lock subs_lock(subscriptions_mutex_);
+        auto next = std::make_shared<Snapshot>(*std::atomic_load(&subscriptions_));
+        mutate(*next);
+        rebuild_filter_indexes(*next);
+        std::atomic_store(&subscriptions_,
+                          std::shared_ptr<const Snapshot>(std::move(next)));
+    }
+
+    template <typename MutateFn>
+    void update_subscriptions(MutateFn&& mutate) {
+        update_snapshot([&](Snapshot& snapshot) { mutate(snapshot.table); });
+    }
+
+    // Multicast takes over when configured and the group is populous
+    // enough; returns nullptr for the unicast path
+    static const MulticastConfig* multicast_for(const Snapshot& snapshot,
+                                                uint16_t eventgroup_id) {
+        auto mc_it = snapshot.multicast.find(eventgroup_id);
+        if (mc_it == snapshot.multicast.end()) {
+            return nullptr;
+        }
+
+        auto table_it = snapshot.table.find(eventgroup_id);
+        size_t subscriber_count =
+            table_it == snapshot.table.end() ? 0 : table_it->second.size();
+        if (subscriber_count < mc_it->second.subscriber_threshold) {
+            return nullptr;
+        }
+
+        return &mc_it->second;
+    }
+
+    // Group subscribers by distinct predicate so publish cost scales
+    // with distinct filters, not total subscribers
+    static void rebuild_filter_indexes(Snapshot& snapshot) {
+        snapshot.group_indexes.clear();
+
+        for (const auto& [eventgroup_id, clients] : snapshot.table) {
+            GroupIndex group_index;
+
+            for (size_t client_index = 0; client_index < clients.size(); ++client_index) {
+                for (const EventFilter& filter : clients[client_index].filters) {
+                    EventFilterIndex& event_index = group_index.by_event[filter.event_id];
+                    if (event_index.has_filter.empty()) {
+                        event_index.has_filter.assign(clients.size(), 0);
+                    }
+                    event_index.has_filter[client_index] = 1;
+
+                    auto predicate_it = std::find_if(
+                        event_index.predicates.begin(), event_index.predicates.end(),
+                        [&filter](const CompiledPredicate& predicate) {
+                            return predicate.prefix == filter.filter_data;
+                        });
+                    if (predicate_it == event_index.predicates.end()) {
+                        event_index.predicates.push_back({filter.filter_data, {client_index}});
+                    } else {
+                        predicate_it->clients.push_back(client_index);
+                    }
+                }
+            }
+
+            if (!group_index.by_event.empty()) {
+                snapshot.group_indexes[eventgroup_id] = std::move(group_index);
+            }
+        }
+    }
+
+    // Invoke fn for every client of the group that should receive this
+    // sample, evaluating each distinct predicate exactly once
+    template <typename Fn>
+    static void for_each_recipient(const Snapshot& snapshot, uint16_t eventgroup_id,
+                                   uint16_t event_id, const std::vector<uint8_t>& payload,
+                                   Fn&& fn) {
+        auto table_it = snapshot.table.find(eventgroup_id);
+        if (table_it == snapshot.table.end()) {
+            return;
+        }
+        const std::vector<ClientInfo>& clients = table_it->second;
+
+        const EventFilterIndex* event_index = nullptr;
+        auto group_it = snapshot.group_indexes.find(eventgroup_id);
+        if (group_it != snapshot.group_indexes.end()) {
+            auto event_it = group_it->second.by_event.find(event_id);
+            if (event_it != group_it->second.by_event.end()) {
+                event_index = &event_it->second;
+            }
+        }
+
+        if (!event_index) {
+            // Nobody filters this event: plain fan-out
+            for (const ClientInfo& client : clients) {
+                fn(client);
+            }
+            return;
+        }
+
+        std::vector<char> matched(clients.size(), 0);
+        for (const CompiledPredicate& predicate : event_index->predicates) {
+            bool match = payload.size() >= predicate.prefix.size() &&
+                         std::equal(predicate.prefix.begin(), predicate.prefix.end(),
+                                    payload.begin());
+            if (match) {
+                for (size_t client_index : predicate.clients) {
+                    matched[client_index] = 1;
+                }
+            }
+        }
+
+        for (size_t client_index = 0; client_index < clients.size(); ++client_index) {
+            if (!event_index->has_filter[client_index] || matched[client_index]) {
+                fn(clients[client_index]);
+            }
+        }
+    }
+
     void start_publish_timer() {
         if (publish_timer_thread_.joinable()) {
             return;
@@ -273,21 +561,6 @@ private:
         }
     }
 
-    void send_event_notification(const EventNotification& notification,
-                               const transport::Endpoint& client_endpoint) {
-
-        // Create SOME/IP message for event notification
-        MessageId msg_id(service_id_, notification.event_id);
-        Message someip_message(msg_id, RequestId(notification.client_id, notification.session_id),
-                              MessageType::NOTIFICATION, ReturnCode::E_OK);
-        someip_message.set_payload(notification.event_data);
-
-        Result result = transport_->send_message(someip_message, client_endpoint);
-        if (result != Result::SUCCESS) {
-            // Log error or handle failure
-        }
-    }
-
     void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
         // Handle subscription/unsubscription messages
         // This would typically come from SD or direct subscription messages
@@ -295,16 +568,16 @@ private:
 
     void on_connection_lost(const transport::Endpoint& endpoint) override {
         // Handle client disconnection
-        std::scoped_lock subs_lock(subscriptions_mutex_);
-
-        for (auto& sub_pair : subscriptions_) {
-            auto& clients = sub_pair.second;
-            auto it = std::remove_if(clients.begin(), clients.end(),
-                [&endpoint](const ClientInfo& info) {
-                    return info.endpoint == endpoint;
-                });
-            clients.erase(it, clients.end());
-        }
+        update_subscriptions([&](SubscriberTable& table) {
+            for (auto& sub_pair : table) {
+                auto& clients = sub_pair.second;
+                auto it = std::remove_if(clients.begin(), clients.end(),
+                    [&endpoint](const ClientInfo& info) {
+                        return info.endpoint == endpoint;
+                    });
+                clients.erase(it, clients.end());
+            }
+        });
     }
 
     void on_connection_established(const transport::Endpoint& endpoint) override {
@@ -322,13 +595,15 @@ private:
     std::unordered_map<uint16_t, EventConfig> registered_events_;
     mutable std::mutex events_mutex_;
 
-    std::unordered_map<uint16_t, std::vector<ClientInfo>> subscriptions_;
-    mutable std::mutex subscriptions_mutex_;
+    std::shared_ptr<const Snapshot> subscriptions_{std::make_shared<Snapshot>()};
+    mutable std::mutex subscriptions_mutex_;  // Serializes writers only
 
     std::unordered_map<uint16_t, std::chrono::steady_clock::time_point> last_publish_times_;
     std::thread publish_timer_thread_;
     std::atomic<uint16_t> next_session_id_;
     std::atomic<bool> running_;
+    LatencyHistogram publish_latency_;
+    std::vector<uint8_t> serialized_notification_;  // Reused; guarded by events_mutex_
 };
 
 // EventPublisher implementation
@@ -362,10 +637,22 @@ bool EventPublisher::publish_event(uint16_t event_id, const std::vector<uint8_t>
     return impl_->publish_event(event_id, data);
 }
 
+bool EventPublisher::publish_events(const std::vector<EventSample>& samples) {
+    return impl_->publish_events(samples);
+}
+
 bool EventPublisher::publish_field(uint16_t event_id, const std::vector<uint8_t>& data) {
     return impl_->publish_field(event_id, data);
 }
 
+bool EventPublisher::set_eventgroup_multicast(uint16_t eventgroup_id,
+                                              const std::string& multicast_address,
+                                              uint16_t port, size_t subscriber_threshold,
+                                              const std::string& interface_address) {
+    return impl_->set_eventgroup_multicast(eventgroup_id, multicast_address, port,
+                                           subscriber_threshold, interface_address);
+}
+
 bool EventPublisher::handle_subscription(uint16_t eventgroup_id, uint16_t client_id,
                                        const std::vector<EventFilter>& filters) {
     return impl_->handle_subscription(eventgroup_id, client_id, filters);
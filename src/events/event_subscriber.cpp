@@ -17,6 +17,11 @@
 #include "transport/endpoint.h"
 #include "transport/transport.h"
 #include "someip/message.h"
+#include "common/latency_histogram.h"
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
@@ -29,8 +34,10 @@ class EventSubscriberImpl : public transport::ITransportListener {
 public:
     EventSubscriberImpl(uint16_t client_id)
         : client_id_(client_id),
+          // Bind the demo notification port the publisher targets
+          // (endpoint exchange via SD is still TODO upstream)
           transport_(std::make_shared<transport::UdpTransport>(
-              transport::Endpoint("127.0.0.1", 0))),
+              transport::Endpoint("127.0.0.1", 30500))),
           running_(false) {
 
         transport_->set_listener(this);
@@ -60,6 +67,15 @@ public:
 
         running_ = false;
 
+        executor_running_ = false;
+        delivery_cv_.notify_all();
+        for (auto& worker : delivery_workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        delivery_workers_.clear();
+
         // Clear all subscriptions and callbacks
         std::scoped_lock subs_lock(subscriptions_mutex_);
         subscriptions_.clear();
@@ -223,9 +239,79 @@ public:
         return running_ && transport_->is_connected();
     }
 
+    void enable_async_delivery(size_t worker_count, size_t queue_depth, bool coalesce) {
+        std::scoped_lock lock(delivery_mutex_);
+        if (executor_enabled_) {
+            return;
+        }
+        delivery_depth_ = queue_depth;
+        coalesce_to_latest_ = coalesce;
+        executor_enabled_ = true;
+        executor_running_ = true;
+        for (size_t i = 0; i < std::max<size_t>(1, worker_count); ++i) {
+            delivery_workers_.emplace_back(&EventSubscriberImpl::delivery_loop, this);
+        }
+    }
+
+    void enqueue_delivery(const EventNotificationCallback& callback,
+                          const EventNotification& notification) {
+        {
+            std::scoped_lock lock(delivery_mutex_);
+
+            if (coalesce_to_latest_) {
+                // Value semantics: the newest sample of an event wins
+                for (auto& pending : delivery_queue_) {
+                    if (pending.notification.event_id == notification.event_id &&
+                        pending.notification.service_id == notification.service_id) {
+                        pending.notification = notification;
+                        delivery_cv_.notify_one();
+                        return;
+                    }
+                }
+            }
+
+            if (delivery_queue_.size() >= delivery_depth_) {
+                delivery_queue_.pop_front();  // Drop-oldest, observable
+                notifications_dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+            delivery_queue_.push_back({callback, notification});
+        }
+        delivery_cv_.notify_one();
+    }
+
+    void delivery_loop() {
+        std::unique_lock lock(delivery_mutex_);
+        while (executor_running_) {
+            if (delivery_queue_.empty()) {
+                delivery_cv_.wait_for(lock, std::chrono::milliseconds(50));
+                continue;
+            }
+
+            // Batch drain: one wakeup delivers everything queued
+            std::deque<PendingDelivery> batch;
+            batch.swap(delivery_queue_);
+            lock.unlock();
+
+            for (auto& pending : batch) {
+                auto dispatch_start = std::chrono::steady_clock::now();
+                pending.callback(pending.notification);
+                dispatch_latency_.record(std::chrono::steady_clock::now() - dispatch_start);
+            }
+            lock.lock();
+        }
+    }
+
     EventSubscriber::Statistics get_statistics() const {
-        // TODO: Implement statistics tracking
-        return EventSubscriber::Statistics{};
+        EventSubscriber::Statistics stats;
+        stats.notification_dispatch_time = dispatch_latency_.snapshot();
+        stats.average_response_time =
+            std::chrono::milliseconds(stats.notification_dispatch_time.mean_us / 1000);
+
+        stats.notifications_dropped = notifications_dropped_.load(std::memory_order_relaxed);
+
+        std::scoped_lock subs_lock(subscriptions_mutex_);
+        stats.subscriptions_active = static_cast<uint32_t>(subscriptions_.size());
+        return stats;
     }
 
 private:
@@ -266,9 +352,18 @@ private:
                 notification.session_id = message->get_session_id();
                 notification.event_data = message->get_payload();
 
-                // Call notification callback
+                // Call notification callback, timing the dispatch; with
+                // the executor enabled the callback leaves the receive
+                // path immediately
                 if (sub_info.notification_callback) {
-                    sub_info.notification_callback(notification);
+                    if (executor_enabled_) {
+                        enqueue_delivery(sub_info.notification_callback, notification);
+                    } else {
+                        auto dispatch_start = std::chrono::steady_clock::now();
+                        sub_info.notification_callback(notification);
+                        dispatch_latency_.record(std::chrono::steady_clock::now() -
+                                                 dispatch_start);
+                    }
                 }
 
                 // Update subscription state
@@ -322,6 +417,22 @@ private:
 
     std::unordered_map<std::string, SubscriptionInfo> subscriptions_;
     mutable std::mutex subscriptions_mutex_;
+    LatencyHistogram dispatch_latency_;
+
+    // Notification delivery executor
+    struct PendingDelivery {
+        EventNotificationCallback callback;
+        EventNotification notification;
+    };
+    bool executor_enabled_{false};
+    std::atomic<bool> executor_running_{false};
+    std::mutex delivery_mutex_;
+    std::condition_variable delivery_cv_;
+    std::deque<PendingDelivery> delivery_queue_;
+    std::vector<std::thread> delivery_workers_;
+    size_t delivery_depth_{256};
+    bool coalesce_to_latest_{false};
+    std::atomic<uint32_t> notifications_dropped_{0};
 
     std::unordered_map<std::string, EventNotificationCallback> field_requests_;
     mutable std::mutex field_requests_mutex_;
@@ -361,6 +472,11 @@ bool EventSubscriber::request_field(uint16_t service_id, uint16_t instance_id, u
     return impl_->request_field(service_id, instance_id, event_id, callback);
 }
 
+void EventSubscriber::enable_async_delivery(size_t worker_count, size_t queue_depth,
+                                            bool coalesce_to_latest) {
+    impl_->enable_async_delivery(worker_count, queue_depth, coalesce_to_latest);
+}
+
 bool EventSubscriber::set_event_filters(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id,
                                       const std::vector<EventFilter>& filters) {
     return impl_->set_event_filters(service_id, instance_id, eventgroup_id, filters);
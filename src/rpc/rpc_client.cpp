@@ -18,6 +18,7 @@
 #include "transport/transport.h"
 #include "someip/message.h"
 #include "core/session_manager.h"
+#include "common/latency_histogram.h"
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
@@ -31,13 +32,21 @@ namespace rpc {
 
 class RpcClientImpl : public transport::ITransportListener {
 public:
-    RpcClientImpl(uint16_t client_id)
+    RpcClientImpl(uint16_t client_id, size_t max_outstanding_calls)
         : client_id_(client_id),
           session_manager_(std::make_unique<SessionManager>()),
           transport_(std::make_shared<transport::UdpTransport>(transport::Endpoint("127.0.0.1", 0))),
-          next_call_handle_(1),
           running_(false) {
 
+        // Slot count rounded to a power of two so session ids index
+        // directly; this bounds the calls that can be in flight
+        size_t slots = 1;
+        while (slots < max_outstanding_calls) {
+            slots <<= 1;
+        }
+        call_slots_ = std::make_unique<CallSlot[]>(slots);
+        slot_mask_ = slots - 1;
+
         transport_->set_listener(this);
     }
 
@@ -55,44 +64,104 @@ public:
         }
 
         running_ = true;
+
+        // Expiry sweep: async calls whose response never arrives are
+        // completed with TIMEOUT instead of leaking their slot
+        timeout_sweeper_ = std::thread(&RpcClientImpl::timeout_sweep_loop, this);
+
         return true;
     }
 
+    void timeout_sweep_loop() {
+        while (running_) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            auto now = std::chrono::steady_clock::now();
+
+            for (size_t i = 0; i <= slot_mask_ && running_; ++i) {
+                CallSlot& slot = call_slots_[i];
+                if (slot.state.load(std::memory_order_acquire) != SLOT_ACTIVE) {
+                    continue;
+                }
+                if (now < slot.deadline) {
+                    continue;
+                }
+
+                uint8_t expected = SLOT_ACTIVE;
+                if (!slot.state.compare_exchange_strong(expected, SLOT_COMPLETING,
+                                                        std::memory_order_acq_rel)) {
+                    continue;  // Response or cancel won the race
+                }
+                if (now < slot.deadline) {  // Re-check under ownership
+                    slot.state.store(SLOT_ACTIVE, std::memory_order_release);
+                    continue;
+                }
+
+                RpcCallback callback = std::move(slot.callback);
+                RpcResponse response(slot.service_id, slot.method_id,
+                                     client_id_, slot.session_id, RpcResult::TIMEOUT);
+                slot.state.store(SLOT_EMPTY, std::memory_order_release);
+
+                if (callback) {
+                    callback(response);
+                }
+            }
+        }
+    }
+
     void shutdown() {
         if (!running_) {
             return;
         }
 
         running_ = false;
+        if (timeout_sweeper_.joinable()) {
+            timeout_sweeper_.join();
+        }
+        disable_request_batching();
 
         // Cancel all pending calls
-        {
-            std::scoped_lock lock(pending_calls_mutex_);
-            for (auto& pair : pending_calls_) {
-                if (pair.second.callback) {
-                    RpcResponse response(pair.second.service_id, pair.second.method_id,
-                                       client_id_, pair.second.session_id, RpcResult::INTERNAL_ERROR);
-                    pair.second.callback(response);
-                }
+        for (size_t i = 0; i <= slot_mask_; ++i) {
+            CallSlot& slot = call_slots_[i];
+            uint8_t expected = SLOT_ACTIVE;
+            if (!slot.state.compare_exchange_strong(expected, SLOT_COMPLETING,
+                                                    std::memory_order_acq_rel)) {
+                continue;
+            }
+
+            RpcCallback callback = std::move(slot.callback);
+            RpcResponse response(slot.service_id, slot.method_id,
+                               client_id_, slot.session_id, RpcResult::INTERNAL_ERROR);
+            slot.state.store(SLOT_EMPTY, std::memory_order_release);
+
+            if (callback) {
+                callback(response);
             }
-            pending_calls_.clear();
         }
 
         transport_->stop();
     }
 
     RpcSyncResult call_method_sync(uint16_t service_id, MethodId method_id,
-                                   const std::vector<uint8_t>& parameters,
+                                   std::vector<uint8_t> parameters,
                                    const RpcTimeout& timeout) {
 
-        // Create promise/future for synchronization
-        std::promise<RpcResponse> promise;
-        auto future = promise.get_future();
+        // Create promise/future for synchronization. The promise is
+        // shared and captured by value: a response, the timeout
+        // sweeper, or cancel_call may each invoke the callback after a
+        // lost CAS race, possibly after this frame has returned — the
+        // shared ownership keeps the promise alive for whichever
+        // thread completes it (set_value on an already-satisfied
+        // promise throws, hence the guard flag).
+        auto promise = std::make_shared<std::promise<RpcResponse>>();
+        auto satisfied = std::make_shared<std::atomic<bool>>(false);
+        auto future = promise->get_future();
 
         // Make async call with callback that sets the promise
-        auto handle = call_method_async(service_id, method_id, parameters,
-            [&promise](const RpcResponse& response) {
-                promise.set_value(response);
+        auto handle = call_method_async(service_id, method_id, std::move(parameters),
+            [promise, satisfied](const RpcResponse& response) {
+                if (!satisfied->exchange(true)) {
+                    promise->set_value(response);
+                }
             }, timeout);
 
         if (handle == 0) {
@@ -113,7 +182,7 @@ public:
     }
 
     RpcCallHandle call_method_async(uint16_t service_id, MethodId method_id,
-                                    const std::vector<uint8_t>& parameters,
+                                    std::vector<uint8_t> parameters,
                                     RpcCallback callback,
                                     const RpcTimeout& timeout) {
 
@@ -121,74 +190,204 @@ public:
             return 0;
         }
 
-        // Create session for this call
-        uint16_t session_id = session_manager_->create_session(client_id_);
+        // Claim a table slot lock-free: sequential session ids index
+        // distinct slots, so a CAS failure means that slot's previous
+        // call (one full table-size of sessions ago) is still in
+        // flight — retry with a fresh session until the attempt budget
+        // (effectively "table full") runs out
+        uint16_t session_id = 0;
+        size_t slot_index = 0;
+        bool claimed = false;
+        for (int attempt = 0; attempt < 8 && !claimed; ++attempt) {
+            session_id = session_manager_->create_session(client_id_);
+            slot_index = session_id & slot_mask_;
+            uint8_t expected = SLOT_EMPTY;
+            claimed = call_slots_[slot_index].state.compare_exchange_strong(
+                expected, SLOT_CLAIMING, std::memory_order_acquire);
+        }
+        if (!claimed) {
+            return 0;  // Max outstanding calls reached
+        }
+
+        CallSlot& slot = call_slots_[slot_index];
+        slot.service_id = service_id;
+        slot.method_id = method_id;
+        slot.session_id = session_id;
+        slot.start_time = std::chrono::steady_clock::now();
+        slot.deadline = slot.start_time + timeout.response_timeout;
+        slot.callback = std::move(callback);
+        uint16_t generation =
+            static_cast<uint16_t>(slot.generation.fetch_add(1, std::memory_order_relaxed) + 1);
+
+        RpcCallHandle handle = (static_cast<RpcCallHandle>(generation) << 16) |
+                               static_cast<RpcCallHandle>(slot_index);
+
+        slot.state.store(SLOT_ACTIVE, std::memory_order_release);
 
         // Create request message
         MessageId msg_id(service_id, method_id);
         RequestId req_id(client_id_, session_id);
         Message request(msg_id, req_id, MessageType::REQUEST, ReturnCode::E_OK);
-        request.set_payload(parameters);
+        request.set_payload(std::move(parameters));  // Buffer lent, not copied
 
-        // Create pending call record
-        PendingCall call_info{
-            service_id, method_id, session_id,
-            std::chrono::steady_clock::now(),
-            timeout, callback
-        };
+        // Send request
+        transport::Endpoint server_endpoint("127.0.0.1", 30490); // TODO: Make configurable
 
-        RpcCallHandle handle;
-        {
-            std::scoped_lock lock(pending_calls_mutex_);
-            handle = next_call_handle_++;
-            pending_calls_[handle] = std::move(call_info);
+        if (batching_enabled_.load(std::memory_order_relaxed)) {
+            // Pack into the shared batch; the flusher (or a size
+            // trigger or explicit flush) sends the whole datagram
+            std::vector<uint8_t> bytes = request.serialize();
+            {
+                std::scoped_lock lock(batch_mutex_);
+                if (!batch_buffer_.empty() &&
+                    batch_buffer_.size() + bytes.size() > max_batch_bytes_) {
+                    flush_locked();
+                }
+                batch_buffer_.insert(batch_buffer_.end(), bytes.begin(), bytes.end());
+                if (batch_buffer_.size() >= max_batch_bytes_) {
+                    flush_locked();
+                }
+            }
+            batch_cv_.notify_one();
+            return handle;
         }
 
-        // Send request
-        transport::Endpoint server_endpoint("127.0.0.1", 30490); // TODO: Make configurable
         if (transport_->send_message(request, server_endpoint) != Result::SUCCESS) {
-            std::scoped_lock lock(pending_calls_mutex_);
-            pending_calls_.erase(handle);
+            // Reclaim the slot. A stale response may transiently hold
+            // it in COMPLETING (it will bounce back to ACTIVE on the
+            // session mismatch), so spin rather than leak the slot.
+            while (true) {
+                uint8_t expected = SLOT_ACTIVE;
+                if (slot.state.compare_exchange_strong(expected, SLOT_COMPLETING,
+                                                       std::memory_order_acq_rel)) {
+                    slot.callback = nullptr;
+                    slot.state.store(SLOT_EMPTY, std::memory_order_release);
+                    break;
+                }
+                if (expected == SLOT_EMPTY) {
+                    break;  // Freed by shutdown
+                }
+                std::this_thread::yield();
+            }
             return 0;
         }
 
         return handle;
     }
 
+    void enable_request_batching(size_t max_batch_bytes, std::chrono::milliseconds flush_window) {
+        std::scoped_lock lock(batch_mutex_);
+        if (batching_enabled_) {
+            return;
+        }
+        max_batch_bytes_ = max_batch_bytes;
+        flush_window_ = flush_window;
+        batch_buffer_.reserve(max_batch_bytes);
+        batching_enabled_ = true;
+        batch_flusher_ = std::thread(&RpcClientImpl::flusher_loop, this);
+    }
+
+    void disable_request_batching() {
+        {
+            std::scoped_lock lock(batch_mutex_);
+            if (!batching_enabled_) {
+                return;
+            }
+            batching_enabled_ = false;
+            flush_locked();
+        }
+        batch_cv_.notify_all();
+        if (batch_flusher_.joinable()) {
+            batch_flusher_.join();
+        }
+    }
+
+    void flush() {
+        std::scoped_lock lock(batch_mutex_);
+        flush_locked();
+    }
+
     bool cancel_call(RpcCallHandle handle) {
-        std::scoped_lock lock(pending_calls_mutex_);
-        auto it = pending_calls_.find(handle);
-        if (it == pending_calls_.end()) {
+        size_t slot_index = handle & 0xFFFF;
+        uint16_t generation = static_cast<uint16_t>(handle >> 16);
+        if (slot_index > slot_mask_) {
             return false;
         }
 
-        // Call callback with cancellation result
-        if (it->second.callback) {
-            RpcResponse response(it->second.service_id, it->second.method_id,
-                               client_id_, it->second.session_id, RpcResult::INTERNAL_ERROR);
-            it->second.callback(response);
+        CallSlot& slot = call_slots_[slot_index];
+        uint8_t expected = SLOT_ACTIVE;
+        if (!slot.state.compare_exchange_strong(expected, SLOT_COMPLETING,
+                                                std::memory_order_acq_rel)) {
+            return false;  // Already completed or never existed
+        }
+
+        if (slot.generation.load(std::memory_order_relaxed) != generation) {
+            // The slot has been recycled for a newer call
+            slot.state.store(SLOT_ACTIVE, std::memory_order_release);
+            return false;
+        }
+
+        RpcCallback callback = std::move(slot.callback);
+        RpcResponse response(slot.service_id, slot.method_id,
+                           client_id_, slot.session_id, RpcResult::INTERNAL_ERROR);
+        slot.state.store(SLOT_EMPTY, std::memory_order_release);
+
+        // Cancellation result delivered outside any slot ownership
+        if (callback) {
+            callback(response);
         }
 
-        pending_calls_.erase(it);
         return true;
     }
 
+    void flush_locked() {
+        if (batch_buffer_.empty()) {
+            return;
+        }
+
+        transport::Endpoint server_endpoint("127.0.0.1", 30490); // TODO: Make configurable
+        transport_->send_packed(batch_buffer_, server_endpoint);
+        batch_buffer_.clear();
+    }
+
+    void flusher_loop() {
+        std::unique_lock lock(batch_mutex_);
+        while (batching_enabled_) {
+            if (batch_buffer_.empty()) {
+                batch_cv_.wait_for(lock, std::chrono::milliseconds(10));
+                continue;
+            }
+            // Let the window fill up, then send whatever accumulated
+            batch_cv_.wait_for(lock, flush_window_);
+            flush_locked();
+        }
+    }
+
     bool is_ready() const {
         return running_ && transport_->is_connected();
     }
 
     RpcClient::Statistics get_statistics() const {
-        // TODO: Implement statistics tracking
-        return RpcClient::Statistics{};
+        RpcClient::Statistics stats;
+        stats.response_time = response_latency_.snapshot();
+        stats.average_response_time =
+            std::chrono::milliseconds(stats.response_time.mean_us / 1000);
+        return stats;
     }
 
 private:
-    struct PendingCall {
-        uint16_t service_id;
-        MethodId method_id;
-        uint16_t session_id;
+    // One in-flight call; the state machine (EMPTY -> CLAIMING ->
+    // ACTIVE -> COMPLETING -> EMPTY) replaces the old map + mutex, and
+    // the generation counter guards cancel handles against slot reuse
+    enum : uint8_t { SLOT_EMPTY = 0, SLOT_CLAIMING = 1, SLOT_ACTIVE = 2, SLOT_COMPLETING = 3 };
+    struct CallSlot {
+        std::atomic<uint8_t> state{SLOT_EMPTY};
+        std::atomic<uint16_t> generation{0};
+        uint16_t service_id{0};
+        MethodId method_id{0};
+        uint16_t session_id{0};
         std::chrono::steady_clock::time_point start_time;
-        RpcTimeout timeout;
+        std::chrono::steady_clock::time_point deadline;  // Swept with TIMEOUT past this
         RpcCallback callback;
     };
 
@@ -198,30 +397,42 @@ private:
             return;
         }
 
-        std::scoped_lock lock(pending_calls_mutex_);
+        // O(1) lock-free match: the session id names the slot
+        CallSlot& slot = call_slots_[message->get_session_id() & slot_mask_];
+
+        uint8_t expected = SLOT_ACTIVE;
+        if (!slot.state.compare_exchange_strong(expected, SLOT_COMPLETING,
+                                                std::memory_order_acq_rel)) {
+            return;  // No call outstanding in this slot
+        }
 
-        // Find matching pending call by session ID
-        for (auto it = pending_calls_.begin(); it != pending_calls_.end(); ++it) {
-            if (it->second.session_id == message->get_session_id() &&
-                it->second.service_id == message->get_service_id() &&
-                it->second.method_id == message->get_method_id()) {
+        if (slot.session_id != message->get_session_id() ||
+            slot.service_id != message->get_service_id() ||
+            slot.method_id != message->get_method_id()) {
+            // Stale or foreign response; hand the slot back untouched
+            slot.state.store(SLOT_ACTIVE, std::memory_order_release);
+            return;
+        }
 
-                // Create response
-                RpcResult result = (message->is_success()) ? RpcResult::SUCCESS : RpcResult::INTERNAL_ERROR;
-                RpcResponse response(message->get_service_id(), message->get_method_id(),
-                                   message->get_client_id(), message->get_session_id(), result);
-                response.return_values = message->get_payload();
+        // Response matched: record round-trip latency
+        response_latency_.record(std::chrono::steady_clock::now() - slot.start_time);
 
-                // Call callback
-                if (it->second.callback) {
-                    it->second.callback(response);
-                }
+        RpcCallback callback = std::move(slot.callback);
+        slot.state.store(SLOT_EMPTY, std::memory_order_release);
 
-                // Remove pending call
-                pending_calls_.erase(it);
-                break;
-            }
+        if (!callback) {
+            return;
         }
+
+        // Invoke outside pending_calls_mutex_: the callback may issue
+        // the next call (coroutine resumption does exactly that) and
+        // would otherwise deadlock re-entering the client
+        RpcResult result = (message->is_success()) ? RpcResult::SUCCESS : RpcResult::INTERNAL_ERROR;
+        RpcResponse response(message->get_service_id(), message->get_method_id(),
+                           message->get_client_id(), message->get_session_id(), result);
+        response.return_values = message->get_payload();
+
+        callback(response);
     }
 
     void on_connection_lost(const transport::Endpoint& endpoint) override {
@@ -237,18 +448,28 @@ private:
     }
 
     uint16_t client_id_;
+    LatencyHistogram response_latency_;
     std::unique_ptr<SessionManager> session_manager_;
     std::shared_ptr<transport::UdpTransport> transport_;
 
-    std::unordered_map<RpcCallHandle, PendingCall> pending_calls_;
-    mutable std::mutex pending_calls_mutex_;
-    std::atomic<RpcCallHandle> next_call_handle_;
+    std::unique_ptr<CallSlot[]> call_slots_;
+    size_t slot_mask_{0};
+    std::thread timeout_sweeper_;
+
+    // Opt-in request batching: packed requests share one datagram
+    std::mutex batch_mutex_;
+    std::condition_variable batch_cv_;
+    std::vector<uint8_t> batch_buffer_;
+    std::thread batch_flusher_;
+    std::atomic<bool> batching_enabled_{false};
+    size_t max_batch_bytes_{1400};
+    std::chrono::milliseconds flush_window_{1};
     std::atomic<bool> running_;
 };
 
 // RpcClient implementation
-RpcClient::RpcClient(uint16_t client_id)
-    : impl_(std::make_unique<RpcClientImpl>(client_id)) {
+RpcClient::RpcClient(uint16_t client_id, size_t max_outstanding_calls)
+    : impl_(std::make_unique<RpcClientImpl>(client_id, max_outstanding_calls)) {
 }
 
 RpcClient::~RpcClient() = default;
@@ -274,10 +495,37 @@ RpcCallHandle RpcClient::call_method_async(uint16_t service_id, MethodId method_
     return impl_->call_method_async(service_id, method_id, parameters, callback, timeout);
 }
 
+RpcSyncResult RpcClient::call_method_sync(uint16_t service_id, MethodId method_id,
+                                         std::vector<uint8_t>&& parameters,
+                                         const RpcTimeout& timeout) {
+    return impl_->call_method_sync(service_id, method_id, std::move(parameters), timeout);
+}
+
+RpcCallHandle RpcClient::call_method_async(uint16_t service_id, MethodId method_id,
+                                          std::vector<uint8_t>&& parameters,
+                                          RpcCallback callback,
+                                          const RpcTimeout& timeout) {
+    return impl_->call_method_async(service_id, method_id, std::move(parameters),
+                                    std::move(callback), timeout);
+}
+
 bool RpcClient::cancel_call(RpcCallHandle handle) {
     return impl_->cancel_call(handle);
 }
 
+void RpcClient::enable_request_batching(size_t max_batch_bytes,
+                                        std::chrono::milliseconds flush_window) {
+    impl_->enable_request_batching(max_batch_bytes, flush_window);
+}
+
+void RpcClient::disable_request_batching() {
+    impl_->disable_request_batching();
+}
+
+void RpcClient::flush() {
+    impl_->flush();
+}
+
 bool RpcClient::is_ready() const {
     return impl_->is_ready();
 }
@@ -18,23 +18,63 @@
 #include "transport/transport.h"
 #include "someip/message.h"
 #include "common/result.h"
+#include "common/latency_histogram.h"
+#include "common/trace_ring.h"
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+#include <algorithm>
 
 namespace someip {
 namespace rpc {
 
 class RpcServerImpl : public transport::ITransportListener {
+    struct RegisteredMethod {
+        MethodHandler handler;              // Vector-based (copies the payload in)
+        MethodViewHandler view_handler;     // Zero-copy (borrows the payload)
+        DispatchMode mode{DispatchMode::INLINE_FAST};
+    };
+
+    struct WorkItem {
+        MessagePtr request;
+        transport::Endpoint sender;
+        RegisteredMethod method;
+    };
+
+    struct WorkerQueue {
+        std::deque<WorkItem> items;
+        std::mutex mutex;
+    };
+
 public:
-    RpcServerImpl(uint16_t service_id)
+    RpcServerImpl(uint16_t service_id, const RpcServerConfig& config)
         : service_id_(service_id),
+          config_(config),
           transport_(std::make_shared<transport::UdpTransport>(transport::Endpoint("127.0.0.1", 30490))),
           running_(false) {
 
         transport_->set_listener(this);
     }
 
+    // Demux mode: responses go through the shared transport; inbound
+    // arrives via handle_demuxed_message, so no listener and no start
+    RpcServerImpl(uint16_t service_id, std::shared_ptr<transport::ITransport> shared,
+                  const RpcServerConfig& config)
+        : service_id_(service_id),
+          config_(config),
+          transport_(std::move(shared)),
+          shared_transport_(true),
+          running_(false) {
+    }
+
+    void handle_demuxed_message(MessagePtr message, const transport::Endpoint& sender) {
+        on_message_received(std::move(message), sender);
+    }
+
     ~RpcServerImpl() {
         shutdown();
     }
@@ -44,11 +84,37 @@ public:
             return true;
         }
 
-        if (transport_->start() != Result::SUCCESS) {
-            return false;
+        // Offload queues first: they must exist (and running_ stay
+        // false) before a transport — ours or a shared one already
+        // running — can deliver a message toward enqueue_work
+        worker_queues_.clear();
+        workers_.clear();
+        if (config_.worker_count > 0) {
+            worker_queues_.resize(config_.worker_count);
+            for (size_t i = 0; i < config_.worker_count; ++i) {
+                worker_queues_[i] = std::make_unique<WorkerQueue>();
+            }
         }
 
+        // Workers spin on running_, so it flips before they start
         running_ = true;
+        for (size_t i = 0; i < config_.worker_count; ++i) {
+            workers_.emplace_back(&RpcServerImpl::worker_loop, this, i);
+        }
+
+        // A shared transport is started (and stopped) by its owner
+        if (!shared_transport_ && transport_->start() != Result::SUCCESS) {
+            running_ = false;
+            for (auto& worker : workers_) {
+                if (worker.joinable()) {
+                    worker.join();
+                }
+            }
+            workers_.clear();
+            worker_queues_.clear();
+            return false;
+        }
+
         return true;
     }
 
@@ -59,30 +125,96 @@ public:
 
         running_ = false;
 
+        // Silence the receive path before tearing down the queues it
+        // enqueues into: stop our own transport (a shared one is the
+        // owner's job — its demux route should be unregistered first,
+        // and enqueue_work tolerates the shutdown window)
+        if (!shared_transport_) {
+            (void)transport_->stop();
+        }
+
+        // Wake and join the offload workers; queued requests are dropped
+        work_available_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        workers_.clear();
+        worker_queues_.clear();
+
         // Clear all method handlers
         std::scoped_lock lock(methods_mutex_);
         method_handlers_.clear();
-
-        transport_->stop();
     }
 
-    bool register_method(MethodId method_id, MethodHandler handler) {
+    bool register_method(MethodId method_id, MethodHandler handler, DispatchMode mode) {
+        if (std::atomic_load(&frozen_table_)) {
+            return false;  // Method set is frozen
+        }
         std::scoped_lock lock(methods_mutex_);
 
         // Check if already registered
         bool already_exists = method_handlers_.count(method_id) > 0;
         if (!already_exists) {
-            method_handlers_[method_id] = handler;
+            method_handlers_[method_id] =
+                RegisteredMethod{std::move(handler), nullptr, mode};
+        }
+        return !already_exists;
+    }
+
+    bool register_method(MethodId method_id, MethodViewHandler handler, DispatchMode mode) {
+        if (std::atomic_load(&frozen_table_)) {
+            return false;  // Method set is frozen
+        }
+        std::scoped_lock lock(methods_mutex_);
+
+        bool already_exists = method_handlers_.count(method_id) > 0;
+        if (!already_exists) {
+            method_handlers_[method_id] =
+                RegisteredMethod{nullptr, std::move(handler), mode};
         }
         return !already_exists;
     }
 
     bool unregister_method(MethodId method_id) {
+        if (std::atomic_load(&frozen_table_)) {
+            return false;  // Method set is frozen
+        }
         std::scoped_lock lock(methods_mutex_);
         return method_handlers_.erase(method_id) > 0;
     }
 
+    bool freeze() {
+        std::scoped_lock lock(methods_mutex_);
+
+        if (std::atomic_load(&frozen_table_) || method_handlers_.empty()) {
+            return false;
+        }
+
+        // Direct-indexed table sized to the densest registered id;
+        // empty slots carry no handler and resolve to UNKNOWN_METHOD
+        MethodId max_id = 0;
+        for (const auto& pair : method_handlers_) {
+            max_id = std::max(max_id, pair.first);
+        }
+
+        auto table = std::make_shared<std::vector<RegisteredMethod>>(
+            static_cast<size_t>(max_id) + 1);
+        for (const auto& pair : method_handlers_) {
+            (*table)[pair.first] = pair.second;
+        }
+
+        std::atomic_store(&frozen_table_,
+                          std::shared_ptr<const std::vector<RegisteredMethod>>(std::move(table)));
+        return true;
+    }
+
     bool is_method_registered(MethodId method_id) const {
+        if (auto table = std::atomic_load(&frozen_table_)) {
+            return method_id < table->size() &&
+                   ((*table)[method_id].handler || (*table)[method_id].view_handler);
+        }
         std::scoped_lock lock(methods_mutex_);
         return method_handlers_.find(method_id) != method_handlers_.end();
     }
@@ -102,20 +234,42 @@ public:
     }
 
     RpcServer::Statistics get_statistics() const {
-        // TODO: Implement statistics tracking
-        return RpcServer::Statistics{};
+        RpcServer::Statistics stats;
+        stats.processing_time = processing_latency_.snapshot();
+        stats.average_processing_time =
+            std::chrono::milliseconds(stats.processing_time.mean_us / 1000);
+        stats.requests_offloaded = requests_offloaded_.load(std::memory_order_relaxed);
+        stats.requests_shed = requests_shed_.load(std::memory_order_relaxed);
+        return stats;
     }
 
 private:
     void on_message_received(MessagePtr message, const transport::Endpoint& sender) override {
         // Check if this is for our service and is a request
-        if (message->get_service_id() != service_id_ || !message->is_request()) {
+        if (!running_ || message->get_service_id() != service_id_ || !message->is_request()) {
             return;
         }
 
-        // Find method handler
-        MethodHandler handler;
-        {
+        // Find method handler: frozen services resolve with a single
+        // indexed load, unfrozen ones fall back to the locked map
+        RegisteredMethod method;
+        if (auto table = std::atomic_load(&frozen_table_)) {
+            MethodId method_id = message->get_method_id();
+            if (method_id >= table->size() ||
+                (!(*table)[method_id].handler && !(*table)[method_id].view_handler)) {
+                send_error_response(message, sender, ReturnCode::E_UNKNOWN_METHOD);
+                return;
+            }
+
+            const RegisteredMethod& entry = (*table)[method_id];
+            if (entry.mode != DispatchMode::OFFLOAD || worker_queues_.empty()) {
+                // Hot path: dispatch straight from the immutable table,
+                // no handler copies
+                process_request(message, sender, entry);
+                return;
+            }
+            method = entry;  // Offload needs its own copy for the queue
+        } else {
             std::scoped_lock lock(methods_mutex_);
             auto it = method_handlers_.find(message->get_method_id());
             if (it == method_handlers_.end()) {
@@ -123,20 +277,123 @@ private:
                 send_error_response(message, sender, ReturnCode::E_UNKNOWN_METHOD);
                 return;
             }
-            handler = it->second;
+            method = it->second;
         }
 
-        // Process the method call
+        if (method.mode == DispatchMode::OFFLOAD && !worker_queues_.empty()) {
+            // Slow methods leave the receive path immediately so they
+            // cannot head-of-line block the fast ones. The message is
+            // copied (shared_ptr) because the shed path still needs it
+            // for the error response.
+            if (enqueue_work(WorkItem{message, sender, std::move(method)})) {
+                requests_offloaded_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                requests_shed_.fetch_add(1, std::memory_order_relaxed);
+                send_error_response(message, sender, ReturnCode::E_NOT_REACHABLE);
+            }
+            return;
+        }
+
+        process_request(message, sender, method);
+    }
+
+    // Run one decoded request to completion (handler + response)
+    void process_request(const MessagePtr& message, const transport::Endpoint& sender,
+                         const RegisteredMethod& method) {
+        uint32_t span = TraceRing::span_of(message->get_client_id(),
+                                           message->get_session_id());
+        TraceRing::record(span, TraceSite::DISPATCH);
+
+        // Process the method call, timing handler plus response send
+        auto processing_start = std::chrono::steady_clock::now();
         std::vector<uint8_t> output_params;
-        RpcResult result = handler(message->get_client_id(), message->get_session_id(),
-                                  message->get_payload(), output_params);
+        RpcResult result;
+
+        if (method.view_handler) {
+            // Zero-copy path: the handler borrows the payload in place
+            const PayloadBuffer& payload = message->get_payload();
+            RpcRequestView view{message->get_client_id(), message->get_session_id(),
+                                payload.data(), payload.size()};
+            result = method.view_handler(view, output_params);
+        } else {
+            result = method.handler(message->get_client_id(), message->get_session_id(),
+                                    message->get_payload(), output_params);
+        }
 
-        // Send response
+        TraceRing::record(span, TraceSite::HANDLER_RETURN);
+
+        // Send response; the output buffer is lent to the message, not copied
         if (result == RpcResult::SUCCESS) {
-            send_success_response(message, sender, output_params);
+            send_success_response(message, sender, std::move(output_params));
         } else {
             send_error_response(message, sender, map_rpc_result_to_return_code(result));
         }
+        TraceRing::record(span, TraceSite::SEND);
+
+        processing_latency_.record(std::chrono::steady_clock::now() - processing_start);
+    }
+
+    // Round-robin placement with overflow spill to any queue with room;
+    // false means every queue is at its depth bound (caller sheds)
+    bool enqueue_work(WorkItem item) {
+        size_t start = next_worker_.fetch_add(1, std::memory_order_relaxed) %
+                       worker_queues_.size();
+
+        for (size_t i = 0; i < worker_queues_.size(); ++i) {
+            WorkerQueue& queue = *worker_queues_[(start + i) % worker_queues_.size()];
+            {
+                std::scoped_lock lock(queue.mutex);
+                if (queue.items.size() >= config_.queue_depth) {
+                    continue;
+                }
+                queue.items.push_back(std::move(item));
+            }
+            work_available_.notify_all();
+            return true;
+        }
+
+        return false;
+    }
+
+    void worker_loop(size_t worker_index) {
+        WorkerQueue& own_queue = *worker_queues_[worker_index];
+
+        while (running_) {
+            WorkItem item;
+            bool have_work = false;
+
+            // Own queue first (front), then steal from the back of a
+            // sibling so the owner and thief rarely contend
+            {
+                std::scoped_lock lock(own_queue.mutex);
+                if (!own_queue.items.empty()) {
+                    item = std::move(own_queue.items.front());
+                    own_queue.items.pop_front();
+                    have_work = true;
+                }
+            }
+
+            if (!have_work) {
+                for (size_t i = 1; i < worker_queues_.size() && !have_work; ++i) {
+                    WorkerQueue& victim =
+                        *worker_queues_[(worker_index + i) % worker_queues_.size()];
+                    std::scoped_lock lock(victim.mutex);
+                    if (!victim.items.empty()) {
+                        item = std::move(victim.items.back());
+                        victim.items.pop_back();
+                        have_work = true;
+                    }
+                }
+            }
+
+            if (have_work) {
+                process_request(item.request, item.sender, item.method);
+                continue;
+            }
+
+            std::unique_lock lock(work_wait_mutex_);
+            work_available_.wait_for(lock, std::chrono::milliseconds(50));
+        }
     }
 
     void on_connection_lost(const transport::Endpoint& endpoint) override {
@@ -152,11 +409,11 @@ private:
     }
 
     void send_success_response(MessagePtr request, const transport::Endpoint& sender,
-                              const std::vector<uint8_t>& return_values) {
+                              std::vector<uint8_t>&& return_values) {
         MessageId response_msg_id(request->get_service_id(), request->get_method_id());
         Message response(response_msg_id, request->get_request_id(),
                         MessageType::RESPONSE, ReturnCode::E_OK);
-        response.set_payload(return_values);
+        response.set_payload(std::move(return_values));
 
         Result result = transport_->send_message(response, sender);
         if (result != Result::SUCCESS) {
@@ -193,17 +450,42 @@ private:
     }
 
     uint16_t service_id_;
-    std::shared_ptr<transport::UdpTransport> transport_;
+    RpcServerConfig config_;
+    LatencyHistogram processing_latency_;
+    std::shared_ptr<transport::ITransport> transport_;
+    bool shared_transport_{false};
 
-    std::unordered_map<MethodId, MethodHandler> method_handlers_;
+    std::unordered_map<MethodId, RegisteredMethod> method_handlers_;
     mutable std::mutex methods_mutex_;
 
+    // Immutable dispatch table, present once freeze() has run
+    std::shared_ptr<const std::vector<RegisteredMethod>> frozen_table_;
+
+    // Offload pool
+    std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> next_worker_{0};
+    std::mutex work_wait_mutex_;
+    std::condition_variable work_available_;
+    std::atomic<uint32_t> requests_offloaded_{0};
+    std::atomic<uint32_t> requests_shed_{0};
+
     std::atomic<bool> running_;
 };
 
 // RpcServer implementation
-RpcServer::RpcServer(uint16_t service_id)
-    : impl_(std::make_unique<RpcServerImpl>(service_id)) {
+RpcServer::RpcServer(uint16_t service_id, const RpcServerConfig& config)
+    : impl_(std::make_unique<RpcServerImpl>(service_id, config)) {
+}
+
+RpcServer::RpcServer(uint16_t service_id,
+                     std::shared_ptr<transport::ITransport> shared_transport,
+                     const RpcServerConfig& config)
+    : impl_(std::make_unique<RpcServerImpl>(service_id, std::move(shared_transport), config)) {
+}
+
+void RpcServer::handle_demuxed_message(MessagePtr message, const transport::Endpoint& sender) {
+    impl_->handle_demuxed_message(std::move(message), sender);
 }
 
 RpcServer::~RpcServer() = default;
@@ -216,14 +498,22 @@ void RpcServer::shutdown() {
     impl_->shutdown();
 }
 
-bool RpcServer::register_method(MethodId method_id, MethodHandler handler) {
-    return impl_->register_method(method_id, handler);
+bool RpcServer::register_method(MethodId method_id, MethodHandler handler, DispatchMode mode) {
+    return impl_->register_method(method_id, std::move(handler), mode);
+}
+
+bool RpcServer::register_method(MethodId method_id, MethodViewHandler handler, DispatchMode mode) {
+    return impl_->register_method(method_id, std::move(handler), mode);
 }
 
 bool RpcServer::unregister_method(MethodId method_id) {
     return impl_->unregister_method(method_id);
 }
 
+bool RpcServer::freeze() {
+    return impl_->freeze();
+}
+
 bool RpcServer::is_method_registered(MethodId method_id) const {
     return impl_->is_method_registered(method_id);
 }
@@ -12,6 +12,14 @@
  ********************************************************************************/
 
 #include "sd/sd_client.h"
+#include "sd/service_registry.h"
+#include "common/timer_wheel.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <ctime>
 #include "sd/sd_message.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
@@ -28,11 +36,25 @@ namespace someip {
 namespace sd {
 
 class SdClientImpl : public transport::ITransportListener {
+    struct ActiveSubscription {
+        uint16_t service_id{0};
+        uint16_t instance_id{0};
+        uint16_t eventgroup_id{0};
+    };
+
+    static uint64_t subscription_key(uint16_t service_id, uint16_t instance_id,
+                                     uint16_t eventgroup_id) {
+        return (static_cast<uint64_t>(service_id) << 32) |
+               (static_cast<uint64_t>(instance_id) << 16) | eventgroup_id;
+    }
+
 public:
     SdClientImpl(const SdConfig& config)
         : config_(config),
+          // Bind the SD port on any interface: offers arrive on the
+          // multicast group's port, which an ephemeral bind never sees
           transport_(std::make_shared<transport::UdpTransport>(
-              transport::Endpoint(config.unicast_address, config.unicast_port))),
+              transport::Endpoint("0.0.0.0", config.multicast_port))),
           running_(false),
           next_request_id_(1) {
 
@@ -43,6 +65,114 @@ public:
         shutdown();
     }
 
+    // On-disk discovery cache layout: header + fixed record slots,
+    // memory-mapped so loads are one mmap and updates are memcpys
+    struct CacheRecord {
+        uint16_t service_id;
+        uint16_t instance_id;
+        uint8_t major_version;
+        uint8_t minor_version;
+        uint8_t protocol;
+        uint8_t reserved;
+        uint16_t port;
+        char ip_address[18];
+        uint32_t ttl_deadline_epoch;  // Seconds; stale past this
+    };
+
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t count;
+    };
+
+    static constexpr uint32_t CACHE_MAGIC = 0x53444343;  // "SDCC"
+    static constexpr size_t CACHE_CAPACITY = 512;
+
+    bool enable_persistent_cache(const std::string& path) {
+        if (cache_header_) {
+            return true;  // Already mapped
+        }
+
+        size_t file_size = sizeof(CacheHeader) + CACHE_CAPACITY * sizeof(CacheRecord);
+        int fd = open(path.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0) {
+            return false;
+        }
+        if (ftruncate(fd, static_cast<off_t>(file_size)) < 0) {
+            close(fd);
+            return false;
+        }
+
+        void* mapped = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);  // The mapping keeps the file open
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        cache_header_ = static_cast<CacheHeader*>(mapped);
+        cache_records_ = reinterpret_cast<CacheRecord*>(
+            static_cast<uint8_t*>(mapped) + sizeof(CacheHeader));
+        cache_size_ = file_size;
+
+        if (cache_header_->magic != CACHE_MAGIC) {
+            // Fresh (or foreign) file: initialize empty
+            cache_header_->magic = CACHE_MAGIC;
+            cache_header_->count = 0;
+            return true;
+        }
+
+        // Warm start: adopt every unexpired record as stale-but-usable
+        uint32_t now_epoch = static_cast<uint32_t>(::time(nullptr));
+        uint32_t count = std::min<uint32_t>(cache_header_->count, CACHE_CAPACITY);
+
+        std::scoped_lock lock(available_services_mutex_);
+        for (uint32_t i = 0; i < count; ++i) {
+            const CacheRecord& record = cache_records_[i];
+            if (record.ttl_deadline_epoch <= now_epoch) {
+                continue;  // Expired while we were down
+            }
+
+            ServiceInstance instance(record.service_id, record.instance_id,
+                                     record.major_version, record.minor_version);
+            instance.ip_address.assign(record.ip_address,
+                                       strnlen(record.ip_address, sizeof(record.ip_address)));
+            instance.port = record.port;
+            instance.protocol = record.protocol;
+            instance.ttl_seconds = record.ttl_deadline_epoch - now_epoch;
+            available_services_.insert(record.service_id, record.instance_id, instance);
+        }
+
+        return true;
+    }
+
+    // Rewrite the mapped records from the current registry; cheap for
+    // the set sizes SD tracks, and crash-safe enough (count last)
+    void persist_available_services() {
+        if (!cache_header_) {
+            return;
+        }
+
+        uint32_t now_epoch = static_cast<uint32_t>(::time(nullptr));
+        uint32_t count = 0;
+        available_services_.for_each([&](const ServiceInstance& instance) {
+            if (count >= CACHE_CAPACITY) {
+                return;
+            }
+            CacheRecord& record = cache_records_[count];
+            std::memset(&record, 0, sizeof(record));
+            record.service_id = instance.service_id;
+            record.instance_id = instance.instance_id;
+            record.major_version = instance.major_version;
+            record.minor_version = instance.minor_version;
+            record.protocol = instance.protocol;
+            record.port = instance.port;
+            std::strncpy(record.ip_address, instance.ip_address.c_str(),
+                         sizeof(record.ip_address) - 1);
+            record.ttl_deadline_epoch = now_epoch + instance.ttl_seconds;
+            ++count;
+        });
+        cache_header_->count = count;
+    }
+
     bool initialize() {
         if (running_) {
             return true;
@@ -58,6 +188,8 @@ public:
             return false;
         }
 
+        ttl_wheel_.start();
+
         running_ = true;
         return true;
     }
@@ -68,6 +200,24 @@ public:
         }
 
         running_ = false;
+        ttl_wheel_.stop();
+
+        // Leave the group while the socket is still open, then stop the
+        // transport before unmapping: a late offer on the receive thread
+        // would otherwise write into unmapped pages. The mapping is torn
+        // down under the registry mutex so no racer can observe a
+        // half-unmapped cache.
+        leave_multicast_group();
+        transport_->stop();
+
+        if (cache_header_) {
+            std::scoped_lock lock(available_services_mutex_);
+            persist_available_services();
+            msync(cache_header_, cache_size_, MS_SYNC);
+            munmap(cache_header_, cache_size_);
+            cache_header_ = nullptr;
+            cache_records_ = nullptr;
+        }
 
         // Clear all subscriptions and callbacks
         {
@@ -75,10 +225,6 @@ public:
             service_subscriptions_.clear();
         }
 
-        // Leave multicast group
-        leave_multicast_group();
-
-        transport_->stop();
     }
 
     bool find_service(uint16_t service_id, FindServiceCallback callback,
@@ -151,38 +297,93 @@ public:
             return false;
         }
 
-        // Create subscribe event group entry
-        auto subscribe_entry = std::make_unique<EventGroupEntry>(EntryType::SUBSCRIBE_EVENTGROUP);
-        subscribe_entry->set_service_id(service_id);
-        subscribe_entry->set_instance_id(instance_id);
-        subscribe_entry->set_eventgroup_id(eventgroup_id);
-        subscribe_entry->set_major_version(0x01);  // Version 1
-        subscribe_entry->set_ttl(3600);  // 1 hour TTL
-
-        // Create SD message
-        SdMessage sd_message;
-        sd_message.add_entry(std::move(subscribe_entry));
+        ActiveSubscription subscription{service_id, instance_id, eventgroup_id};
+        {
+            std::scoped_lock lock(active_subscriptions_mutex_);
+            uint64_t key = subscription_key(service_id, instance_id, eventgroup_id);
+            active_subscriptions_[key] = subscription;
+
+            // One recurring cohort timer renews every active
+            // subscription in a single multi-entry message, jittered by
+            // the cohort window so 150 subscriptions do not drip
+            // individual renewal packets
+            if (renewal_timer_ == 0) {
+                auto period = std::chrono::milliseconds(
+                    static_cast<int64_t>(config_.subscription_ttl_seconds) * 800);
+                renewal_timer_ = ttl_wheel_.schedule_recurring(
+                    period, [this]() { renew_subscriptions(); },
+                    config_.renewal_cohort_window);
+            }
+        }
 
-        // Add IPv4 endpoint option (client's unicast address)
-        auto endpoint_option = std::make_unique<IPv4EndpointOption>();
-        endpoint_option->set_ipv4_address_from_string(config_.unicast_address);
-        endpoint_option->set_port(transport_->get_local_endpoint().get_port());
-        endpoint_option->set_protocol(0x11);  // UDP
-        sd_message.add_option(std::move(endpoint_option));
+        return send_subscribe_batch(&subscription, 1, config_.subscription_ttl_seconds);
+    }
 
-        // Set option index in entry
-        if (auto* entry = dynamic_cast<EventGroupEntry*>(sd_message.get_entries()[0].get())) {
-            entry->set_index1(0);  // Reference first option
+    void renew_subscriptions() {
+        std::vector<ActiveSubscription> subscriptions;
+        {
+            std::scoped_lock lock(active_subscriptions_mutex_);
+            subscriptions.reserve(active_subscriptions_.size());
+            for (const auto& pair : active_subscriptions_) {
+                subscriptions.push_back(pair.second);
+            }
         }
 
-        // Create SOME/IP message for SD
-        Message someip_message(MessageId(0xFFFF, 0x0000), RequestId(0x0000, 0x0000),
-                              MessageType::NOTIFICATION, ReturnCode::E_OK);
-        someip_message.set_payload(sd_message.serialize());
+        if (!subscriptions.empty()) {
+            send_subscribe_batch(subscriptions.data(), subscriptions.size(),
+                                 config_.subscription_ttl_seconds);
+        }
+    }
 
-        // Send multicast message
+    /**
+     * One multi-entry SubscribeEventgroup message per MTU-sized chunk;
+     * every entry shares the client endpoint option at index 0
+     */
+    bool send_subscribe_batch(const ActiveSubscription* subscriptions, size_t count,
+                              uint32_t ttl_seconds) {
+        // The builder is shared between subscribe callers and the
+        // renewal timer thread
+        std::scoped_lock builder_lock(subscribe_builder_mutex_);
         transport::Endpoint multicast_endpoint(config_.multicast_address, config_.multicast_port);
-        return transport_->send_message(someip_message, multicast_endpoint) == Result::SUCCESS;
+        constexpr size_t kFrameBudget = 1400;
+        constexpr size_t kEntryBytes = 18;
+
+        bool all_sent = true;
+        size_t index = 0;
+        while (index < count) {
+            subscribe_builder_.reset();
+
+            IPv4EndpointOption& endpoint_option = subscribe_builder_.add_ipv4_endpoint_option();
+            endpoint_option.set_ipv4_address_from_string(config_.unicast_address);
+            endpoint_option.set_port(transport_->get_local_endpoint().get_port());
+            endpoint_option.set_protocol(0x11);  // UDP
+
+            size_t frame_bytes = 12 + 8 + 12;  // Headers + the shared option
+            while (index < count && frame_bytes + kEntryBytes <= kFrameBudget) {
+                const ActiveSubscription& subscription = subscriptions[index];
+                EventGroupEntry& entry =
+                    subscribe_builder_.add_eventgroup_entry(EntryType::SUBSCRIBE_EVENTGROUP);
+                entry.set_service_id(subscription.service_id);
+                entry.set_instance_id(subscription.instance_id);
+                entry.set_eventgroup_id(subscription.eventgroup_id);
+                entry.set_major_version(0x01);  // Version 1
+                entry.set_ttl(ttl_seconds);
+                entry.set_index1(0);  // Shared client endpoint option
+                frame_bytes += kEntryBytes;
+                ++index;
+            }
+
+            // Create SOME/IP message for SD
+            Message someip_message(MessageId(0xFFFF, 0x0000), RequestId(0x0000, 0x0000),
+                                  MessageType::NOTIFICATION, ReturnCode::E_OK);
+            someip_message.set_payload(subscribe_builder_.build());
+
+            if (transport_->send_message(someip_message, multicast_endpoint) != Result::SUCCESS) {
+                all_sent = false;
+            }
+        }
+
+        return all_sent;
     }
 
     bool unsubscribe_eventgroup(uint16_t service_id, uint16_t instance_id, uint16_t eventgroup_id) {
@@ -190,6 +391,12 @@ public:
             return false;
         }
 
+        {
+            std::scoped_lock lock(active_subscriptions_mutex_);
+            active_subscriptions_.erase(
+                subscription_key(service_id, instance_id, eventgroup_id));
+        }
+
         // Create unsubscribe event group entry (TTL = 0)
         auto unsubscribe_entry = std::make_unique<EventGroupEntry>(EntryType::STOP_SUBSCRIBE_EVENTGROUP);
         unsubscribe_entry->set_service_id(service_id);
@@ -216,9 +423,15 @@ public:
         std::scoped_lock lock(available_services_mutex_);
         std::vector<ServiceInstance> result;
 
-        for (const auto& service : available_services_) {
-            if (service_id == 0 || service.service_id == service_id) {
+        if (service_id == 0) {
+            result.reserve(available_services_.size());
+            available_services_.for_each([&result](const ServiceInstance& service) {
                 result.push_back(service);
+            });
+        } else {
+            // Per-service bucket: untouched services are never scanned
+            for (const ServiceInstance* service : available_services_.find_all(service_id)) {
+                result.push_back(*service);
             }
         }
 
@@ -253,14 +466,20 @@ private:
             return false;
         }
 
-        // Use standard SOME/IP SD multicast address
-        return udp_transport->join_multicast_group("224.224.224.245") == Result::SUCCESS;
+        // Join the configured SD group, pinned to the configured
+        // unicast interface so multi-NIC hosts get deterministic
+        // membership
+        // Pin egress too: offers/finds leave through the configured
+        // interface with loopback enabled for same-host peers
+        udp_transport->set_multicast_interface(config_.unicast_address);
+        return udp_transport->join_multicast_group(config_.multicast_address,
+                                                   config_.unicast_address) == Result::SUCCESS;
     }
 
     void leave_multicast_group() {
         auto udp_transport = std::dynamic_pointer_cast<transport::UdpTransport>(transport_);
         if (udp_transport) {
-            udp_transport->leave_multicast_group("224.224.224.245");
+            udp_transport->leave_multicast_group(config_.multicast_address);
         }
     }
 
@@ -318,36 +537,39 @@ private:
         instance.minor_version = 0;  // Not in basic offer
         instance.ttl_seconds = entry.get_ttl();
 
-        // Extract endpoint information from options
+        // Extract endpoint information from options; index 0 is a
+        // perfectly valid option reference
         const auto& options = message.get_options();
         uint8_t index1 = entry.get_index1();
-        uint8_t run1 = entry.get_index1() ? 1 : 0;  // Simple case: check if index1 is set
 
-        for (uint8_t i = 0; i < run1 && (index1 + i) < options.size(); ++i) {
-            const auto& option = options[index1 + i];
+        // Capability negotiation: index2 may reference a CONFIGURATION
+        // option; "lz4" marks a peer consenting to compressed payloads
+        uint8_t index2 = entry.get_index2();
+        if (index2 < options.size() &&
+            options[index2]->get_type() == OptionType::CONFIGURATION) {
+            const auto* config_option =
+                static_cast<const ConfigurationOption*>(options[index2].get());
+            instance.supports_compression = config_option->contains_string("lz4");
+        }
+
+        if (index1 < options.size()) {
+            const auto& option = options[index1];
             if (option->get_type() == OptionType::IPV4_ENDPOINT) {
                 auto* ep = static_cast<const IPv4EndpointOption*>(option.get());
                 instance.ip_address = ep->get_ipv4_address_string();
                 instance.port = ep->get_port();
                 instance.protocol = ep->get_protocol();
-                break;  // Found the endpoint option
             }
         }
 
         // Update available services
         {
             std::scoped_lock lock(available_services_mutex_);
-            auto it = std::find_if(available_services_.begin(), available_services_.end(),
-                [&](const ServiceInstance& svc) {
-                    return svc.service_id == instance.service_id &&
-                           svc.instance_id == instance.instance_id;
-                });
-
-            if (it == available_services_.end()) {
-                available_services_.push_back(instance);
-            } else {
-                *it = instance;  // Update existing
-            }
+            // Insert-or-replace in one hash probe
+            available_services_.insert(instance.service_id, instance.instance_id, instance);
+            persist_available_services();
+            schedule_ttl_expiry(instance.service_id, instance.instance_id,
+                                instance.ttl_seconds);
         }
 
         // Notify subscribers
@@ -382,12 +604,9 @@ private:
         // Remove from available services
         {
             std::scoped_lock lock(available_services_mutex_);
-            auto it = std::remove_if(available_services_.begin(), available_services_.end(),
-                [&](const ServiceInstance& svc) {
-                    return svc.service_id == instance.service_id &&
-                           svc.instance_id == instance.instance_id;
-                });
-            available_services_.erase(it, available_services_.end());
+            available_services_.erase(instance.service_id, instance.instance_id);
+            persist_available_services();
+            cancel_ttl_expiry(instance.service_id, instance.instance_id);
         }
 
         // Notify subscribers
@@ -404,7 +623,54 @@ private:
     std::unordered_map<uint16_t, ServiceSubscription> service_subscriptions_;
     mutable std::mutex subscriptions_mutex_;
 
-    std::vector<ServiceInstance> available_services_;
+    ServiceRegistry<ServiceInstance> available_services_;
+
+    // TTL bookkeeping: each offer (re)arms a one-shot expiry on the
+    // wheel; a fresh offer for the same instance replaces the old timer
+    void schedule_ttl_expiry(uint16_t service_id, uint16_t instance_id, uint32_t ttl_seconds) {
+        if (ttl_seconds == 0) {
+            return;
+        }
+
+        uint32_t key = (static_cast<uint32_t>(service_id) << 16) | instance_id;
+        auto it = ttl_timers_.find(key);
+        if (it != ttl_timers_.end()) {
+            ttl_wheel_.cancel(it->second);
+        }
+
+        ttl_timers_[key] = ttl_wheel_.schedule(
+            std::chrono::milliseconds(static_cast<int64_t>(ttl_seconds) * 1000),
+            [this, service_id, instance_id]() {
+                std::scoped_lock lock(available_services_mutex_);
+                if (available_services_.erase(service_id, instance_id)) {
+                    persist_available_services();
+                }
+                ttl_timers_.erase((static_cast<uint32_t>(service_id) << 16) | instance_id);
+            });
+    }
+
+    void cancel_ttl_expiry(uint16_t service_id, uint16_t instance_id) {
+        uint32_t key = (static_cast<uint32_t>(service_id) << 16) | instance_id;
+        auto it = ttl_timers_.find(key);
+        if (it != ttl_timers_.end()) {
+            ttl_wheel_.cancel(it->second);
+            ttl_timers_.erase(it);
+        }
+    }
+
+    std::mutex active_subscriptions_mutex_;
+    std::unordered_map<uint64_t, ActiveSubscription> active_subscriptions_;
+    TimerWheel::TimerId renewal_timer_{0};
+    std::mutex subscribe_builder_mutex_;
+    SdMessageBuilder subscribe_builder_;  // Guarded by subscribe_builder_mutex_
+
+    TimerWheel ttl_wheel_;
+    std::unordered_map<uint32_t, TimerWheel::TimerId> ttl_timers_;  // Guarded by available_services_mutex_
+
+    // Persistent discovery cache mapping (optional)
+    CacheHeader* cache_header_{nullptr};
+    CacheRecord* cache_records_{nullptr};
+    size_t cache_size_{0};
     mutable std::mutex available_services_mutex_;
 
     std::unordered_map<uint32_t, PendingFind> pending_finds_;
@@ -421,6 +687,10 @@ SdClient::SdClient(const SdConfig& config)
 
 SdClient::~SdClient() = default;
 
+bool SdClient::enable_persistent_cache(const std::string& path) {
+    return impl_->enable_persistent_cache(path);
+}
+
 bool SdClient::initialize() {
     return impl_->initialize();
 }
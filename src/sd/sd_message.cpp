@@ -21,9 +21,7 @@ namespace someip {
 namespace sd {
 
 // SdEntry serialization/deserialization
-std::vector<uint8_t> SdEntry::serialize() const {
-    std::vector<uint8_t> data;
-    data.reserve(16);  // SD entry is 16 bytes
+void SdEntry::serialize_base_into(std::vector<uint8_t>& data) const {
 
     // Type (1 byte)
     data.push_back(static_cast<uint8_t>(type_));
@@ -56,8 +54,6 @@ std::vector<uint8_t> SdEntry::serialize() const {
     data.push_back((ttl_ >> 16) & 0xFF);
     data.push_back((ttl_ >> 8) & 0xFF);
     data.push_back(ttl_ & 0xFF);
-
-    return data;
 }
 
 bool SdEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -75,21 +71,21 @@ bool SdEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
 }
 
 // ServiceEntry implementation
-std::vector<uint8_t> ServiceEntry::serialize() const {
-    std::vector<uint8_t> data = SdEntry::serialize();
+void ServiceEntry::serialize_into(std::vector<uint8_t>& out) const {
+    size_t base = out.size();
+    serialize_base_into(out);
 
-    // Override the service ID field (bytes 4-5)
-    data[4] = (service_id_ >> 8) & 0xFF;
-    data[5] = service_id_ & 0xFF;
+    // Override the service ID field (bytes 5-6, after the 5-byte
+    // type/index/option-count header the deserializer consumes)
+    out[base + 5] = (service_id_ >> 8) & 0xFF;
+    out[base + 6] = service_id_ & 0xFF;
 
-    // Override the instance ID field (bytes 6-7)
-    data[6] = (instance_id_ >> 8) & 0xFF;
-    data[7] = instance_id_ & 0xFF;
+    // Override the instance ID field (bytes 7-8)
+    out[base + 7] = (instance_id_ >> 8) & 0xFF;
+    out[base + 8] = instance_id_ & 0xFF;
 
-    // Override the major version field (byte 8)
-    data[8] = major_version_;
-
-    return data;
+    // Override the major version field (byte 9)
+    out[base + 9] = major_version_;
 }
 
 bool ServiceEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -112,25 +108,25 @@ bool ServiceEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset)
 }
 
 // EventGroupEntry implementation
-std::vector<uint8_t> EventGroupEntry::serialize() const {
-    std::vector<uint8_t> data = SdEntry::serialize();
-
-    // Override the service ID field (bytes 4-5)
-    data[4] = (service_id_ >> 8) & 0xFF;
-    data[5] = service_id_ & 0xFF;
+void EventGroupEntry::serialize_into(std::vector<uint8_t>& out) const {
+    size_t base = out.size();
+    serialize_base_into(out);
 
-    // Override the instance ID field (bytes 6-7)
-    data[6] = (instance_id_ >> 8) & 0xFF;
-    data[7] = instance_id_ & 0xFF;
+    // Override the service ID field (bytes 5-6, after the 5-byte
+    // type/index/option-count header the deserializer consumes)
+    out[base + 5] = (service_id_ >> 8) & 0xFF;
+    out[base + 6] = service_id_ & 0xFF;
 
-    // Override the major version field (byte 8)
-    data[8] = major_version_;
+    // Override the instance ID field (bytes 7-8)
+    out[base + 7] = (instance_id_ >> 8) & 0xFF;
+    out[base + 8] = instance_id_ & 0xFF;
 
-    // Event group ID (bytes 9-10)
-    data.push_back((eventgroup_id_ >> 8) & 0xFF);
-    data.push_back(eventgroup_id_ & 0xFF);
+    // Override the major version field (byte 9)
+    out[base + 9] = major_version_;
 
-    return data;
+    // Event group ID (appended after the TTL)
+    out.push_back((eventgroup_id_ >> 8) & 0xFF);
+    out.push_back(eventgroup_id_ & 0xFF);
 }
 
 bool EventGroupEntry::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -154,9 +150,7 @@ bool EventGroupEntry::deserialize(const std::vector<uint8_t>& data, size_t& offs
 }
 
 // SdOption serialization/deserialization
-std::vector<uint8_t> SdOption::serialize() const {
-    std::vector<uint8_t> data;
-
+void SdOption::serialize_base_into(std::vector<uint8_t>& data) const {
     // Length (2 bytes)
     data.push_back((length_ >> 8) & 0xFF);
     data.push_back(length_ & 0xFF);
@@ -166,8 +160,6 @@ std::vector<uint8_t> SdOption::serialize() const {
 
     // Reserved (1 byte)
     data.push_back(0);
-
-    return data;
 }
 
 bool SdOption::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -185,8 +177,9 @@ bool SdOption::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
 }
 
 // IPv4EndpointOption implementation
-std::vector<uint8_t> IPv4EndpointOption::serialize() const {
-    std::vector<uint8_t> data = SdOption::serialize();
+void IPv4EndpointOption::serialize_into(std::vector<uint8_t>& data) const {
+    size_t base = data.size();
+    serialize_base_into(data);
 
     // IPv4 Address (4 bytes, network byte order)
     // ipv4_address_ is already in network byte order
@@ -208,10 +201,8 @@ std::vector<uint8_t> IPv4EndpointOption::serialize() const {
 
     // Update length (8 bytes of data after the option header)
     uint16_t length = 8;
-    data[0] = (length >> 8) & 0xFF;
-    data[1] = length & 0xFF;
-
-    return data;
+    data[base + 0] = (length >> 8) & 0xFF;
+    data[base + 1] = length & 0xFF;
 }
 
 bool IPv4EndpointOption::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -261,8 +252,9 @@ std::string IPv4EndpointOption::get_ipv4_address_string() const {
 }
 
 // IPv4MulticastOption implementation
-std::vector<uint8_t> IPv4MulticastOption::serialize() const {
-    std::vector<uint8_t> data = SdOption::serialize();
+void IPv4MulticastOption::serialize_into(std::vector<uint8_t>& data) const {
+    size_t base = data.size();
+    serialize_base_into(data);
 
     // IPv4 Address (4 bytes)
     data.push_back((ipv4_address_ >> 24) & 0xFF);
@@ -277,12 +269,11 @@ std::vector<uint8_t> IPv4MulticastOption::serialize() const {
     data.push_back((port_ >> 8) & 0xFF);
     data.push_back(port_ & 0xFF);
 
-    // Update length (7 bytes: 4 address + 1 reserved + 2 port)
+    // Update length (7 bytes: 4 address + 1 reserved + 2 port) — into
+    // the length field at the option's start, not the type byte
     uint16_t length = 7;
-    data[2] = (length >> 8) & 0xFF;
-    data[3] = length & 0xFF;
-
-    return data;
+    data[base + 0] = (length >> 8) & 0xFF;
+    data[base + 1] = length & 0xFF;
 }
 
 bool IPv4MulticastOption::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
@@ -314,6 +305,12 @@ void SdMessage::add_option(std::unique_ptr<SdOption> option) {
 
 std::vector<uint8_t> SdMessage::serialize() const {
     std::vector<uint8_t> data;
+    serialize_into(data);
+    return data;
+}
+
+void SdMessage::serialize_into(std::vector<uint8_t>& data) const {
+    size_t message_start = data.size();
 
     // SOME/IP SD Header (8 bytes)
     // Flags (1 byte)
@@ -331,26 +328,48 @@ std::vector<uint8_t> SdMessage::serialize() const {
     data.push_back(0);
     data.push_back(0);
 
-    // Entries
+    // Entries array, preceded by its byte length (as in SOME/IP-SD):
+    // the explicit lengths make multi-entry frames unambiguous — an
+    // option's length field can otherwise masquerade as an entry type
+    size_t entries_length_offset = data.size();
+    data.push_back(0);
+    data.push_back(0);
+    data.push_back(0);
+    data.push_back(0);
+
+    size_t entries_start = data.size();
     for (const auto& entry : entries_) {
-        auto entry_data = entry->serialize();
-        data.insert(data.end(), entry_data.begin(), entry_data.end());
+        entry->serialize_into(data);
     }
+    uint32_t entries_length = static_cast<uint32_t>(data.size() - entries_start);
+    data[entries_length_offset] = (entries_length >> 24) & 0xFF;
+    data[entries_length_offset + 1] = (entries_length >> 16) & 0xFF;
+    data[entries_length_offset + 2] = (entries_length >> 8) & 0xFF;
+    data[entries_length_offset + 3] = entries_length & 0xFF;
+
+    // Options array with its byte length
+    size_t options_length_offset = data.size();
+    data.push_back(0);
+    data.push_back(0);
+    data.push_back(0);
+    data.push_back(0);
 
-    // Options
+    size_t options_start = data.size();
     for (const auto& option : options_) {
-        auto option_data = option->serialize();
-        data.insert(data.end(), option_data.begin(), option_data.end());
+        option->serialize_into(data);
     }
+    uint32_t options_length = static_cast<uint32_t>(data.size() - options_start);
+    data[options_length_offset] = (options_length >> 24) & 0xFF;
+    data[options_length_offset + 1] = (options_length >> 16) & 0xFF;
+    data[options_length_offset + 2] = (options_length >> 8) & 0xFF;
+    data[options_length_offset + 3] = options_length & 0xFF;
 
     // Update length (total length - 8 byte header)
-    uint32_t total_length = data.size() - 8;
+    uint32_t total_length = static_cast<uint32_t>(data.size() - message_start - 8);
     data[length_offset] = (total_length >> 24) & 0xFF;
     data[length_offset + 1] = (total_length >> 16) & 0xFF;
     data[length_offset + 2] = (total_length >> 8) & 0xFF;
     data[length_offset + 3] = total_length & 0xFF;
-
-    return data;
 }
 
 bool SdMessage::deserialize(const std::vector<uint8_t>& data) {
@@ -373,74 +392,223 @@ bool SdMessage::deserialize(const std::vector<uint8_t>& data) {
         return false;
     }
 
-    // Parse entries and options until we consume all data
-    size_t max_iterations = 100; // Prevent infinite loops
-    size_t iteration = 0;
+    // Entries array: explicit byte length, then back-to-back entries
+    if (offset + 4 > data.size()) {
+        return false;
+    }
+    uint32_t entries_length = (data[offset] << 24) | (data[offset + 1] << 16) |
+                              (data[offset + 2] << 8) | data[offset + 3];
+    offset += 4;
 
-    while (offset < 8 + length && offset < data.size() && iteration < max_iterations) {
-        iteration++;
+    size_t entries_end = offset + entries_length;
+    if (entries_end > data.size()) {
+        return false;
+    }
 
-        uint8_t type_byte = data[offset];
+    while (offset < entries_end) {
+        uint8_t raw_entry_type = data[offset];
+        std::unique_ptr<SdEntry> entry;
 
-        // Check if this is an entry (entries come first in SOME/IP SD)
-        EntryType entry_type = static_cast<EntryType>(type_byte);
-        uint8_t raw_entry_type = static_cast<uint8_t>(entry_type);
+        if (raw_entry_type == 0x00 || raw_entry_type == 0x01) {
+            entry = std::make_unique<ServiceEntry>();
+        } else if (raw_entry_type == 0x06 || raw_entry_type == 0x07) {
+            entry = std::make_unique<EventGroupEntry>();
+        }
 
-        if (raw_entry_type == 0x00 || raw_entry_type == 0x01 ||
-            raw_entry_type == 0x06 || raw_entry_type == 0x07) {
+        if (!entry || !entry->deserialize(data, offset)) {
+            return false; // Failed to parse entry
+        }
 
-            // This is an entry
-            std::unique_ptr<SdEntry> entry;
+        entries_.push_back(std::move(entry));
+    }
 
-            if (raw_entry_type == 0x00 || raw_entry_type == 0x01) {
-                entry = std::make_unique<ServiceEntry>();
-            } else if (raw_entry_type == 0x06 || raw_entry_type == 0x07) {
-                entry = std::make_unique<EventGroupEntry>();
-            }
+    // Options array: explicit byte length, then back-to-back options
+    if (offset + 4 > data.size()) {
+        return false;
+    }
+    uint32_t options_length = (data[offset] << 24) | (data[offset + 1] << 16) |
+                              (data[offset + 2] << 8) | data[offset + 3];
+    offset += 4;
 
-            if (!entry || !entry->deserialize(data, offset)) {
-                return false; // Failed to parse entry
-            }
+    size_t options_end = offset + options_length;
+    if (options_end > data.size()) {
+        return false;
+    }
+
+    while (offset < options_end) {
+        // Option wire format: length (2), type (1), ...
+        if (offset + 3 > data.size()) {
+            return false;
+        }
+        uint8_t type_byte = data[offset + 2];
 
-            entries_.push_back(std::move(entry));
+        OptionType option_type = static_cast<OptionType>(type_byte);
+        std::unique_ptr<SdOption> option;
 
+        if (option_type == OptionType::IPV4_ENDPOINT) {
+            option = std::make_unique<IPv4EndpointOption>();
+        } else if (option_type == OptionType::IPV4_MULTICAST) {
+            option = std::make_unique<IPv4MulticastOption>();
+        } else if (option_type == OptionType::CONFIGURATION) {
+            option = std::make_unique<ConfigurationOption>();
         } else {
-            // This should be an option
-            OptionType option_type = static_cast<OptionType>(type_byte);
-            std::unique_ptr<SdOption> option;
-
-            if (option_type == OptionType::IPV4_ENDPOINT) {
-                option = std::make_unique<IPv4EndpointOption>();
-            } else if (option_type == OptionType::IPV4_MULTICAST) {
-                option = std::make_unique<IPv4MulticastOption>();
-            } else {
-                // Unknown option type - try to skip it
-                if (offset + 4 > data.size()) {
-                    return false;
-                }
-                uint16_t option_length = (data[offset] << 8) | data[offset + 1];
-                if (offset + 4 + option_length > data.size()) {
-                    return false;
-                }
-                offset += 4 + option_length;
-                continue;
-            }
-
-            if (!option || !option->deserialize(data, offset)) {
-                return false; // Failed to parse option
+            // Unknown option type - skip it by its length field
+            uint16_t option_length = (data[offset] << 8) | data[offset + 1];
+            if (offset + 3 + option_length > data.size()) {
+                return false;
             }
+            offset += 3 + option_length;
+            continue;
+        }
 
-            options_.push_back(std::move(option));
+        if (!option->deserialize(data, offset)) {
+            return false; // Failed to parse option
         }
+
+        options_.push_back(std::move(option));
     }
 
-    // Check if we consumed all expected data
-    if (offset != 8 + length) {
-        return false; // Didn't consume all data or overran
+    return true;
+}
+
+
+void ConfigurationOption::serialize_into(std::vector<uint8_t>& data) const {
+    size_t base = data.size();
+    serialize_base_into(data);
+    data.insert(data.end(), data_.begin(), data_.end());
+
+    uint16_t length = static_cast<uint16_t>(1 + data_.size());  // Reserved + payload
+    data[base + 0] = (length >> 8) & 0xFF;
+    data[base + 1] = length & 0xFF;
+}
+
+bool ConfigurationOption::deserialize(const std::vector<uint8_t>& data, size_t& offset) {
+    if (offset + 4 > data.size()) {
+        return false;
     }
 
+    uint16_t length = (data[offset] << 8) | data[offset + 1];
+    offset += 4;  // Length + type + reserved consumed
+
+    size_t payload_length = length > 0 ? length - 1 : 0;  // Reserved byte counted
+    if (offset + payload_length > data.size()) {
+        return false;
+    }
+    data_.assign(data.begin() + offset, data.begin() + offset + payload_length);
+    offset += payload_length;
     return true;
 }
 
+// ---------------------------------------------------------------------------
+// SdMessageBuilder
+
+ServiceEntry& SdMessageBuilder::add_service_entry(EntryType type) {
+    if (service_used_ == service_pool_.size()) {
+        service_pool_.emplace_back(type);
+    }
+    ServiceEntry& entry = service_pool_[service_used_];
+    entry = ServiceEntry(type);  // Reset recycled node to defaults
+    entry_order_.emplace_back(0, service_used_);
+    ++service_used_;
+    return entry;
+}
+
+EventGroupEntry& SdMessageBuilder::add_eventgroup_entry(EntryType type) {
+    if (eventgroup_used_ == eventgroup_pool_.size()) {
+        eventgroup_pool_.emplace_back(type);
+    }
+    EventGroupEntry& entry = eventgroup_pool_[eventgroup_used_];
+    entry = EventGroupEntry(type);
+    entry_order_.emplace_back(1, eventgroup_used_);
+    ++eventgroup_used_;
+    return entry;
+}
+
+IPv4EndpointOption& SdMessageBuilder::add_ipv4_endpoint_option() {
+    if (endpoint_used_ == endpoint_pool_.size()) {
+        endpoint_pool_.emplace_back();
+    }
+    IPv4EndpointOption& option = endpoint_pool_[endpoint_used_];
+    option = IPv4EndpointOption();
+    option_order_.emplace_back(0, endpoint_used_);
+    ++endpoint_used_;
+    return option;
+}
+
+ConfigurationOption& SdMessageBuilder::add_configuration_option() {
+    if (config_used_ == config_pool_.size()) {
+        config_pool_.emplace_back();
+    }
+    ConfigurationOption& option = config_pool_[config_used_];
+    option = ConfigurationOption();
+    option_order_.emplace_back(1, config_used_);
+    ++config_used_;
+    return option;
+}
+
+const std::vector<uint8_t>& SdMessageBuilder::build() {
+    // Same envelope SdMessage::serialize_into writes: SD header, then
+    // the entries and options arrays with explicit byte lengths
+    buffer_.clear();
+    buffer_.push_back(flags_);
+    buffer_.push_back(0);
+    buffer_.push_back(0);
+    buffer_.push_back(0);
+
+    size_t length_offset = buffer_.size();
+    buffer_.insert(buffer_.end(), 4, 0);
+
+    size_t entries_length_offset = buffer_.size();
+    buffer_.insert(buffer_.end(), 4, 0);
+    size_t entries_start = buffer_.size();
+    for (const auto& [pool, index] : entry_order_) {
+        if (pool == 0) {
+            service_pool_[index].serialize_into(buffer_);
+        } else {
+            eventgroup_pool_[index].serialize_into(buffer_);
+        }
+    }
+    uint32_t entries_length = static_cast<uint32_t>(buffer_.size() - entries_start);
+    buffer_[entries_length_offset] = (entries_length >> 24) & 0xFF;
+    buffer_[entries_length_offset + 1] = (entries_length >> 16) & 0xFF;
+    buffer_[entries_length_offset + 2] = (entries_length >> 8) & 0xFF;
+    buffer_[entries_length_offset + 3] = entries_length & 0xFF;
+
+    size_t options_length_offset = buffer_.size();
+    buffer_.insert(buffer_.end(), 4, 0);
+    size_t options_start = buffer_.size();
+    for (const auto& [pool, index] : option_order_) {
+        if (pool == 0) {
+            endpoint_pool_[index].serialize_into(buffer_);
+        } else {
+            config_pool_[index].serialize_into(buffer_);
+        }
+    }
+    uint32_t options_length = static_cast<uint32_t>(buffer_.size() - options_start);
+    buffer_[options_length_offset] = (options_length >> 24) & 0xFF;
+    buffer_[options_length_offset + 1] = (options_length >> 16) & 0xFF;
+    buffer_[options_length_offset + 2] = (options_length >> 8) & 0xFF;
+    buffer_[options_length_offset + 3] = options_length & 0xFF;
+
+    uint32_t total_length = static_cast<uint32_t>(buffer_.size() - 8);
+    buffer_[length_offset] = (total_length >> 24) & 0xFF;
+    buffer_[length_offset + 1] = (total_length >> 16) & 0xFF;
+    buffer_[length_offset + 2] = (total_length >> 8) & 0xFF;
+    buffer_[length_offset + 3] = total_length & 0xFF;
+
+    return buffer_;
+}
+
+void SdMessageBuilder::reset() {
+    // Pool nodes and the buffer keep their capacity; only the counts
+    // rewind, so steady-state reuse allocates nothing
+    service_used_ = 0;
+    eventgroup_used_ = 0;
+    endpoint_used_ = 0;
+    config_used_ = 0;
+    entry_order_.clear();
+    option_order_.clear();
+}
+
 } // namespace sd
 } // namespace someip
@@ -12,6 +12,8 @@
  ********************************************************************************/
 
 #include "sd/sd_server.h"
+#include "sd/service_registry.h"
+#include "common/timer_wheel.h"
 #include "sd/sd_message.h"
 #include "transport/udp_transport.h"
 #include "transport/endpoint.h"
@@ -32,8 +34,10 @@ class SdServerImpl : public transport::ITransportListener {
 public:
     SdServerImpl(const SdConfig& config)
         : config_(config),
+          // Bind the SD port on any interface: finds and subscribes
+          // arrive on the multicast group's port
           transport_(std::make_shared<transport::UdpTransport>(
-              transport::Endpoint(config.unicast_address, config.unicast_port))),
+              transport::Endpoint("0.0.0.0", config.multicast_port))),
           running_(false),
           next_offer_delay_(config.initial_delay) {
 
@@ -97,13 +101,7 @@ public:
         std::scoped_lock lock(offered_services_mutex_);
 
         // Check if service already offered
-        auto it = std::find_if(offered_services_.begin(), offered_services_.end(),
-            [&](const OfferedService& svc) {
-                return svc.instance.service_id == instance.service_id &&
-                       svc.instance.instance_id == instance.instance_id;
-            });
-
-        if (it != offered_services_.end()) {
+        if (offered_services_.contains(instance.service_id, instance.instance_id)) {
             return false;  // Already offered
         }
 
@@ -113,10 +111,12 @@ public:
         offered.multicast_endpoint = multicast_endpoint;
         offered.last_offer_time = std::chrono::steady_clock::now();
 
-        offered_services_.push_back(std::move(offered));
+        OfferedService& stored = offered_services_.insert(
+            instance.service_id, instance.instance_id, std::move(offered));
+        offer_cache_dirty_ = true;
 
         // Send initial offer immediately
-        send_service_offer(offered_services_.back());
+        send_service_offer(stored);
 
         return true;
     }
@@ -124,37 +124,29 @@ public:
     bool stop_offer_service(uint16_t service_id, uint16_t instance_id) {
         std::scoped_lock lock(offered_services_mutex_);
 
-        auto it = std::find_if(offered_services_.begin(), offered_services_.end(),
-            [&](const OfferedService& svc) {
-                return svc.instance.service_id == service_id &&
-                       svc.instance.instance_id == instance_id;
-            });
-
-        if (it == offered_services_.end()) {
+        OfferedService* service = offered_services_.find(service_id, instance_id);
+        if (!service) {
             return false;
         }
 
         // Send stop offer message
-        send_service_stop_offer(*it);
+        send_service_stop_offer(*service);
 
-        offered_services_.erase(it);
+        offered_services_.erase(service_id, instance_id);
+        offer_cache_dirty_ = true;
         return true;
     }
 
     bool update_service_ttl(uint16_t service_id, uint16_t instance_id, uint32_t ttl_seconds) {
         std::scoped_lock lock(offered_services_mutex_);
 
-        auto it = std::find_if(offered_services_.begin(), offered_services_.end(),
-            [&](const OfferedService& svc) {
-                return svc.instance.service_id == service_id &&
-                       svc.instance.instance_id == instance_id;
-            });
-
-        if (it == offered_services_.end()) {
+        OfferedService* service = offered_services_.find(service_id, instance_id);
+        if (!service) {
             return false;
         }
 
-        it->instance.ttl_seconds = ttl_seconds;
+        service->instance.ttl_seconds = ttl_seconds;
+        offer_cache_dirty_ = true;
         return true;
     }
 
@@ -213,10 +205,11 @@ public:
     std::vector<ServiceInstance> get_offered_services() const {
         std::scoped_lock lock(offered_services_mutex_);
         std::vector<ServiceInstance> result;
+        result.reserve(offered_services_.size());
 
-        for (const auto& service : offered_services_) {
+        offered_services_.for_each([&result](const OfferedService& service) {
             result.push_back(service.instance);
-        }
+        });
 
         return result;
     }
@@ -226,8 +219,14 @@ public:
     }
 
     SdServer::Statistics get_statistics() const {
-        // TODO: Implement statistics tracking
-        return SdServer::Statistics{};
+        SdServer::Statistics stats;
+        stats.find_requests_received = find_requests_received_.load(std::memory_order_relaxed);
+        stats.offers_sent = offers_sent_.load(std::memory_order_relaxed);
+        {
+            std::scoped_lock lock(offered_services_mutex_);
+            stats.services_offered = static_cast<uint32_t>(offered_services_.size());
+        }
+        return stats;
     }
 
 private:
@@ -244,28 +243,38 @@ private:
             return false;
         }
 
-        // Use standard SOME/IP SD multicast address
-        return udp_transport->join_multicast_group("224.224.224.245") == Result::SUCCESS;
+        // Join the configured SD group, pinned to the configured
+        // unicast interface
+        // Pin egress too: offers/finds leave through the configured
+        // interface with loopback enabled for same-host peers
+        udp_transport->set_multicast_interface(config_.unicast_address);
+        return udp_transport->join_multicast_group(config_.multicast_address,
+                                                   config_.unicast_address) == Result::SUCCESS;
     }
 
     void leave_multicast_group() {
         auto udp_transport = std::dynamic_pointer_cast<transport::UdpTransport>(transport_);
         if (udp_transport) {
-            udp_transport->leave_multicast_group("224.224.224.245");
+            udp_transport->leave_multicast_group(config_.multicast_address);
         }
     }
 
     void start_offer_timer() {
-        if (offer_timer_thread_.joinable()) {
-            return;
-        }
-
-        offer_timer_thread_ = std::thread([this]() {
-            while (running_) {
-                std::this_thread::sleep_for(next_offer_delay_);
+        // One-shot chain on the shared wheel replaces the dedicated
+        // sleeping thread: each firing schedules the next with the
+        // repetition backoff, and a 10% jitter keeps many servers'
+        // announcements from synchronizing on the multicast group
+        timer_wheel_.start();
+        schedule_next_offer();
+    }
 
+    void schedule_next_offer() {
+        auto jitter = std::chrono::milliseconds(next_offer_delay_.count() / 10);
+        offer_timer_id_ = timer_wheel_.schedule(
+            next_offer_delay_,
+            [this]() {
                 if (!running_) {
-                    break;
+                    return;
                 }
 
                 // Send periodic offers
@@ -277,86 +286,183 @@ private:
                         std::min(next_offer_delay_.count() * config_.repetition_multiplier,
                                 config_.repetition_max.count()));
                 }
-            }
-        });
+
+                schedule_next_offer();
+            },
+            jitter);
     }
 
     void stop_offer_timer() {
-        if (offer_timer_thread_.joinable()) {
-            offer_timer_thread_.join();
-        }
+        timer_wheel_.cancel(offer_timer_id_);
+        timer_wheel_.stop();
     }
 
     void send_periodic_offers() {
         std::scoped_lock lock(offered_services_mutex_);
 
         auto now = std::chrono::steady_clock::now();
-        for (auto& service : offered_services_) {
+
+        // The announcement is one unit: once anything is due, resend
+        // the cached frames for the whole set (an early refresh for
+        // the rest is a harmless TTL keep-alive) and re-serialize
+        // only when the offered set actually changed
+        bool any_due = false;
+        offered_services_.for_each([&](const OfferedService& service) {
             auto time_since_last_offer = std::chrono::duration_cast<std::chrono::milliseconds>(
                 now - service.last_offer_time);
-
             if (time_since_last_offer >= config_.cyclic_offer) {
-                send_service_offer(service);
-                service.last_offer_time = now;
+                any_due = true;
             }
+        });
+
+        if (!any_due || offered_services_.empty()) {
+            return;
         }
+
+        if (offer_cache_dirty_) {
+            std::vector<const OfferedService*> all;
+            all.reserve(offered_services_.size());
+            offered_services_.for_each([&](const OfferedService& service) {
+                all.push_back(&service);
+            });
+            offer_frame_cache_ = build_offer_frames(all.data(), all.size());
+            offer_cache_dirty_ = false;
+        }
+
+        send_offer_frames(offer_frame_cache_);
+
+        offered_services_.for_each([&](OfferedService& service) {
+            service.last_offer_time = now;
+        });
     }
 
     void send_stop_offer_messages() {
         std::scoped_lock lock(offered_services_mutex_);
 
-        for (const auto& service : offered_services_) {
+        offered_services_.for_each([this](const OfferedService& service) {
             send_service_stop_offer(service);
-        }
+        });
     }
 
     void send_service_offer(const OfferedService& service) {
-        // Create offer service entry
-        auto offer_entry = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
-        offer_entry->set_service_id(service.instance.service_id);
-        offer_entry->set_instance_id(service.instance.instance_id);
-        offer_entry->set_major_version(service.instance.major_version);
-        offer_entry->set_ttl(service.instance.ttl_seconds);
+        const OfferedService* single[] = {&service};
+        send_batched_offers(single, 1);
+    }
 
-        SdMessage sd_message;
-        sd_message.add_entry(std::move(offer_entry));
+    // Wire-format budget per announcement frame: stay under a common
+    // 1500-byte MTU after IP/UDP/SOME/IP headers
+    static constexpr size_t OFFER_FRAME_BUDGET = 1400;
+    static constexpr size_t OFFER_ENTRY_BYTES = 16;    // One service entry
+    static constexpr size_t ENDPOINT_OPTION_BYTES = 12;  // IPv4 endpoint option
+
+    /**
+     * Pack as many Offer entries as fit under the MTU into each
+     * SdMessage, deduplicating the endpoint option for services that
+     * share one. 400 services go out in a handful of frames instead
+     * of 400. Returns the fully serialized SOME/IP datagrams so the
+     * cyclic path can cache and resend them without re-serializing.
+     */
+    std::vector<std::vector<uint8_t>> build_offer_frames(const OfferedService* const* services,
+                                                         size_t count) {
+        std::vector<std::vector<uint8_t>> frames;
+
+        size_t index = 0;
+        while (index < count) {
+            // The pooled builder makes burst encoding allocation-free
+            // once warmed to the largest frame
+            offer_builder_.reset();
+            std::vector<std::string> frame_endpoints;  // Dedup: endpoint -> option index
+            size_t frame_bytes = 12 + 8;  // SD header + entry/option array lengths
+
+            // Capability advertisement occupies option index 0 so every
+            // entry can reference it via index2
+            size_t option_base = 0;
+            if (config_.advertise_compression) {
+                ConfigurationOption& capability = offer_builder_.add_configuration_option();
+                capability.set_string("lz4");
+                option_base = 1;
+                frame_bytes += 8;
+            }
 
-        // Add IPv4 endpoint option
-        auto endpoint_option = std::make_unique<IPv4EndpointOption>();
+            while (index < count) {
+                const OfferedService& service = *services[index];
 
-        // Parse unicast endpoint (format: "ip:port")
-        size_t colon_pos = service.unicast_endpoint.find(':');
-        if (colon_pos != std::string::npos) {
-            std::string ip_str = service.unicast_endpoint.substr(0, colon_pos);
-            std::string port_str = service.unicast_endpoint.substr(colon_pos + 1);
+                // Find (or plan) this service's endpoint option
+                size_t option_index = frame_endpoints.size();
+                for (size_t i = 0; i < frame_endpoints.size(); ++i) {
+                    if (frame_endpoints[i] == service.unicast_endpoint) {
+                        option_index = i;
+                        break;
+                    }
+                }
+                bool new_option = option_index == frame_endpoints.size();
+                size_t wire_option_index = option_base + option_index;
 
-            endpoint_option->set_ipv4_address_from_string(ip_str);
-            endpoint_option->set_port(static_cast<uint16_t>(std::stoi(port_str)));
-            // Use UDP as default protocol for SOME/IP SD
-            endpoint_option->set_protocol(0x11);  // UDP
-        }
+                size_t added = OFFER_ENTRY_BYTES + (new_option ? ENDPOINT_OPTION_BYTES : 0);
+                if (frame_bytes + added > OFFER_FRAME_BUDGET &&
+                    offer_builder_.entry_count() != 0) {
+                    break;  // Frame full; start the next one
+                }
 
-        sd_message.add_option(std::move(endpoint_option));
+                if (new_option) {
+                    IPv4EndpointOption& endpoint_option =
+                        offer_builder_.add_ipv4_endpoint_option();
+                    size_t colon_pos = service.unicast_endpoint.find(':');
+                    if (colon_pos != std::string::npos) {
+                        endpoint_option.set_ipv4_address_from_string(
+                            service.unicast_endpoint.substr(0, colon_pos));
+                        endpoint_option.set_port(static_cast<uint16_t>(
+                            std::stoi(service.unicast_endpoint.substr(colon_pos + 1))));
+                        // Use UDP as default protocol for SOME/IP SD
+                        endpoint_option.set_protocol(0x11);  // UDP
+                    }
+                    frame_endpoints.push_back(service.unicast_endpoint);
+                }
 
-        // Set option index in the entry (first option, so index 0)
-        if (auto* entry = dynamic_cast<ServiceEntry*>(sd_message.get_entries()[0].get())) {
-            entry->set_index1(0);  // Reference first option
-            entry->set_index2(0);  // No second option
+                ServiceEntry& offer_entry =
+                    offer_builder_.add_service_entry(EntryType::OFFER_SERVICE);
+                offer_entry.set_service_id(service.instance.service_id);
+                offer_entry.set_instance_id(service.instance.instance_id);
+                offer_entry.set_major_version(service.instance.major_version);
+                offer_entry.set_ttl(service.instance.ttl_seconds);
+                offer_entry.set_index1(static_cast<uint8_t>(wire_option_index));
+                // index2 references the capability option when one is
+                // advertised; 0xFF is the explicit out-of-range "no
+                // second option" sentinel otherwise
+                offer_entry.set_index2(config_.advertise_compression ? 0 : 0xFF);
+
+                frame_bytes += added;
+                ++index;
+            }
+
+            // Create SOME/IP message for SD and keep the final bytes
+            Message someip_message(MessageId(0xFFFF, 0x0000), RequestId(0x0000, 0x0000),
+                                  MessageType::NOTIFICATION, ReturnCode::E_OK);
+            someip_message.set_payload(offer_builder_.build());
+            frames.push_back(someip_message.serialize());
         }
 
-        // Create SOME/IP message for SD
-        Message someip_message(MessageId(0xFFFF, 0x0000), RequestId(0x0000, 0x0000),
-                              MessageType::NOTIFICATION, ReturnCode::E_OK);
-        someip_message.set_payload(sd_message.serialize());
+        return frames;
+    }
 
-        // Send multicast offer
+    void send_offer_frames(const std::vector<std::vector<uint8_t>>& frames) {
         transport::Endpoint multicast_endpoint(config_.multicast_address, config_.multicast_port);
-        Result result = transport_->send_message(someip_message, multicast_endpoint);
-        if (result != Result::SUCCESS) {
-            // Log error or handle failure
+
+        auto udp_transport = std::dynamic_pointer_cast<transport::UdpTransport>(transport_);
+        for (const auto& frame : frames) {
+            Result result = udp_transport
+                                ? udp_transport->send_packed(frame, multicast_endpoint)
+                                : Result::NOT_IMPLEMENTED;
+            if (result != Result::SUCCESS) {
+                // Log error or handle failure
+            }
         }
     }
 
+    void send_batched_offers(const OfferedService* const* services, size_t count) {
+        send_offer_frames(build_offer_frames(services, count));
+    }
+
     void send_service_stop_offer(const OfferedService& service) {
         // Create stop offer service entry
         auto stop_entry = std::make_unique<ServiceEntry>(EntryType::STOP_OFFER_SERVICE);
@@ -427,19 +533,70 @@ private:
     }
 
     void handle_find_service(const ServiceEntry& find_entry, const transport::Endpoint& sender) {
-        std::scoped_lock lock(offered_services_mutex_);
+        find_requests_received_.fetch_add(1, std::memory_order_relaxed);
+
+        // Find-storm absorption: identical finds within the window
+        // coalesce into one pending response; the response itself is
+        // paced with a randomized delay (the SOME/IP-SD
+        // request-response delay) via the wheel's jitter
+        uint32_t key = (static_cast<uint32_t>(find_entry.get_service_id()) << 16) |
+                       find_entry.get_instance_id();
+
+        std::scoped_lock lock(pending_finds_mutex_);
+        PendingFindResponse& pending = pending_finds_[key];
+
+        bool already_known = false;
+        for (const auto& known : pending.senders) {
+            if (known == sender) {
+                already_known = true;
+                break;
+            }
+        }
+        if (!already_known) {
+            pending.senders.push_back(sender);
+        }
+
+        if (pending.timer != 0) {
+            return;  // Response already scheduled for this find
+        }
 
-        // Check if we offer the requested service
-        for (const auto& service : offered_services_) {
-            if (service.instance.service_id == find_entry.get_service_id() &&
-                (find_entry.get_instance_id() == 0xFFFF ||  // Any instance
-                 service.instance.instance_id == find_entry.get_instance_id())) {
+        uint16_t service_id = find_entry.get_service_id();
+        uint16_t instance_id = find_entry.get_instance_id();
+        pending.timer = timer_wheel_.schedule(
+            config_.find_aggregation_window,
+            [this, key, service_id, instance_id]() {
+                respond_to_aggregated_find(key, service_id, instance_id);
+            },
+            config_.max_response_delay);
+    }
 
-                // Send unicast offer to the finder
-                send_service_offer_to_client(service, sender);
-                break;
+    void respond_to_aggregated_find(uint32_t key, uint16_t service_id, uint16_t instance_id) {
+        std::vector<transport::Endpoint> senders;
+        {
+            std::scoped_lock lock(pending_finds_mutex_);
+            auto it = pending_finds_.find(key);
+            if (it == pending_finds_.end()) {
+                return;
             }
+            senders = std::move(it->second.senders);
+            pending_finds_.erase(it);
         }
+
+        std::scoped_lock lock(offered_services_mutex_);
+        const OfferedService* service = offered_services_.find(service_id, instance_id);
+        if (!service || senders.empty()) {
+            return;
+        }
+
+        if (senders.size() > 1) {
+            // Several finders: one multicast offer answers them all
+            send_service_offer(*service);
+            finds_answered_multicast_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            // Lone finder: unicast (already delay-paced by the timer)
+            send_service_offer_to_client(*service, senders.front());
+        }
+        offers_sent_.fetch_add(1, std::memory_order_relaxed);
     }
 
     void handle_eventgroup_subscription_request(const EventGroupEntry& subscription_entry,
@@ -488,6 +645,16 @@ private:
         sd_message.set_unicast(true);  // Unicast response
         sd_message.add_entry(std::move(offer_entry));
 
+        // Capability advertisement mirrors the multicast frames: the
+        // option sits at index 0 so index2 can reference it
+        size_t option_base = 0;
+        if (config_.advertise_compression) {
+            auto capability = std::make_unique<ConfigurationOption>();
+            capability->set_string("lz4");
+            sd_message.add_option(std::move(capability));
+            option_base = 1;
+        }
+
         // Add IPv4 endpoint option
         auto endpoint_option = std::make_unique<IPv4EndpointOption>();
 
@@ -505,10 +672,11 @@ private:
 
         sd_message.add_option(std::move(endpoint_option));
 
-        // Set option index in the entry (first option, so index 0)
         if (auto* entry = dynamic_cast<ServiceEntry*>(sd_message.get_entries()[0].get())) {
-            entry->set_index1(0);  // Reference first option
-            entry->set_index2(0);  // No second option
+            entry->set_index1(static_cast<uint8_t>(option_base));
+            // index2 references the capability option when advertised;
+            // 0xFF is the explicit "no second option" sentinel
+            entry->set_index2(config_.advertise_compression ? 0 : 0xFF);
         }
 
         // Create SOME/IP message for SD
@@ -526,10 +694,29 @@ private:
     SdConfig config_;
     std::shared_ptr<transport::UdpTransport> transport_;
 
-    std::vector<OfferedService> offered_services_;
+    ServiceRegistry<OfferedService> offered_services_;
+
+    // Pending find aggregation: identical finds share one response
+    struct PendingFindResponse {
+        std::vector<transport::Endpoint> senders;
+        TimerWheel::TimerId timer{0};
+    };
+    std::mutex pending_finds_mutex_;
+    std::unordered_map<uint32_t, PendingFindResponse> pending_finds_;
+    std::atomic<uint32_t> find_requests_received_{0};
+    std::atomic<uint32_t> offers_sent_{0};
+    std::atomic<uint32_t> finds_answered_multicast_{0};
+
+    // Reusable encoder for offer frames (guarded by offered_services_mutex_)
+    SdMessageBuilder offer_builder_;
+
+    // Serialized announcement frames, rebuilt only on registry mutation
+    std::vector<std::vector<uint8_t>> offer_frame_cache_;
+    bool offer_cache_dirty_{true};
     mutable std::mutex offered_services_mutex_;
 
-    std::thread offer_timer_thread_;
+    TimerWheel timer_wheel_;
+    TimerWheel::TimerId offer_timer_id_{0};
     std::chrono::milliseconds next_offer_delay_;
     std::atomic<bool> running_;
 };
@@ -0,0 +1,71 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "serialization/arena.h"
+#include <algorithm>
+
+namespace someip {
+namespace serialization {
+
+Arena::Arena(size_t block_size)
+    : block_size_(block_size > 0 ? block_size : kDefaultBlockSize),
+      block_index_(0), offset_(0), bytes_used_(0) {
+}
+
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    if (bytes == 0) {
+        bytes = 1;  // Distinct non-null pointers for zero-size requests
+    }
+
+    while (block_index_ < blocks_.size()) {
+        Block& block = blocks_[block_index_];
+        size_t aligned = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= block.size) {
+            offset_ = aligned + bytes;
+            bytes_used_ += bytes;
+            return block.data.get() + aligned;
+        }
+        // Current block exhausted; move on (its tail is wasted, which
+        // is bounded by one allocation per block)
+        ++block_index_;
+        offset_ = 0;
+    }
+
+    // Need a fresh block; oversized requests get a dedicated one
+    size_t new_size = std::max(block_size_, bytes + alignment);
+    blocks_.push_back(Block{std::unique_ptr<uint8_t[]>(new uint8_t[new_size]), new_size});
+
+    Block& block = blocks_.back();
+    size_t base = reinterpret_cast<uintptr_t>(block.data.get()) & (alignment - 1);
+    size_t aligned = base == 0 ? 0 : alignment - base;
+    offset_ = aligned + bytes;
+    bytes_used_ += bytes;
+    return block.data.get() + aligned;
+}
+
+void Arena::reset() {
+    block_index_ = 0;
+    offset_ = 0;
+    bytes_used_ = 0;
+}
+
+size_t Arena::get_bytes_reserved() const {
+    size_t total = 0;
+    for (const auto& block : blocks_) {
+        total += block.size;
+    }
+    return total;
+}
+
+} // namespace serialization
+} // namespace someip
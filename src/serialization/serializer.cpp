@@ -25,20 +25,29 @@ namespace someip {
 namespace serialization {
 
 // NOLINTNEXTLINE(modernize-use-equals-default,readability-redundant-member-init) - intentional pre-allocation
-Serializer::Serializer() {
-    buffer_.reserve(1024);  // Pre-allocate reasonable size
+Serializer::Serializer()
+    : buffer_(&owned_buffer_) {
+    buffer_->reserve(1024);  // Pre-allocate reasonable size
+}
+
+Serializer::Serializer(std::vector<uint8_t>& external_buffer)
+    : buffer_(&external_buffer) {
 }
 
 void Serializer::reset() {
-    buffer_.clear();
+    buffer_->clear();
+}
+
+void Serializer::reserve(size_t capacity) {
+    buffer_->reserve(capacity);
 }
 
 void Serializer::serialize_bool(bool value) {
-    buffer_.push_back(value ? 0x01 : 0x00);
+    buffer_->push_back(value ? 0x01 : 0x00);
 }
 
 void Serializer::serialize_uint8(uint8_t value) {
-    buffer_.push_back(value);
+    buffer_->push_back(value);
 }
 
 void Serializer::serialize_uint16(uint16_t value) {
@@ -54,7 +63,7 @@ void Serializer::serialize_uint64(uint64_t value) {
 }
 
 void Serializer::serialize_int8(int8_t value) {
-    buffer_.push_back(static_cast<uint8_t>(value));
+    buffer_->push_back(static_cast<uint8_t>(value));
 }
 
 void Serializer::serialize_int16(int16_t value) {
@@ -82,37 +91,37 @@ void Serializer::serialize_string(const std::string& value) {
     serialize_uint32(static_cast<uint32_t>(value.length()));
 
     // Serialize string data (no null terminator)
-    buffer_.insert(buffer_.end(), value.begin(), value.end());
+    buffer_->insert(buffer_->end(), value.begin(), value.end());
 
     // Add padding to align to 4-byte boundary
     align_to(4);
 }
 
 void Serializer::align_to(size_t alignment) {
-    size_t current_size = buffer_.size();
+    size_t current_size = buffer_->size();
     size_t padding_needed = (alignment - (current_size % alignment)) % alignment;
 
     for (size_t i = 0; i < padding_needed; ++i) {
-        buffer_.push_back(0x00);
+        buffer_->push_back(0x00);
     }
 }
 
 void Serializer::add_padding(size_t bytes) {
     for (size_t i = 0; i < bytes; ++i) {
-        buffer_.push_back(0x00);
+        buffer_->push_back(0x00);
     }
 }
 
 void Serializer::append_be_uint16(uint16_t value) {
     uint16_t be_value = htons(value);
     const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&be_value);
-    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(uint16_t));
+    buffer_->insert(buffer_->end(), bytes, bytes + sizeof(uint16_t));
 }
 
 void Serializer::append_be_uint32(uint32_t value) {
     uint32_t be_value = htonl(value);
     const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&be_value);
-    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(uint32_t));
+    buffer_->insert(buffer_->end(), bytes, bytes + sizeof(uint32_t));
 }
 
 void Serializer::append_be_uint64(uint64_t value) {
@@ -126,7 +135,7 @@ void Serializer::append_be_uint64(uint64_t value) {
                         ((value & 0x000000000000FF00ULL) << 40) |
                         ((value & 0x00000000000000FFULL) << 56);
     const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&be_value);
-    buffer_.insert(buffer_.end(), bytes, bytes + sizeof(uint64_t));
+    buffer_->insert(buffer_->end(), bytes, bytes + sizeof(uint64_t));
 }
 
 void Serializer::append_be_int16(int16_t value) {
@@ -158,11 +167,51 @@ void Serializer::append_be_double(double value) {
 // Deserializer implementation
 
 Deserializer::Deserializer(const std::vector<uint8_t>& data)
-    : buffer_(data), position_(0) {
+    : owned_buffer_(data), data_(owned_buffer_.data()),
+      size_(owned_buffer_.size()), position_(0) {
 }
 
 Deserializer::Deserializer(std::vector<uint8_t>&& data)
-    : buffer_(std::move(data)), position_(0) {
+    : owned_buffer_(std::move(data)), data_(owned_buffer_.data()),
+      size_(owned_buffer_.size()), position_(0) {
+}
+
+Deserializer::Deserializer(const uint8_t* data, size_t size)
+    : data_(data), size_(size), position_(0) {
+}
+
+Deserializer::Deserializer(const Deserializer& other)
+    : owned_buffer_(other.owned_buffer_),
+      data_(other.data_ == other.owned_buffer_.data() ? owned_buffer_.data() : other.data_),
+      size_(other.size_), position_(other.position_) {
+}
+
+Deserializer& Deserializer::operator=(const Deserializer& other) {
+    if (this != &other) {
+        bool other_owns = other.data_ == other.owned_buffer_.data();
+        owned_buffer_ = other.owned_buffer_;
+        data_ = other_owns ? owned_buffer_.data() : other.data_;
+        size_ = other.size_;
+        position_ = other.position_;
+    }
+    return *this;
+}
+
+Deserializer::Deserializer(Deserializer&& other) noexcept
+    : owned_buffer_(std::move(other.owned_buffer_)),
+      data_(other.data_), size_(other.size_), position_(other.position_) {
+    // Moving the vector keeps its storage valid, so data_ still points
+    // at the right bytes whether other owned them or viewed them
+}
+
+Deserializer& Deserializer::operator=(Deserializer&& other) noexcept {
+    if (this != &other) {
+        owned_buffer_ = std::move(other.owned_buffer_);
+        data_ = other.data_;
+        size_ = other.size_;
+        position_ = other.position_;
+    }
+    return *this;
 }
 
 void Deserializer::reset() {
@@ -170,18 +219,18 @@ void Deserializer::reset() {
 }
 
 DeserializationResult<bool> Deserializer::deserialize_bool() {
-    if (position_ + sizeof(uint8_t) > buffer_.size()) {
+    if (position_ + sizeof(uint8_t) > size_) {
         return DeserializationResult<bool>::error(Result::MALFORMED_MESSAGE);
     }
-    bool value = buffer_[position_++] != 0x00;
+    bool value = data_[position_++] != 0x00;
     return DeserializationResult<bool>::success(value);
 }
 
 DeserializationResult<uint8_t> Deserializer::deserialize_uint8() {
-    if (position_ + sizeof(uint8_t) > buffer_.size()) {
+    if (position_ + sizeof(uint8_t) > size_) {
         return DeserializationResult<uint8_t>::error(Result::MALFORMED_MESSAGE);
     }
-    uint8_t value = buffer_[position_++];
+    uint8_t value = data_[position_++];
     return DeserializationResult<uint8_t>::success(value);
 }
 
@@ -265,12 +314,11 @@ DeserializationResult<std::string> Deserializer::deserialize_string() {
     }
     uint32_t length = length_result.get_value();
 
-    if (position_ + length > buffer_.size()) {
+    if (position_ + length > size_) {
         return DeserializationResult<std::string>::error(Result::MALFORMED_MESSAGE);
     }
 
-    std::string result(buffer_.begin() + position_,
-                      buffer_.begin() + position_ + length);
+    std::string result(data_ + position_, data_ + position_ + length);
     position_ += length;
 
     // Skip padding to align to 4-byte boundary
@@ -279,8 +327,58 @@ DeserializationResult<std::string> Deserializer::deserialize_string() {
     return DeserializationResult<std::string>::success(std::move(result));
 }
 
+DeserializationResult<const std::string*> Deserializer::deserialize_string_interned() {
+    using ResultType = DeserializationResult<const std::string*>;
+
+    if (!intern_table_) {
+        return ResultType::error(Result::INVALID_STATE);
+    }
+
+    // Deserialize string length
+    auto length_result = deserialize_uint32();
+    if (length_result.is_error()) {
+        return ResultType::error(length_result.get_error());
+    }
+    uint32_t length = length_result.get_value();
+
+    if (position_ + length > size_) {
+        return ResultType::error(Result::MALFORMED_MESSAGE);
+    }
+
+    // Hit path: hash probe over the wire bytes, no allocation
+    const std::string* value = intern_table_->intern(data_ + position_, length);
+    position_ += length;
+
+    // Skip padding to align to 4-byte boundary
+    align_to(4);
+
+    return ResultType::success(std::move(value));
+}
+
+DeserializationResult<ArenaString> Deserializer::deserialize_string(Arena& arena) {
+    // Deserialize string length
+    auto length_result = deserialize_uint32();
+    if (length_result.is_error()) {
+        return DeserializationResult<ArenaString>::error(length_result.get_error());
+    }
+    uint32_t length = length_result.get_value();
+
+    if (position_ + length > size_) {
+        return DeserializationResult<ArenaString>::error(Result::MALFORMED_MESSAGE);
+    }
+
+    ArenaString result(reinterpret_cast<const char*>(data_ + position_), length,
+                       ArenaAllocator<char>(arena));
+    position_ += length;
+
+    // Skip padding to align to 4-byte boundary
+    align_to(4);
+
+    return DeserializationResult<ArenaString>::success(std::move(result));
+}
+
 bool Deserializer::set_position(size_t pos) {
-    bool valid = pos <= buffer_.size();
+    bool valid = pos <= size_;
     if (valid) {
         position_ = pos;
     }
@@ -288,7 +386,7 @@ bool Deserializer::set_position(size_t pos) {
 }
 
 void Deserializer::skip(size_t bytes) {
-    position_ = std::min(position_ + bytes, buffer_.size());
+    position_ = std::min(position_ + bytes, size_);
 }
 
 void Deserializer::align_to(size_t alignment) {
@@ -297,34 +395,34 @@ void Deserializer::align_to(size_t alignment) {
 }
 
 std::optional<uint16_t> Deserializer::read_be_uint16() {
-    if (position_ + sizeof(uint16_t) > buffer_.size()) {
+    if (position_ + sizeof(uint16_t) > size_) {
         return std::nullopt;
     }
 
     uint16_t value;
-    std::memcpy(&value, &buffer_[position_], sizeof(uint16_t));
+    std::memcpy(&value, data_ + position_, sizeof(uint16_t));
     position_ += sizeof(uint16_t);
     return ntohs(value);
 }
 
 std::optional<uint32_t> Deserializer::read_be_uint32() {
-    if (position_ + sizeof(uint32_t) > buffer_.size()) {
+    if (position_ + sizeof(uint32_t) > size_) {
         return std::nullopt;
     }
 
     uint32_t value;
-    std::memcpy(&value, &buffer_[position_], sizeof(uint32_t));
+    std::memcpy(&value, data_ + position_, sizeof(uint32_t));
     position_ += sizeof(uint32_t);
     return ntohl(value);
 }
 
 std::optional<uint64_t> Deserializer::read_be_uint64() {
-    if (position_ + sizeof(uint64_t) > buffer_.size()) {
+    if (position_ + sizeof(uint64_t) > size_) {
         return std::nullopt;
     }
 
     uint64_t be_value;
-    std::memcpy(&be_value, &buffer_[position_], sizeof(uint64_t));
+    std::memcpy(&be_value, data_ + position_, sizeof(uint64_t));
     position_ += sizeof(uint64_t);
 
     // Manual big-endian to host conversion for macOS compatibility
@@ -112,30 +112,37 @@ Message& Message::operator=(Message&& other) noexcept {
 
 std::vector<uint8_t> Message::serialize() const {
     std::vector<uint8_t> data;
-    data.reserve(get_total_size());
+    serialize_into(data);
+    return data;
+}
+
+void Message::serialize_into(std::vector<uint8_t>& out) const {
+    size_t base = out.size();
+    out.resize(base + HEADER_SIZE + payload_.size());
+
+    serialize_header(out.data() + base);
+
+    // Append payload
+    if (!payload_.empty()) {
+        std::memcpy(out.data() + base + HEADER_SIZE, payload_.data(), payload_.size());
+    }
+}
 
+void Message::serialize_header(uint8_t* buffer) const {
     // Serialize header in big-endian format (network byte order)
     uint32_t message_id_be = htonl(message_id_.to_uint32());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&message_id_be),
-                reinterpret_cast<uint8_t*>(&message_id_be) + sizeof(uint32_t));
+    std::memcpy(buffer, &message_id_be, sizeof(uint32_t));
 
     uint32_t length_be = htonl(length_);
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&length_be),
-                reinterpret_cast<uint8_t*>(&length_be) + sizeof(uint32_t));
+    std::memcpy(buffer + 4, &length_be, sizeof(uint32_t));
 
     uint32_t request_id_be = htonl(request_id_.to_uint32());
-    data.insert(data.end(), reinterpret_cast<uint8_t*>(&request_id_be),
-                reinterpret_cast<uint8_t*>(&request_id_be) + sizeof(uint32_t));
-
-    data.push_back(protocol_version_);
-    data.push_back(interface_version_);
-    data.push_back(static_cast<uint8_t>(message_type_));
-    data.push_back(static_cast<uint8_t>(return_code_));
-
-    // Append payload
-    data.insert(data.end(), payload_.begin(), payload_.end());
+    std::memcpy(buffer + 8, &request_id_be, sizeof(uint32_t));
 
-    return data;
+    buffer[12] = protocol_version_;
+    buffer[13] = interface_version_;
+    buffer[14] = static_cast<uint8_t>(message_type_);
+    buffer[15] = static_cast<uint8_t>(return_code_);
 }
 
 bool Message::deserialize(const std::vector<uint8_t>& data) {
@@ -200,7 +207,7 @@ bool Message::deserialize(const std::vector<uint8_t>& data) {
     }
 
     // Copy payload
-    payload_.assign(data.begin() + offset, data.end());
+    payload_.assign(data.data() + offset, data.size() - offset);
 
     // Update timestamp
     update_timestamp();
@@ -281,6 +288,18 @@ bool Message::has_valid_payload() const {
     return payload_.size() <= MAX_TCP_PAYLOAD_SIZE;
 }
 
+void Message::reset_for_reuse() {
+    message_id_ = MessageId{};
+    length_ = 8;  // Length from client_id to end (no payload)
+    request_id_ = RequestId{};
+    protocol_version_ = SOMEIP_PROTOCOL_VERSION;
+    interface_version_ = SOMEIP_INTERFACE_VERSION;
+    message_type_ = MessageType::REQUEST;
+    return_code_ = ReturnCode::E_OK;
+    payload_.clear();  // Keeps capacity for the next payload
+    timestamp_ = std::chrono::steady_clock::now();
+}
+
 void Message::update_length() {
     // SOME/IP length field contains length from client_id to end of message
     // client_id(2) + session_id(2) + protocol_version(1) + interface_version(1) +
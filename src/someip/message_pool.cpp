@@ -0,0 +1,97 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "someip/message_pool.h"
+#include <algorithm>
+
+namespace someip {
+
+MessagePool::MessagePool(size_t max_pooled)
+    : max_pooled_(max_pooled) {
+    free_list_.reserve(std::min(max_pooled, kDefaultMaxPooled));
+}
+
+MessagePool::~MessagePool() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Message* message : free_list_) {
+        delete message;
+    }
+    free_list_.clear();
+}
+
+std::shared_ptr<MessagePool> MessagePool::create(size_t max_pooled) {
+    // Not make_shared: the constructor is private and the pool must be
+    // shared-owned so in-flight messages can outlive local references
+    return std::shared_ptr<MessagePool>(new MessagePool(max_pooled));
+}
+
+const std::shared_ptr<MessagePool>& MessagePool::get_default() {
+    static const std::shared_ptr<MessagePool> default_pool = create();
+    return default_pool;
+}
+
+MessagePtr MessagePool::acquire() {
+    Message* message = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++statistics_.acquired;
+        if (!free_list_.empty()) {
+            message = free_list_.back();
+            free_list_.pop_back();
+            ++statistics_.pool_hits;
+        } else {
+            ++statistics_.pool_misses;
+        }
+    }
+
+    if (message == nullptr) {
+        message = new Message();
+    }
+
+    // The custom deleter routes the last release back into the pool;
+    // the weak reference keeps message lifetime independent of pool
+    // lifetime (messages outliving the pool are simply freed)
+    std::weak_ptr<MessagePool> weak_pool = weak_from_this();
+    return MessagePtr(message, [weak_pool](Message* released) {
+        if (auto pool = weak_pool.lock()) {
+            pool->release(released);
+        } else {
+            delete released;
+        }
+    });
+}
+
+void MessagePool::release(Message* message) {
+    message->reset_for_reuse();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++statistics_.released;
+    statistics_.payload_high_water =
+        std::max(statistics_.payload_high_water, message->get_payload_capacity());
+
+    if (free_list_.size() < max_pooled_) {
+        free_list_.push_back(message);
+    } else {
+        ++statistics_.dropped;
+        delete message;
+    }
+}
+
+MessagePool::Statistics MessagePool::get_statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics statistics = statistics_;
+    statistics.pooled = free_list_.size();
+    return statistics;
+}
+
+} // namespace someip
@@ -0,0 +1,141 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "someip/message_view.h"
+#include <cstring>
+#if defined(_WIN32)
+#include <winsock2.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+namespace someip {
+
+MessageView::MessageView()
+    : length_(0),
+      protocol_version_(0),
+      interface_version_(0),
+      message_type_(MessageType::REQUEST),
+      return_code_(ReturnCode::E_OK),
+      payload_data_(nullptr),
+      payload_size_(0),
+      valid_(false) {
+}
+
+bool MessageView::parse(const uint8_t* data, size_t size) {
+    valid_ = false;
+    payload_data_ = nullptr;
+    payload_size_ = 0;
+
+    if (data == nullptr || size < Message::get_header_size()) {
+        return false;
+    }
+
+    // Deserialize header from big-endian format, reading in place
+    uint32_t message_id_be;
+    std::memcpy(&message_id_be, data, sizeof(uint32_t));
+    message_id_ = MessageId::from_uint32(ntohl(message_id_be));
+
+    uint32_t length_be;
+    std::memcpy(&length_be, data + 4, sizeof(uint32_t));
+    length_ = ntohl(length_be);
+
+    uint32_t request_id_be;
+    std::memcpy(&request_id_be, data + 8, sizeof(uint32_t));
+    request_id_ = RequestId::from_uint32(ntohl(request_id_be));
+
+    protocol_version_ = data[12];
+    interface_version_ = data[13];
+    message_type_ = static_cast<MessageType>(data[14]);
+    return_code_ = static_cast<ReturnCode>(data[15]);
+
+    // Same validation as Message::deserialize/has_valid_header
+    if (protocol_version_ != SOMEIP_PROTOCOL_VERSION ||
+        interface_version_ != SOMEIP_INTERFACE_VERSION) {
+        return false;
+    }
+
+    // length_ covers client_id to end: 8 + payload_size
+    if (length_ < 8) {
+        return false;
+    }
+    size_t expected_payload_size = length_ - 8;
+    size_t actual_payload_size = size - Message::get_header_size();
+    if (actual_payload_size != expected_payload_size) {
+        return false;
+    }
+
+    switch (message_type_) {
+        case MessageType::REQUEST:
+        case MessageType::REQUEST_NO_RETURN:
+        case MessageType::NOTIFICATION:
+        case MessageType::REQUEST_ACK:
+        case MessageType::RESPONSE:
+        case MessageType::ERROR:
+        case MessageType::RESPONSE_ACK:
+        case MessageType::ERROR_ACK:
+        case MessageType::TP_REQUEST:
+        case MessageType::TP_REQUEST_NO_RETURN:
+        case MessageType::TP_NOTIFICATION:
+            break;
+        default:
+            return false;
+    }
+
+    switch (return_code_) {
+        case ReturnCode::E_OK:
+        case ReturnCode::E_NOT_OK:
+        case ReturnCode::E_UNKNOWN_SERVICE:
+        case ReturnCode::E_UNKNOWN_METHOD:
+        case ReturnCode::E_NOT_READY:
+        case ReturnCode::E_NOT_REACHABLE:
+        case ReturnCode::E_TIMEOUT:
+        case ReturnCode::E_WRONG_PROTOCOL_VERSION:
+        case ReturnCode::E_WRONG_INTERFACE_VERSION:
+        case ReturnCode::E_MALFORMED_MESSAGE:
+        case ReturnCode::E_WRONG_MESSAGE_TYPE:
+        case ReturnCode::E_E2E_REPEATED:
+        case ReturnCode::E_E2E_WRONG_SEQUENCE:
+        case ReturnCode::E_E2E:
+        case ReturnCode::E_E2E_NOT_AVAILABLE:
+        case ReturnCode::E_E2E_NO_NEW_DATA:
+            break;
+        default:
+            return false;
+    }
+
+    payload_data_ = data + Message::get_header_size();
+    payload_size_ = actual_payload_size;
+    valid_ = true;
+    return true;
+}
+
+bool MessageView::parse(const std::vector<uint8_t>& data) {
+    return parse(data.data(), data.size());
+}
+
+Message MessageView::to_message() const {
+    Message message(message_id_, request_id_, message_type_, return_code_);
+    message.set_protocol_version(protocol_version_);
+    message.set_interface_version(interface_version_);
+    if (payload_size_ > 0) {
+        message.set_payload(payload_data_, payload_size_);
+    }
+    return message;
+}
+
+MessagePtr MessageView::to_message_ptr() const {
+    return std::make_shared<Message>(to_message());
+}
+
+} // namespace someip
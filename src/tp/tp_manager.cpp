@@ -15,6 +15,12 @@
 #include "tp/tp_segmenter.h"
 #include "tp/tp_reassembler.h"
 #include "someip/message.h"
+#include "common/lz4_codec.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <memory>
 #include <algorithm>
 
 namespace someip {
@@ -34,120 +40,570 @@ bool TpManager::initialize() {
 }
 
 void TpManager::shutdown() {
-    std::scoped_lock lock(transfers_mutex_);
-    active_transfers_.clear();
+    for (auto& shard : transfer_shards_) {
+        std::scoped_lock lock(shard.mutex);
+        shard.transfers.clear();
+    }
+    active_transfer_count_ = 0;
 }
 
 bool TpManager::needs_segmentation(const Message& message) const {
-    std::vector<uint8_t> data = message.serialize();
-    return data.size() > config_.max_segment_size;
+    // Header + payload size; no need to serialize just to measure
+    return Message::HEADER_SIZE + message.get_payload().size() > config_.max_segment_size;
 }
 
 TpResult TpManager::segment_message(const Message& message, uint32_t& transfer_id) {
-    std::scoped_lock lock(transfers_mutex_);
-
     // Check if we have capacity for new transfers
-    if (active_transfers_.size() >= config_.max_concurrent_transfers) {
+    if (active_transfer_count_.load(std::memory_order_relaxed) >=
+        config_.max_concurrent_transfers) {
         return TpResult::RESOURCE_EXHAUSTED;
     }
 
     // Create new transfer
-    transfer_id = next_transfer_id_++;
+    transfer_id = next_transfer_id_.fetch_add(1, std::memory_order_relaxed);
     uint32_t message_id = (static_cast<uint32_t>(message.get_service_id()) << 16) |
                          message.get_method_id();
 
     TpTransfer transfer(transfer_id, message_id);
 
-    // Segment the message
-    std::vector<TpSegment> segments;
-    TpResult result = segmenter_->segment_message(message, segments);
+    // Opt-in LZ4 stage: compressible bulk payloads shrink before they
+    // ever reach the segmenter (peers opt in via the SD capability)
+    TpResult result;
+    std::vector<uint8_t> compressed;
+    if (config_.enable_compression &&
+        message.get_payload().size() >= config_.compression_threshold &&
+        !lz4::is_compressed_payload(message.get_payload().data(),
+                                    message.get_payload().size()) &&
+        lz4::compress_payload(std::vector<uint8_t>(message.get_payload().begin(),
+                                                   message.get_payload().end()),
+                              compressed)) {
+        Message compact(message);
+        compact.set_payload(std::move(compressed));
+        result = segmenter_->segment_message(compact, transfer.segmented);
+    } else {
+        result = segmenter_->segment_message(message, transfer.segmented);
+    }
 
     if (result != TpResult::SUCCESS) {
         return result;
     }
 
-    transfer.segments = std::move(segments);
     transfer.state = TpTransferState::SENDING;
+    transfer.acked.assign(transfer.segmented.views.size(), false);
+    transfer.send_counts.assign(transfer.segmented.views.size(), 0);
+    transfer.send_times.assign(transfer.segmented.views.size(),
+                               std::chrono::steady_clock::time_point{});
+
+    {
+        TransferShard& shard = shard_for(transfer_id);
+        std::scoped_lock lock(shard.mutex);
+        shard.transfers[transfer_id] = std::move(transfer);
+    }
+    active_transfer_count_.fetch_add(1, std::memory_order_relaxed);
+    messages_segmented_.add();
 
-    active_transfers_[transfer_id] = std::move(transfer);
-    statistics_.messages_segmented++;
+    return TpResult::SUCCESS;
+}
+
+void TpSegmentedMessage::release() {
+    if (external_data) {
+        munmap(const_cast<uint8_t*>(external_data), external_size);
+        external_data = nullptr;
+        external_size = 0;
+    }
+    if (external_fd >= 0) {
+        close(external_fd);
+        external_fd = -1;
+    }
+}
+
+TpResult TpManager::segment_file(const std::string& path, uint32_t message_id,
+                                 uint32_t& transfer_id) {
+    if (active_transfer_count_.load(std::memory_order_relaxed) >=
+        config_.max_concurrent_transfers) {
+        return TpResult::RESOURCE_EXHAUSTED;
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return TpResult::SEGMENTATION_FAILED;
+    }
+
+    struct stat file_info {};
+    if (fstat(fd, &file_info) != 0 || file_info.st_size <= 0) {
+        close(fd);
+        return TpResult::SEGMENTATION_FAILED;
+    }
+    size_t file_size = static_cast<size_t>(file_info.st_size);
+
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        return TpResult::SEGMENTATION_FAILED;
+    }
+    madvise(mapping, file_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+
+    transfer_id = next_transfer_id_.fetch_add(1, std::memory_order_relaxed);
+    TpTransfer transfer(transfer_id, message_id);
+
+    TpSegmentedMessage& segmented = transfer.segmented;
+    segmented.external_data = static_cast<const uint8_t*>(mapping);
+    segmented.external_size = file_size;
+    segmented.external_fd = fd;
+
+    uint32_t total_length = static_cast<uint32_t>(file_size);
+    uint8_t sequence = static_cast<uint8_t>(transfer_id & 0xFF);
+
+    // First segment: the one copied piece — a 16-byte SOME/IP header
+    // plus the opening chunk, contiguous in the owned buffer. When the
+    // transfer is multi-segment, the chunk is sized so segment_length
+    // (16 + chunk) never exceeds message_length, which the receiver's
+    // validator enforces; the whole-file-fits case ships as a single
+    // message instead
+    bool single_segment = 16 + file_size <= config_.max_segment_size;
+    size_t first_chunk = single_segment
+                             ? file_size
+                             : std::min<size_t>(config_.max_segment_size, file_size) - 16;
+    Message header_template(MessageId(static_cast<uint16_t>(message_id >> 16),
+                                      static_cast<uint16_t>(message_id & 0xFFFF)),
+                            RequestId(0, static_cast<uint16_t>(transfer_id & 0xFFFF)),
+                            MessageType::NOTIFICATION, ReturnCode::E_OK);
+    segmented.buffer.resize(16 + first_chunk);
+    header_template.serialize_header(segmented.buffer.data());
+    // Patch the length field for the real payload size
+    uint32_t wire_length = 8 + total_length;
+    segmented.buffer[4] = (wire_length >> 24) & 0xFF;
+    segmented.buffer[5] = (wire_length >> 16) & 0xFF;
+    segmented.buffer[6] = (wire_length >> 8) & 0xFF;
+    segmented.buffer[7] = wire_length & 0xFF;
+    std::memcpy(segmented.buffer.data() + 16, segmented.external_data, first_chunk);
+
+    {
+        TpSegmentView view;
+        view.header.message_type = single_segment ? TpMessageType::SINGLE_MESSAGE
+                                                  : TpMessageType::FIRST_SEGMENT;
+        view.header.message_length = total_length;
+        view.header.segment_offset = 0;
+        view.header.segment_length = static_cast<uint16_t>(segmented.buffer.size());
+        view.header.sequence_number = sequence;
+        view.buffer_offset = 0;
+        view.length = segmented.buffer.size();
+        view.external = false;
+        segmented.views.push_back(view);
+    }
+
+    // Everything else: views straight over the mapping, zero copies
+    size_t offset = first_chunk;
+    while (offset < file_size) {
+        size_t length = std::min<size_t>(config_.max_segment_size, file_size - offset);
+
+        TpSegmentView view;
+        view.header.message_type = (offset + length == file_size)
+                                       ? TpMessageType::LAST_SEGMENT
+                                       : TpMessageType::CONSECUTIVE_SEGMENT;
+        view.header.message_length = total_length;
+        view.header.segment_offset = static_cast<uint32_t>(offset);
+        view.header.segment_length = static_cast<uint16_t>(length);
+        view.header.sequence_number = sequence;
+        view.buffer_offset = offset;
+        view.length = length;
+        view.external = true;
+        segmented.views.push_back(view);
+
+        offset += length;
+    }
+
+    transfer.state = TpTransferState::SENDING;
+    transfer.acked.assign(segmented.views.size(), false);
+    transfer.send_counts.assign(segmented.views.size(), 0);
+    transfer.send_times.assign(segmented.views.size(),
+                               std::chrono::steady_clock::time_point{});
+
+    {
+        TransferShard& shard = shard_for(transfer_id);
+        std::scoped_lock lock(shard.mutex);
+        shard.transfers[transfer_id] = std::move(transfer);
+    }
+    active_transfer_count_.fetch_add(1, std::memory_order_relaxed);
+    messages_segmented_.add();
 
     return TpResult::SUCCESS;
 }
 
+TpChunkSink TpManager::make_file_chunk_sink(const std::string& path) {
+    // The fd lives in a shared holder so the callable stays copyable
+    auto fd_holder = std::make_shared<int>(open(path.c_str(),
+                                                O_CREAT | O_WRONLY | O_TRUNC, 0644));
+    return [fd_holder](uint8_t, uint64_t offset, const uint8_t* data, size_t length,
+                       bool final_chunk) {
+        if (*fd_holder < 0) {
+            return;
+        }
+        ssize_t written = pwrite(*fd_holder, data, length, static_cast<off_t>(offset));
+        (void)written;
+        if (final_chunk) {
+            close(*fd_holder);
+            *fd_holder = -1;
+        }
+    };
+}
+
 TpResult TpManager::get_next_segment(uint32_t transfer_id, TpSegment& segment) {
-    std::scoped_lock lock(transfers_mutex_);
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
 
-    auto it = active_transfers_.find(transfer_id);
-    if (it == active_transfers_.end()) {
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
         return TpResult::INVALID_SEGMENT;
     }
 
     TpTransfer& transfer = it->second;
 
-    if (transfer.next_segment_to_send >= transfer.segments.size()) {
-        transfer.state = TpTransferState::COMPLETE;
+    if (transfer.next_segment_to_send >= transfer.segmented.views.size()) {
+        if (transfer.state != TpTransferState::COMPLETE) {
+            transfer.state = TpTransferState::COMPLETE;
+            // Completed transfers stop counting against capacity (the
+            // entry itself lingers for status queries until cleanup)
+            active_transfer_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
         segment = TpSegment();  // Clear the segment
         return TpResult::SUCCESS;  // No more segments
     }
 
-    segment = transfer.segments[transfer.next_segment_to_send];
+    // Legacy copying interface: materialize the view for the caller
+    const TpSegmentView& view = transfer.segmented.views[transfer.next_segment_to_send];
+    segment.header = view.header;
+    const uint8_t* view_data = transfer.segmented.data(view);
+    segment.payload.assign(view_data, view_data + view.length);
     transfer.next_segment_to_send++;
     transfer.last_activity = std::chrono::steady_clock::now();
 
-    statistics_.segments_sent++;
+    segments_sent_.add();
+
+    return TpResult::SUCCESS;
+}
+
+TpResult TpManager::get_next_segment_view(uint32_t transfer_id, TpSegmentHeader& header,
+                                          const uint8_t*& data, size_t& length, bool& done) {
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
+
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
+        return TpResult::INVALID_SEGMENT;
+    }
+
+    TpTransfer& transfer = it->second;
+
+    if (transfer.next_segment_to_send >= transfer.segmented.views.size()) {
+        if (transfer.state != TpTransferState::COMPLETE) {
+            transfer.state = TpTransferState::COMPLETE;
+            active_transfer_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        data = nullptr;
+        length = 0;
+        done = true;
+        return TpResult::SUCCESS;
+    }
+
+    // Sliding window: with acknowledgments on, no more than
+    // window_size unacked segments may be in flight
+    if (config_.enable_acknowledgments &&
+        transfer.next_segment_to_send >= transfer.window_base + config_.window_size) {
+        data = nullptr;
+        length = 0;
+        done = false;  // Window closed; acks will reopen it
+        return TpResult::SUCCESS;
+    }
+
+    const TpSegmentView& view = transfer.segmented.views[transfer.next_segment_to_send];
+    header = view.header;
+    data = transfer.segmented.data(view);
+    length = view.length;
+    done = false;
+
+    transfer.send_counts[transfer.next_segment_to_send]++;
+    transfer.send_times[transfer.next_segment_to_send] = std::chrono::steady_clock::now();
+    transfer.next_segment_to_send++;
+    transfer.last_activity = std::chrono::steady_clock::now();
+    segments_sent_.add();
+
+    return TpResult::SUCCESS;
+}
+
+TpResult TpManager::get_retransmit_segment_view(uint32_t transfer_id, TpSegmentHeader& header,
+                                                const uint8_t*& data, size_t& length,
+                                                bool& available) {
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
+
+    available = false;
+
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
+        return TpResult::INVALID_SEGMENT;
+    }
+
+    TpTransfer& transfer = it->second;
+    if (transfer.state == TpTransferState::FAILED) {
+        return TpResult::TIMEOUT;  // Already failed; capacity released once
+    }
+
+    auto now = std::chrono::steady_clock::now();
+
+    // A gap retransmit repeats only after a short guard so one SACK
+    // does not trigger duplicate resends of the same segment
+    auto gap_guard = config_.retry_timeout / 8;
+
+    size_t sent_limit = std::min(transfer.next_segment_to_send,
+                                 transfer.segmented.views.size());
+    for (size_t i = transfer.window_base; i < sent_limit; ++i) {
+        if (transfer.acked[i] || transfer.send_counts[i] == 0) {
+            continue;
+        }
+
+        auto since_send = now - transfer.send_times[i];
+        bool gap = i < transfer.highest_acked_index && since_send > gap_guard;
+        bool timed_out = since_send > config_.retry_timeout;
+        if (!gap && !timed_out) {
+            continue;
+        }
+
+        if (transfer.send_counts[i] > config_.max_retries) {
+            // Decrement only when leaving an active state; COMPLETE and
+            // FAILED have already released their capacity slot
+            if (transfer.state != TpTransferState::COMPLETE &&
+                transfer.state != TpTransferState::FAILED) {
+                active_transfer_count_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            transfer.state = TpTransferState::FAILED;
+            timeouts_.add();
+            return TpResult::TIMEOUT;
+        }
+
+        const TpSegmentView& view = transfer.segmented.views[i];
+        header = view.header;
+        data = transfer.segmented.data(view);
+        length = view.length;
+        available = true;
+
+        transfer.send_counts[i]++;
+        transfer.send_times[i] = now;
+        transfer.last_activity = now;
+        retransmissions_.add();
+        return TpResult::SUCCESS;
+    }
+
+    return TpResult::SUCCESS;
+}
+
+TpResult TpManager::set_transfer_priority(uint32_t transfer_id, uint8_t priority) {
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
+
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
+        return TpResult::INVALID_SEGMENT;
+    }
+
+    it->second.priority = priority;
+    return TpResult::SUCCESS;
+}
+
+TpResult TpManager::get_transmit_batch(std::vector<TpTransmitItem>& batch, size_t max_items) {
+    batch.clear();
+
+    std::scoped_lock scheduler_lock(scheduler_mutex_);
+
+    // Refill the token bucket; a zero rate means unpaced
+    double token_budget = -1.0;
+    if (config_.pacing_rate_bytes_per_sec > 0) {
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - last_refill_).count();
+        last_refill_ = now;
+
+        double cap = static_cast<double>(config_.pacing_burst_segments) *
+                     config_.max_segment_size;
+        if (pacing_tokens_ < 0.0) {
+            pacing_tokens_ = cap;  // The bucket starts full
+        }
+        pacing_tokens_ = std::min(cap,
+                                  pacing_tokens_ + elapsed * config_.pacing_rate_bytes_per_sec);
+        token_budget = pacing_tokens_;
+    }
+
+    // Gather sendable transfers, served strictly by priority
+    std::vector<std::pair<uint8_t, uint32_t>> candidates;
+    for (auto& shard : transfer_shards_) {
+        std::scoped_lock lock(shard.mutex);
+        for (const auto& [id, transfer] : shard.transfers) {
+            if (transfer.state == TpTransferState::SENDING &&
+                transfer.next_segment_to_send < transfer.segmented.views.size()) {
+                candidates.emplace_back(transfer.priority, id);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& [priority, transfer_id] : candidates) {
+        while (batch.size() < max_items) {
+            TpSegmentHeader header;
+            const uint8_t* data = nullptr;
+            size_t length = 0;
+            bool done = false;
+
+            // Peek the cost before committing tokens
+            {
+                TransferShard& shard = shard_for(transfer_id);
+                std::scoped_lock lock(shard.mutex);
+                auto it = shard.transfers.find(transfer_id);
+                if (it == shard.transfers.end()) {
+                    break;
+                }
+                TpTransfer& transfer = it->second;
+                if (transfer.next_segment_to_send >= transfer.segmented.views.size()) {
+                    break;
+                }
+                size_t next_length =
+                    transfer.segmented.views[transfer.next_segment_to_send].length;
+                if (token_budget >= 0.0 && pacing_tokens_ < static_cast<double>(next_length)) {
+                    return TpResult::SUCCESS;  // Out of tokens this round
+                }
+            }
+
+            if (get_next_segment_view(transfer_id, header, data, length, done) !=
+                TpResult::SUCCESS) {
+                break;
+            }
+            if (done || data == nullptr) {
+                break;  // Finished or window closed
+            }
+
+            if (token_budget >= 0.0) {
+                pacing_tokens_ -= static_cast<double>(length);
+            }
+            batch.push_back(TpTransmitItem{transfer_id, header, data, length});
+        }
+
+        if (batch.size() >= max_items) {
+            break;
+        }
+    }
 
     return TpResult::SUCCESS;
 }
 
+void TpManager::set_chunk_sink(TpChunkSink sink) {
+    reassembler_->set_chunk_sink(std::move(sink));
+}
+
+bool TpManager::get_reassembly_sack(uint8_t sequence_number,
+                                    std::vector<uint32_t>& received_offsets) const {
+    return reassembler_->get_received_offsets(sequence_number, received_offsets);
+}
+
 bool TpManager::handle_received_segment(const TpSegment& segment, std::vector<uint8_t>& complete_message) {
     // Update statistics
-    statistics_.segments_received++;
+    segments_received_.add();
 
     // Check if this is a single-message segment
     if (segment.header.message_type == TpMessageType::SINGLE_MESSAGE) {
-        complete_message = segment.payload;
+        // Deliver the payload, consistent with the multi-segment path
+        // (single segments carry the full serialized message)
+        if (segment.payload.size() <= 16) {
+            complete_message.clear();
+        } else {
+            complete_message.assign(segment.payload.begin() + 16, segment.payload.end());
+        }
+
+        if (config_.enable_compression && !complete_message.empty() &&
+            lz4::is_compressed_payload(complete_message.data(), complete_message.size())) {
+            std::vector<uint8_t> decompressed;
+            if (lz4::decompress_payload(complete_message.data(), complete_message.size(),
+                                        decompressed)) {
+                complete_message = std::move(decompressed);
+            }
+        }
         return true;
     }
 
     // Handle multi-segment message
-    return reassembler_->process_segment(segment, complete_message);
+    bool complete = reassembler_->process_segment(segment, complete_message);
+
+    // Reverse the compression stage, gated on local consent so
+    // payloads that merely look compressed pass through untouched
+    if (config_.enable_compression && complete && !complete_message.empty() &&
+        lz4::is_compressed_payload(complete_message.data(), complete_message.size())) {
+        std::vector<uint8_t> decompressed;
+        if (lz4::decompress_payload(complete_message.data(), complete_message.size(),
+                                    decompressed)) {
+            complete_message = std::move(decompressed);
+        }
+    }
+    return complete;
 }
 
-TpResult TpManager::acknowledge_segments(uint32_t transfer_id, const std::vector<uint16_t>& segments_acknowledged) {
-    std::scoped_lock lock(transfers_mutex_);
+TpResult TpManager::acknowledge_segments(uint32_t transfer_id, const std::vector<uint32_t>& segments_acknowledged) {
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
 
-    auto it = active_transfers_.find(transfer_id);
-    if (it == active_transfers_.end()) {
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
         return TpResult::INVALID_SEGMENT;
     }
 
-    // For now, we assume all segments are acknowledged
-    // In a full implementation, we'd track individual segment acknowledgments
-    it->second.last_activity = std::chrono::steady_clock::now();
+    TpTransfer& transfer = it->second;
+
+    // SACK: mark each acknowledged segment (identified by its unique
+    // segment_offset), then slide the window over the acked prefix
+    for (uint32_t offset : segments_acknowledged) {
+        for (size_t i = 0; i < transfer.segmented.views.size(); ++i) {
+            if (transfer.segmented.views[i].header.segment_offset == offset) {
+                if (!transfer.acked[i]) {
+                    transfer.acked[i] = true;
+                    transfer.highest_acked_index =
+                        std::max(transfer.highest_acked_index, i);
+                }
+                break;
+            }
+        }
+    }
+
+    while (transfer.window_base < transfer.acked.size() &&
+           transfer.acked[transfer.window_base]) {
+        transfer.window_base++;
+    }
+
+    transfer.last_activity = std::chrono::steady_clock::now();
 
     return TpResult::SUCCESS;
 }
 
 TpResult TpManager::cancel_transfer(uint32_t transfer_id) {
-    std::scoped_lock lock(transfers_mutex_);
+    TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
 
-    auto it = active_transfers_.find(transfer_id);
-    if (it == active_transfers_.end()) {
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
         return TpResult::INVALID_SEGMENT;
     }
 
+    if (it->second.state != TpTransferState::COMPLETE &&
+        it->second.state != TpTransferState::FAILED) {
+        active_transfer_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
     it->second.state = TpTransferState::FAILED;
-    active_transfers_.erase(it);
+    shard.transfers.erase(it);
 
     return TpResult::SUCCESS;
 }
 
 TpTransferState TpManager::get_transfer_status(uint32_t transfer_id) const {
-    std::scoped_lock lock(transfers_mutex_);
+    const TransferShard& shard = shard_for(transfer_id);
+    std::scoped_lock lock(shard.mutex);
 
-    auto it = active_transfers_.find(transfer_id);
-    if (it == active_transfers_.end()) {
+    auto it = shard.transfers.find(transfer_id);
+    if (it == shard.transfers.end()) {
         return TpTransferState::FAILED;
     }
 
@@ -167,26 +623,32 @@ void TpManager::set_message_callback(TpMessageCallback callback) {
 }
 
 void TpManager::process_timeouts() {
-    std::scoped_lock lock(transfers_mutex_);
-
     auto now = std::chrono::steady_clock::now();
 
-    for (auto it = active_transfers_.begin(); it != active_transfers_.end(); ) {
-        TpTransfer& transfer = it->second;
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now - transfer.last_activity);
-
-        if (elapsed > config_.reassembly_timeout) {
-            transfer.state = TpTransferState::TIMEOUT;
-            statistics_.timeouts++;
-
-            if (completion_callback_) {
-                completion_callback_(transfer.transfer_id, TpResult::TIMEOUT);
+    for (auto& shard : transfer_shards_) {
+        std::scoped_lock lock(shard.mutex);
+        for (auto it = shard.transfers.begin(); it != shard.transfers.end(); ) {
+            TpTransfer& transfer = it->second;
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - transfer.last_activity);
+
+            if (elapsed > config_.reassembly_timeout) {
+                if (transfer.state == TpTransferState::COMPLETE) {
+                    ++it;
+                    continue;  // Completed entries are reaped below
+                }
+                transfer.state = TpTransferState::TIMEOUT;
+                timeouts_.add();
+
+                if (completion_callback_) {
+                    completion_callback_(transfer.transfer_id, TpResult::TIMEOUT);
+                }
+
+                it = shard.transfers.erase(it);
+                active_transfer_count_.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                ++it;
             }
-
-            it = active_transfers_.erase(it);
-        } else {
-            ++it;
         }
     }
 
@@ -198,7 +660,14 @@ void TpManager::process_timeouts() {
 }
 
 TpStatistics TpManager::get_statistics() const {
-    return statistics_;
+    TpStatistics stats;
+    stats.messages_segmented = static_cast<uint32_t>(messages_segmented_.read());
+    stats.messages_reassembled = static_cast<uint32_t>(messages_reassembled_.read());
+    stats.segments_sent = static_cast<uint32_t>(segments_sent_.read());
+    stats.segments_received = static_cast<uint32_t>(segments_received_.read());
+    stats.retransmissions = static_cast<uint32_t>(retransmissions_.read());
+    stats.timeouts = static_cast<uint32_t>(timeouts_.read());
+    return stats;
 }
 
 void TpManager::update_config(const TpConfig& config) {
@@ -208,12 +677,16 @@ void TpManager::update_config(const TpConfig& config) {
 }
 
 void TpManager::cleanup_completed_transfers() {
-    for (auto it = active_transfers_.begin(); it != active_transfers_.end(); ) {
-        if (it->second.state == TpTransferState::COMPLETE ||
-            it->second.state == TpTransferState::FAILED) {
-            it = active_transfers_.erase(it);
-        } else {
-            ++it;
+    for (auto& shard : transfer_shards_) {
+        std::scoped_lock lock(shard.mutex);
+        for (auto it = shard.transfers.begin(); it != shard.transfers.end(); ) {
+            if (it->second.state == TpTransferState::COMPLETE ||
+                it->second.state == TpTransferState::FAILED) {
+                // Capacity was already released when the state changed
+                it = shard.transfers.erase(it);
+            } else {
+                ++it;
+            }
         }
     }
 }
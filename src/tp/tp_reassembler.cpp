@@ -29,6 +29,13 @@ TpReassembler::~TpReassembler() {
 }
 
 bool TpReassembler::process_segment(const TpSegment& segment, std::vector<uint8_t>& complete_message) {
+    // Oversized transfers stream through the chunk sink instead of a
+    // full in-memory buffer
+    if (chunk_sink_ && segment.header.message_length > config_.max_message_size) {
+        std::scoped_lock lock(buffers_mutex_);
+        return process_streaming_segment(segment);
+    }
+
     if (!validate_segment(segment)) {
         return false;
     }
@@ -43,7 +50,11 @@ bool TpReassembler::process_segment(const TpSegment& segment, std::vector<uint8_
     if (add_segment_to_buffer(*buffer, segment)) {
         if (buffer->is_complete()) {
             buffer->complete = true;  // Mark as complete
-            complete_message = buffer->get_complete_message();
+            // Assign into the caller's (capacity-retaining) vector and
+            // recycle our data buffer instead of allocating a copy
+            complete_message.assign(buffer->received_data.begin(),
+                                    buffer->received_data.end());
+            recycle_data(std::move(buffer->received_data));
             // Remove completed buffer
             reassembly_buffers_.erase(buffer->message_id);
             return true;
@@ -74,6 +85,23 @@ bool TpReassembler::validate_segment(const TpSegment& segment) const {
     return true;
 }
 
+std::vector<uint8_t> TpReassembler::take_pooled_data() {
+    // Caller holds buffers_mutex_
+    if (data_pool_.empty()) {
+        return {};
+    }
+    std::vector<uint8_t> data = std::move(data_pool_.back());
+    data_pool_.pop_back();
+    return data;
+}
+
+void TpReassembler::recycle_data(std::vector<uint8_t>&& data) {
+    // Caller holds buffers_mutex_
+    if (data_pool_.size() < MAX_POOLED_DATA_BUFFERS) {
+        data_pool_.push_back(std::move(data));
+    }
+}
+
 TpReassemblyBuffer* TpReassembler::find_or_create_buffer(const TpSegment& segment) {
     auto it = reassembly_buffers_.find(segment.header.sequence_number);
 
@@ -83,7 +111,8 @@ TpReassemblyBuffer* TpReassembler::find_or_create_buffer(const TpSegment& segmen
             segment.header.message_type == TpMessageType::SINGLE_MESSAGE) {
 
             auto buffer = std::make_unique<TpReassemblyBuffer>(
-                segment.header.sequence_number, segment.header.message_length);
+                segment.header.sequence_number, segment.header.message_length,
+                take_pooled_data());
             it = reassembly_buffers_.emplace(segment.header.sequence_number, std::move(buffer)).first;
         } else {
             // Received consecutive/last segment without first segment
@@ -135,6 +164,7 @@ bool TpReassembler::add_segment_to_buffer(TpReassemblyBuffer& buffer, const TpSe
 
     // Mark the received bytes
     buffer.mark_segment_received(segment.header.segment_offset, bytes_received);
+    buffer.received_offsets.push_back(segment.header.segment_offset);
 
     // Update sequence tracking
     buffer.last_sequence_number = segment.header.sequence_number;
@@ -189,6 +219,86 @@ void TpReassembler::process_timeouts() {
     cleanup_completed_buffers();
 }
 
+void TpReassembler::set_chunk_sink(TpChunkSink sink) {
+    std::scoped_lock lock(buffers_mutex_);
+    chunk_sink_ = std::move(sink);
+}
+
+bool TpReassembler::process_streaming_segment(const TpSegment& segment) {
+    StreamingReassembly& stream = streaming_[segment.header.sequence_number];
+    stream.total_length = segment.header.message_length;
+
+    // First segments carry the SOME/IP header before the payload
+    const uint8_t* data = segment.payload.data();
+    size_t length = segment.payload.size();
+    if (segment.header.message_type == TpMessageType::FIRST_SEGMENT) {
+        if (length <= 16) {
+            return false;
+        }
+        data += 16;
+        length -= 16;
+    }
+
+    uint64_t offset = segment.header.segment_offset;
+
+    if (offset + length > stream.total_length) {
+        return false;  // Beyond the announced length
+    }
+    if (offset < stream.delivered) {
+        return true;  // Duplicate of already-delivered bytes
+    }
+    if (offset > stream.delivered + config_.reorder_window_bytes) {
+        return true;  // Outside the reorder window; sender will resend
+    }
+
+    uint8_t sequence = segment.header.sequence_number;
+
+    if (offset == stream.delivered) {
+        // In order: straight to the sink, then drain any pending run
+        stream.delivered += length;
+        bool final_chunk = stream.delivered == stream.total_length;
+        chunk_sink_(sequence, offset, data, length, final_chunk);
+
+        while (!stream.pending.empty() &&
+               stream.pending.begin()->first == stream.delivered) {
+            auto node = stream.pending.begin();
+            std::vector<uint8_t>& slice = node->second;
+            uint64_t slice_offset = node->first;
+            stream.delivered += slice.size();
+            stream.pending_bytes -= slice.size();
+            final_chunk = stream.delivered == stream.total_length;
+            chunk_sink_(sequence, slice_offset, slice.data(), slice.size(), final_chunk);
+            stream.pending.erase(node);
+        }
+
+        if (stream.delivered == stream.total_length) {
+            streaming_.erase(sequence);
+            return true;
+        }
+        return true;
+    }
+
+    // Out of order: park the slice, bounded by the reorder window
+    if (stream.pending.count(offset) == 0) {
+        stream.pending.emplace(offset, std::vector<uint8_t>(data, data + length));
+        stream.pending_bytes += length;
+    }
+    return true;
+}
+
+bool TpReassembler::get_received_offsets(uint8_t sequence_number,
+                                         std::vector<uint32_t>& offsets) const {
+    std::scoped_lock lock(buffers_mutex_);
+
+    auto it = reassembly_buffers_.find(sequence_number);
+    if (it == reassembly_buffers_.end()) {
+        return false;
+    }
+
+    offsets = it->second->received_offsets;
+    return true;
+}
+
 size_t TpReassembler::get_active_reassemblies() const {
     std::scoped_lock lock(buffers_mutex_);
     return reassembly_buffers_.size();
@@ -211,6 +321,7 @@ void TpReassembler::cleanup_timed_out_buffers(const TpConfig& config) {
             now - it->second->start_time);
 
         if (elapsed > config.reassembly_timeout) {
+            recycle_data(std::move(it->second->received_data));
             it = reassembly_buffers_.erase(it);
         } else {
             ++it;
@@ -224,8 +335,8 @@ TpConfig TpReassembler::get_config_copy() const {
 }
 
 // TpReassemblyBuffer implementation
-bool TpReassemblyBuffer::is_segment_received(uint16_t offset, uint16_t length) const {
-    for (uint16_t i = 0; i < length; ++i) {
+bool TpReassemblyBuffer::is_segment_received(uint32_t offset, uint32_t length) const {
+    for (uint32_t i = 0; i < length; ++i) {
         size_t bit_index = offset + i;
         if (bit_index >= received_segments.size() || !received_segments[bit_index]) {
             return false;
@@ -234,13 +345,13 @@ bool TpReassemblyBuffer::is_segment_received(uint16_t offset, uint16_t length) c
     return true;
 }
 
-void TpReassemblyBuffer::mark_segment_received(uint16_t offset, uint16_t length) {
+void TpReassemblyBuffer::mark_segment_received(uint32_t offset, uint32_t length) {
     // Ensure received_segments is large enough
     if (received_segments.size() < total_length) {
         received_segments.resize(total_length, false);
     }
 
-    for (uint16_t i = 0; i < length; ++i) {
+    for (uint32_t i = 0; i < length; ++i) {
         size_t bit_index = offset + i;
         if (bit_index < received_segments.size()) {
             received_segments[bit_index] = true;
@@ -27,7 +27,7 @@ TpSegmenter::~TpSegmenter() = default;
 
 TpResult TpSegmenter::segment_message(const Message& message, std::vector<TpSegment>& segments) {
     // Get the message payload (without headers - TP handles payload only)
-    const std::vector<uint8_t>& payload = message.get_payload();
+    const PayloadBuffer& payload = message.get_payload();
 
     if (payload.size() > config_.max_message_size) {
         return TpResult::MESSAGE_TOO_LARGE;
@@ -54,6 +54,77 @@ TpResult TpSegmenter::segment_message(const Message& message, std::vector<TpSegm
     return create_multi_segments(message, payload, segments);
 }
 
+TpResult TpSegmenter::segment_message(const Message& message, TpSegmentedMessage& out) {
+    const PayloadBuffer& payload = message.get_payload();
+
+    if (payload.size() > config_.max_message_size) {
+        return TpResult::MESSAGE_TOO_LARGE;
+    }
+
+    // The single retained copy: [SOME/IP header | payload]
+    out.buffer = message.serialize();
+    out.views.clear();
+
+    uint32_t total_length = static_cast<uint32_t>(payload.size());
+
+    if (payload.size() <= config_.max_segment_size) {
+        TpSegmentView view;
+        view.header.message_type = TpMessageType::SINGLE_MESSAGE;
+        view.header.message_length = total_length;
+        view.header.segment_offset = 0;
+        view.header.segment_length = static_cast<uint16_t>(out.buffer.size());
+        view.header.sequence_number = next_sequence_number_++;
+        view.buffer_offset = 0;
+        view.length = out.buffer.size();
+        out.views.push_back(view);
+        return TpResult::SUCCESS;
+    }
+
+    uint8_t sequence_number = next_sequence_number_++;
+
+    // First segment: SOME/IP header plus the payload's first slice —
+    // exactly the first max_segment_size bytes of the buffer
+    size_t first_length = std::min(static_cast<size_t>(config_.max_segment_size),
+                                   out.buffer.size());
+    {
+        TpSegmentView view;
+        view.header.message_type = TpMessageType::FIRST_SEGMENT;
+        view.header.message_length = total_length;
+        view.header.segment_offset = 0;
+        view.header.segment_length = static_cast<uint16_t>(first_length);
+        view.header.sequence_number = sequence_number;
+        view.buffer_offset = 0;
+        view.length = first_length;
+        out.views.push_back(view);
+    }
+
+    // Consecutive/last segments: payload-only slices
+    size_t payload_offset = first_length - 16;  // Past the header bytes
+    while (payload_offset < total_length) {
+        uint32_t remaining = total_length - static_cast<uint32_t>(payload_offset);
+        size_t length = std::min(static_cast<size_t>(config_.max_segment_size),
+                                 static_cast<size_t>(remaining));
+
+        TpSegmentView view;
+        view.header.message_type = remaining <= config_.max_segment_size
+                                       ? TpMessageType::LAST_SEGMENT
+                                       : TpMessageType::CONSECUTIVE_SEGMENT;
+        view.header.message_length = total_length;
+        view.header.segment_offset = static_cast<uint32_t>(payload_offset);
+        view.header.segment_length = static_cast<uint16_t>(length);
+        view.header.sequence_number = sequence_number;
+        view.buffer_offset = 16 + payload_offset;  // Skip the SOME/IP header
+        view.length = length;
+        out.views.push_back(view);
+
+        payload_offset += length;
+    }
+
+    next_sequence_number_ = (next_sequence_number_ + 1) % 256;
+
+    return TpResult::SUCCESS;
+}
+
 TpResult TpSegmenter::create_multi_segments(const Message& message,
                                           const std::vector<uint8_t>& payload,
                                           std::vector<TpSegment>& segments) {
@@ -12,6 +12,7 @@
  ********************************************************************************/
 
 #include "transport/endpoint.h"
+#include <arpa/inet.h>
 #include <regex>
 #include <sstream>
 #include <functional>
@@ -26,19 +27,25 @@ const Endpoint SOMEIP_DEFAULT_TCP_ENDPOINT("127.0.0.1", 30490, TransportProtocol
 
 Endpoint::Endpoint()
     : address_("127.0.0.1"), port_(30490), protocol_(TransportProtocol::UDP) {
+    parse_binary();
 }
 
 Endpoint::Endpoint(const std::string& address, uint16_t port, TransportProtocol protocol)
     : address_(address), port_(port), protocol_(protocol) {
+    parse_binary();
 }
 
 // NOLINTNEXTLINE(modernize-use-equals-default) - explicit copy for clarity
 Endpoint::Endpoint(const Endpoint& other)
-    : address_(other.address_), port_(other.port_), protocol_(other.protocol_) {
+    : address_(other.address_), port_(other.port_), protocol_(other.protocol_),
+      binary_addr_(other.binary_addr_), binary_valid_(other.binary_valid_),
+      sockaddr_cache_(other.sockaddr_cache_) {
 }
 
 Endpoint::Endpoint(Endpoint&& other) noexcept
-    : address_(std::move(other.address_)), port_(other.port_), protocol_(other.protocol_) {
+    : address_(std::move(other.address_)), port_(other.port_), protocol_(other.protocol_),
+      binary_addr_(other.binary_addr_), binary_valid_(other.binary_valid_),
+      sockaddr_cache_(other.sockaddr_cache_) {
 }
 
 Endpoint& Endpoint::operator=(const Endpoint& other) {
@@ -46,6 +53,9 @@ Endpoint& Endpoint::operator=(const Endpoint& other) {
         address_ = other.address_;
         port_ = other.port_;
         protocol_ = other.protocol_;
+        binary_addr_ = other.binary_addr_;
+        binary_valid_ = other.binary_valid_;
+        sockaddr_cache_ = other.sockaddr_cache_;
     }
     return *this;
 }
@@ -55,6 +65,9 @@ Endpoint& Endpoint::operator=(Endpoint&& other) noexcept {
         address_ = std::move(other.address_);
         port_ = other.port_;
         protocol_ = other.protocol_;
+        binary_addr_ = other.binary_addr_;
+        binary_valid_ = other.binary_valid_;
+        sockaddr_cache_ = other.sockaddr_cache_;
     }
     return *this;
 }
@@ -101,6 +114,12 @@ std::string Endpoint::to_string() const {
 }
 
 bool Endpoint::operator==(const Endpoint& other) const {
+    if (binary_valid_ && other.binary_valid_) {
+        // Binary compare: no string walk on the per-sender hot paths
+        return binary_addr_ == other.binary_addr_ &&
+               port_ == other.port_ &&
+               protocol_ == other.protocol_;
+    }
     return address_ == other.address_ &&
            port_ == other.port_ &&
            protocol_ == other.protocol_;
@@ -114,20 +133,37 @@ bool Endpoint::operator<(const Endpoint& other) const {
     if (protocol_ != other.protocol_) {
         return protocol_ < other.protocol_;
     }
-    if (address_ != other.address_) {
+    if (binary_valid_ && other.binary_valid_) {
+        if (binary_addr_ != other.binary_addr_) {
+            return binary_addr_ < other.binary_addr_;
+        }
+    } else if (address_ != other.address_) {
         return address_ < other.address_;
     }
     return port_ < other.port_;
 }
 
 size_t Endpoint::Hash::operator()(const Endpoint& endpoint) const {
-    size_t hash = 0;
-    hash = std::hash<std::string>()(endpoint.address_);
+    size_t hash = endpoint.binary_valid_
+                      ? std::hash<uint32_t>()(endpoint.binary_addr_)
+                      : std::hash<std::string>()(endpoint.address_);
     hash = hash * 31 + std::hash<uint16_t>()(endpoint.port_);
     hash = hash * 31 + std::hash<int>()(static_cast<int>(endpoint.protocol_));
     return hash;
 }
 
+void Endpoint::parse_binary() {
+    in_addr parsed{};
+    binary_valid_ = !address_.empty() &&
+                    inet_pton(AF_INET, address_.c_str(), &parsed) == 1;
+    binary_addr_ = binary_valid_ ? parsed.s_addr : 0;
+
+    sockaddr_cache_ = sockaddr_in{};
+    sockaddr_cache_.sin_family = AF_INET;
+    sockaddr_cache_.sin_port = htons(port_);
+    sockaddr_cache_.sin_addr.s_addr = binary_addr_;
+}
+
 bool Endpoint::is_valid_ipv4(const std::string& address) const {
     // Basic IPv4 validation regex
     std::regex ipv4_pattern(R"(^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$)");
@@ -0,0 +1,163 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/loopback_transport.h"
+#include "someip/message_pool.h"
+
+namespace someip {
+namespace transport {
+
+LoopbackTransport::LoopbackTransport(const Endpoint& local_endpoint)
+    : local_endpoint_(local_endpoint) {
+}
+
+LoopbackTransport::~LoopbackTransport() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - intentional cleanup
+    stop();
+}
+
+void LoopbackTransport::pair(LoopbackTransport& a, LoopbackTransport& b) {
+    a.peer_ = &b;
+    b.peer_ = &a;
+}
+
+void LoopbackTransport::set_link_model(const LinkModel& model) {
+    link_model_ = model;
+}
+
+Result LoopbackTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    (void)endpoint;  // Point-to-point: the pair is the route
+
+    if (!is_running() || !peer_ || !peer_->is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (link_model_.loss_probability > 0.0) {
+        std::scoped_lock lock(loss_mutex_);
+        double draw = std::uniform_real_distribution<double>(0.0, 1.0)(loss_rng_);
+        if (draw < link_model_.loss_probability) {
+            return Result::SUCCESS;  // Lost on the emulated wire
+        }
+    }
+
+    // The peer owns its copy, like a real wire would
+    auto copy = MessagePool::get_default()->acquire();
+    *copy = message;
+
+    if (link_model_.latency.count() > 0) {
+        std::scoped_lock lock(delay_mutex_);
+        delayed_.push_back({std::move(copy),
+                            std::chrono::steady_clock::now() + link_model_.latency});
+        delay_cv_.notify_one();
+        return Result::SUCCESS;
+    }
+
+    peer_->deliver(std::move(copy));
+    return Result::SUCCESS;
+}
+
+void LoopbackTransport::deliver(MessagePtr message) {
+    receive_queue_.push(message);
+
+    if (listener_) {
+        listener_->on_message_received(message, peer_ ? peer_->local_endpoint_ : Endpoint());
+    }
+}
+
+MessagePtr LoopbackTransport::receive_message() {
+    MessagePtr message;
+    if (!receive_queue_.pop(message)) {
+        return nullptr;
+    }
+    return message;
+}
+
+Result LoopbackTransport::connect(const Endpoint& endpoint) {
+    return endpoint.is_valid() ? Result::SUCCESS : Result::INVALID_ENDPOINT;
+}
+
+Result LoopbackTransport::disconnect() {
+    return Result::SUCCESS;
+}
+
+bool LoopbackTransport::is_connected() const {
+    return is_running() && peer_ != nullptr;
+}
+
+Endpoint LoopbackTransport::get_local_endpoint() const {
+    return local_endpoint_;
+}
+
+void LoopbackTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result LoopbackTransport::start() {
+    if (is_running()) {
+        return Result::SUCCESS;
+    }
+
+    running_ = true;
+
+    if (link_model_.latency.count() > 0) {
+        delay_thread_ = std::thread(&LoopbackTransport::delay_loop, this);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result LoopbackTransport::stop() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - safe: no override expected
+    if (!running_.exchange(false)) {
+        return Result::SUCCESS;
+    }
+
+    delay_cv_.notify_all();
+    if (delay_thread_.joinable()) {
+        delay_thread_.join();
+    }
+
+    return Result::SUCCESS;
+}
+
+bool LoopbackTransport::is_running() const {
+    return running_;
+}
+
+void LoopbackTransport::delay_loop() {
+    std::unique_lock lock(delay_mutex_);
+
+    while (running_) {
+        if (delayed_.empty()) {
+            delay_cv_.wait_for(lock, std::chrono::milliseconds(50));
+            continue;
+        }
+
+        auto due = delayed_.front().due;
+        if (delay_cv_.wait_until(lock, due) == std::cv_status::timeout ||
+            std::chrono::steady_clock::now() >= due) {
+            if (!delayed_.empty() && std::chrono::steady_clock::now() >= delayed_.front().due) {
+                MessagePtr message = std::move(delayed_.front().message);
+                delayed_.pop_front();
+                lock.unlock();
+                if (peer_ && peer_->is_running()) {
+                    peer_->deliver(std::move(message));
+                }
+                lock.lock();
+            }
+        }
+    }
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,127 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/priority_send_queue.h"
+
+namespace someip {
+namespace transport {
+
+PrioritySendQueue::PrioritySendQueue(ITransport& transport)
+    : transport_(transport) {
+}
+
+PrioritySendQueue::~PrioritySendQueue() {
+    stop();
+}
+
+void PrioritySendQueue::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    drain_thread_ = std::thread(&PrioritySendQueue::drain_loop, this);
+}
+
+void PrioritySendQueue::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    cv_.notify_all();
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+}
+
+bool PrioritySendQueue::enqueue(MessagePtr message, const Endpoint& endpoint,
+                                TrafficClass traffic_class) {
+    size_t class_index = static_cast<size_t>(traffic_class);
+    {
+        std::scoped_lock lock(mutex_);
+        if (queues_[class_index].size() >= kPerClassDepth) {
+            shed_[class_index].fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        queues_[class_index].push_back({std::move(message), endpoint});
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void PrioritySendQueue::flush() {
+    std::unique_lock lock(mutex_);
+    idle_cv_.wait(lock, [this] {
+        for (const auto& queue : queues_) {
+            if (!queue.empty()) {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+bool PrioritySendQueue::pick_next(Entry& entry, size_t& class_index) {
+    // Caller holds mutex_. Weighted-strict: highest class first, with
+    // one lower-class grant after a run of higher-class sends
+    size_t lowest_nonempty = CLASS_COUNT;
+    for (size_t i = 0; i < CLASS_COUNT; ++i) {
+        if (!queues_[i].empty()) {
+            lowest_nonempty = i;
+            break;
+        }
+    }
+    if (lowest_nonempty == CLASS_COUNT) {
+        return false;
+    }
+
+    size_t chosen = lowest_nonempty;
+    if (consecutive_high_ >= kStarvationGrant) {
+        // Grant the most-starved (numerically highest) class one send
+        for (size_t i = CLASS_COUNT; i-- > 0;) {
+            if (!queues_[i].empty()) {
+                chosen = i;
+                break;
+            }
+        }
+        consecutive_high_ = 0;
+    } else if (chosen == lowest_nonempty && lowest_nonempty < CLASS_COUNT - 1) {
+        consecutive_high_++;
+    }
+
+    entry = std::move(queues_[chosen].front());
+    queues_[chosen].pop_front();
+    class_index = chosen;
+    return true;
+}
+
+void PrioritySendQueue::drain_loop() {
+    std::unique_lock lock(mutex_);
+
+    while (running_) {
+        Entry entry;
+        size_t class_index = 0;
+        if (!pick_next(entry, class_index)) {
+            idle_cv_.notify_all();
+            cv_.wait_for(lock, std::chrono::milliseconds(50));
+            continue;
+        }
+
+        lock.unlock();
+        if (entry.message &&
+            transport_.send_message(*entry.message, entry.endpoint) == Result::SUCCESS) {
+            sent_[class_index].fetch_add(1, std::memory_order_relaxed);
+        }
+        lock.lock();
+    }
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,71 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/receive_buffer_pool.h"
+
+namespace someip {
+namespace transport {
+
+ReceiveBufferPool::ReceiveBufferPool(size_t buffer_size, size_t max_pooled)
+    : buffer_size_(buffer_size),
+      max_pooled_(max_pooled) {
+}
+
+const std::shared_ptr<ReceiveBufferPool>& ReceiveBufferPool::get_default() {
+    static const std::shared_ptr<ReceiveBufferPool> default_pool =
+        std::make_shared<ReceiveBufferPool>();
+    return default_pool;
+}
+
+std::vector<uint8_t> ReceiveBufferPool::acquire() {
+    {
+        std::scoped_lock lock(mutex_);
+        ++statistics_.acquired;
+
+        if (!free_list_.empty()) {
+            ++statistics_.pool_hits;
+            std::vector<uint8_t> buffer = std::move(free_list_.back());
+            free_list_.pop_back();
+            buffer.resize(buffer_size_);  // No realloc: capacity retained
+            return buffer;
+        }
+
+        ++statistics_.pool_misses;
+    }
+
+    return std::vector<uint8_t>(buffer_size_);
+}
+
+void ReceiveBufferPool::release(std::vector<uint8_t> buffer) {
+    std::scoped_lock lock(mutex_);
+    ++statistics_.released;
+
+    // A shrunk buffer still carries its original capacity, so accept
+    // anything that can hold a full datagram without reallocating
+    if (buffer.capacity() < buffer_size_ || free_list_.size() >= max_pooled_) {
+        ++statistics_.dropped;
+        return;  // Buffer freed on scope exit
+    }
+
+    free_list_.push_back(std::move(buffer));
+}
+
+ReceiveBufferPool::Statistics ReceiveBufferPool::get_statistics() const {
+    std::scoped_lock lock(mutex_);
+    Statistics stats = statistics_;
+    stats.pooled = free_list_.size();
+    return stats;
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,55 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/service_demux.h"
+
+namespace someip {
+namespace transport {
+
+ServiceDemux::ServiceDemux(ITransport& transport)
+    : transport_(transport),
+      handlers_(std::make_unique<std::shared_ptr<const ServiceHandler>[]>(SLOT_COUNT)) {
+    transport_.set_listener(this);
+}
+
+void ServiceDemux::register_service(uint16_t service_id, ServiceHandler handler) {
+    std::atomic_store(&handlers_[service_id],
+                      std::make_shared<const ServiceHandler>(std::move(handler)));
+}
+
+void ServiceDemux::unregister_service(uint16_t service_id) {
+    std::atomic_store(&handlers_[service_id], std::shared_ptr<const ServiceHandler>());
+}
+
+void ServiceDemux::on_message_received(MessagePtr message, const Endpoint& sender) {
+    auto handler = std::atomic_load(&handlers_[message->get_service_id()]);
+    if (handler && *handler) {
+        (*handler)(std::move(message), sender);
+    } else {
+        unrouted_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void ServiceDemux::on_messages_received(
+    const std::vector<std::pair<MessagePtr, Endpoint>>& messages) {
+    for (const auto& entry : messages) {
+        on_message_received(entry.first, entry.second);
+    }
+}
+
+void ServiceDemux::on_connection_lost(const Endpoint&) {}
+void ServiceDemux::on_connection_established(const Endpoint&) {}
+void ServiceDemux::on_error(Result) {}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,438 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "transport/sharded_udp_transport.h"
+#include "transport/receive_buffer_pool.h"
+#include "common/result.h"
+#include "someip/message_pool.h"
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <cstring>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace someip {
+namespace transport {
+
+size_t ShardedUdpTransport::default_shard_count() {
+    size_t cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        cores = 1;
+    }
+    return std::min(cores, MAX_SHARDS);
+}
+
+ShardedUdpTransport::ShardedUdpTransport(const Endpoint& local_endpoint, size_t shard_count)
+    : local_endpoint_(local_endpoint) {
+    if (!local_endpoint_.is_valid()) {
+        throw std::invalid_argument("Invalid local endpoint");
+    }
+
+    if (shard_count == 0) {
+        shard_count = default_shard_count();
+    }
+    shard_count = std::min(shard_count, MAX_SHARDS);
+
+    shards_.reserve(shard_count);
+    for (size_t i = 0; i < shard_count; ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+ShardedUdpTransport::~ShardedUdpTransport() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - intentional cleanup
+    stop();
+}
+
+Result ShardedUdpTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    // Scatter-gather send through shard 0, same layout as UdpTransport
+    uint8_t header[Message::HEADER_SIZE];
+    message.serialize_header(header);
+    const PayloadBuffer& payload = message.get_payload();
+
+    size_t total_size = sizeof(header) + payload.size();
+    if (total_size > MAX_UDP_PAYLOAD) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    std::scoped_lock lock(send_mutex_);
+
+    int fd = shards_[0]->socket_fd;
+    if (fd < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    sockaddr_in dest_addr = create_sockaddr(endpoint);
+
+    struct iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len = sizeof(header);
+    iov[1].iov_base = const_cast<uint8_t*>(payload.data());
+    iov[1].iov_len = payload.size();
+
+    msghdr msg{};
+    msg.msg_name = &dest_addr;
+    msg.msg_namelen = sizeof(dest_addr);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = payload.empty() ? 1 : 2;
+
+    ssize_t sent = sendmsg(fd, &msg, 0);
+
+    if (sent < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    if (static_cast<size_t>(sent) != total_size) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    return Result::SUCCESS;
+}
+
+MessagePtr ShardedUdpTransport::receive_message() {
+    // Round-robin over the shard queues so no shard starves when
+    // the kernel's flow hash lands traffic unevenly
+    size_t shard_count = shards_.size();
+    size_t start = consume_cursor_.fetch_add(1, std::memory_order_relaxed) % shard_count;
+
+    for (size_t i = 0; i < shard_count; ++i) {
+        Shard& shard = *shards_[(start + i) % shard_count];
+        std::scoped_lock lock(shard.queue_mutex);
+        if (!shard.receive_queue.empty()) {
+            MessagePtr message = shard.receive_queue.front();
+            shard.receive_queue.pop();
+            return message;
+        }
+    }
+
+    return nullptr;
+}
+
+Result ShardedUdpTransport::connect(const Endpoint& endpoint) {
+    // UDP is connectionless, so this just validates the endpoint
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+    return Result::SUCCESS;
+}
+
+Result ShardedUdpTransport::disconnect() {
+    // UDP is connectionless, nothing to disconnect
+    return Result::SUCCESS;
+}
+
+bool ShardedUdpTransport::is_connected() const {
+    return is_running();
+}
+
+Endpoint ShardedUdpTransport::get_local_endpoint() const {
+    return local_endpoint_;
+}
+
+void ShardedUdpTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result ShardedUdpTransport::start() {
+    if (is_running()) {
+        return Result::SUCCESS;
+    }
+
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        Result result = create_shard_socket(*shards_[i]);
+        if (result != Result::SUCCESS) {
+            for (size_t j = 0; j < i; ++j) {
+                close(shards_[j]->socket_fd);
+                shards_[j]->socket_fd = -1;
+            }
+            return result;
+        }
+    }
+
+    running_ = true;
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        shards_[i]->receive_thread = std::thread(&ShardedUdpTransport::receive_loop, this, i);
+    }
+
+    return Result::SUCCESS;
+}
+
+Result ShardedUdpTransport::stop() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - safe: no override expected
+    if (!running_.load()) {
+        return Result::SUCCESS;
+    }
+
+    running_ = false;
+
+    // Close sockets to wake up receive threads
+    for (auto& shard : shards_) {
+        if (shard->socket_fd >= 0) {
+            close(shard->socket_fd);
+            shard->socket_fd = -1;
+        }
+    }
+
+    for (auto& shard : shards_) {
+        if (shard->receive_thread.joinable()) {
+            shard->receive_thread.join();
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+bool ShardedUdpTransport::is_running() const {
+    return running_;
+}
+
+Result ShardedUdpTransport::create_shard_socket(Shard& shard) {
+    shard.socket_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (shard.socket_fd < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    int reuse = 1;
+    if (setsockopt(shard.socket_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0) {
+        close(shard.socket_fd);
+        shard.socket_fd = -1;
+        return Result::NETWORK_ERROR;
+    }
+
+#if defined(SO_REUSEPORT)
+    // The whole point: every shard binds the same endpoint and the
+    // kernel spreads flows across them
+    if (setsockopt(shard.socket_fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) < 0) {
+        close(shard.socket_fd);
+        shard.socket_fd = -1;
+        return Result::NETWORK_ERROR;
+    }
+#else
+    // Without SO_REUSEPORT only one socket can bind the endpoint
+    if (shards_.size() > 1) {
+        close(shard.socket_fd);
+        shard.socket_fd = -1;
+        return Result::NOT_IMPLEMENTED;
+    }
+#endif
+
+    // Set non-blocking mode
+    int flags = fcntl(shard.socket_fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(shard.socket_fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        close(shard.socket_fd);
+        shard.socket_fd = -1;
+        return Result::NETWORK_ERROR;
+    }
+
+    sockaddr_in addr = create_sockaddr(local_endpoint_);
+    if (bind(shard.socket_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        close(shard.socket_fd);
+        shard.socket_fd = -1;
+        return Result::NETWORK_ERROR;
+    }
+
+    return Result::SUCCESS;
+}
+
+void ShardedUdpTransport::pin_current_thread(size_t shard_index) {
+#if defined(__linux__)
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        return;
+    }
+
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(static_cast<int>(shard_index % cores), &cpuset);
+
+    // Best effort: an unpinnable thread still works, just migrates
+    pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#else
+    (void)shard_index;
+#endif
+}
+
+void ShardedUdpTransport::receive_loop(size_t shard_index) {
+    pin_current_thread(shard_index);
+
+    Shard& shard = *shards_[shard_index];
+
+#if defined(__linux__)
+    // Same batched recvmmsg drain as UdpTransport, one per shard;
+    // buffers come from the shared full-size pool
+    const auto& buffer_pool = ReceiveBufferPool::get_default();
+    std::vector<std::vector<uint8_t>> buffers;
+    buffers.reserve(RECEIVE_BATCH_SIZE);
+    for (size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+        buffers.push_back(buffer_pool->acquire());
+    }
+    mmsghdr msgs[RECEIVE_BATCH_SIZE];
+    iovec iovs[RECEIVE_BATCH_SIZE];
+    sockaddr_in addrs[RECEIVE_BATCH_SIZE];
+
+    while (running_) {
+        int fd = shard.socket_fd;
+        if (fd < 0) {
+            break;
+        }
+
+        for (size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+            buffers[i].resize(RECEIVE_BUFFER_SIZE);
+            iovs[i].iov_base = buffers[i].data();
+            iovs[i].iov_len = buffers[i].size();
+            std::memset(&msgs[i], 0, sizeof(mmsghdr));
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        }
+
+        int received_count = recvmmsg(fd, msgs, RECEIVE_BATCH_SIZE, 0, nullptr);
+
+        if (received_count < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                pollfd pfd{};
+                pfd.fd = fd;
+                pfd.events = POLLIN;
+                poll(&pfd, 1, 100);
+                continue;
+            }
+
+            if (running_ && listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        std::vector<std::pair<MessagePtr, Endpoint>> batch;
+        batch.reserve(static_cast<size_t>(received_count));
+
+        for (int i = 0; i < received_count; ++i) {
+            buffers[i].resize(msgs[i].msg_len);
+            MessagePtr message = MessagePool::get_default()->acquire();
+            if (message->deserialize(buffers[i])) {
+                batch.emplace_back(std::move(message), sockaddr_to_endpoint(addrs[i]));
+            }
+        }
+
+        if (batch.empty()) {
+            continue;
+        }
+
+        {
+            std::scoped_lock lock(shard.queue_mutex);
+            for (const auto& entry : batch) {
+                shard.receive_queue.push(entry.first);
+            }
+        }
+        shard.queue_cv.notify_all();
+
+        if (listener_) {
+            listener_->on_messages_received(batch);
+        }
+    }
+
+    for (auto& buffer : buffers) {
+        buffer_pool->release(std::move(buffer));
+    }
+#else
+    std::vector<uint8_t> buffer(RECEIVE_BUFFER_SIZE);
+
+    while (running_) {
+        int fd = shard.socket_fd;
+        if (fd < 0) {
+            break;
+        }
+
+        buffer.resize(RECEIVE_BUFFER_SIZE);
+        sockaddr_in src_addr;
+        socklen_t addr_len = sizeof(src_addr);
+        ssize_t received = recvfrom(fd, buffer.data(), buffer.size(), 0,
+                                    reinterpret_cast<sockaddr*>(&src_addr), &addr_len);
+
+        if (received < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                pollfd pfd{};
+                pfd.fd = fd;
+                pfd.events = POLLIN;
+                poll(&pfd, 1, 100);
+                continue;
+            }
+
+            if (running_ && listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        buffer.resize(static_cast<size_t>(received));
+        MessagePtr message = MessagePool::get_default()->acquire();
+        if (message->deserialize(buffer)) {
+            {
+                std::scoped_lock lock(shard.queue_mutex);
+                shard.receive_queue.push(message);
+            }
+            shard.queue_cv.notify_one();
+
+            if (listener_) {
+                listener_->on_message_received(message, sockaddr_to_endpoint(src_addr));
+            }
+        }
+    }
+#endif
+}
+
+sockaddr_in ShardedUdpTransport::create_sockaddr(const Endpoint& endpoint) const {
+    // Pre-parsed endpoints skip the per-packet string parse entirely
+    if (const sockaddr_in* cached = endpoint.cached_sockaddr()) {
+        return *cached;
+    }
+
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(endpoint.get_port());
+    addr.sin_addr.s_addr = inet_addr(endpoint.get_address().c_str());
+    return addr;
+}
+
+Endpoint ShardedUdpTransport::sockaddr_to_endpoint(const sockaddr_in& addr) const {
+    char ip_str[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &addr.sin_addr, ip_str, sizeof(ip_str));
+
+    return Endpoint(ip_str, ntohs(addr.sin_port), TransportProtocol::UDP);
+}
+
+} // namespace transport
+} // namespace someip
@@ -0,0 +1,382 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#if defined(__linux__)
+
+#include "transport/shm_transport.h"
+#include "common/result.h"
+#include "someip/message_pool.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <limits>
+
+namespace someip {
+namespace transport {
+
+namespace {
+
+constexpr uint32_t SHM_MAGIC = 0x53495053;  // "SPIS"
+
+int futex_wait(std::atomic<uint32_t>* addr, uint32_t expected, int timeout_ms) {
+    timespec ts{};
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    return static_cast<int>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr),
+                                    FUTEX_WAIT, expected, &ts, nullptr, 0));
+}
+
+void futex_wake(std::atomic<uint32_t>* addr) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE,
+            std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+}
+
+} // namespace
+
+/**
+ * Shared segment layout: a Vyukov-style multi-producer ring of fixed
+ * slots. Producers in other processes claim slots by CAS on tail;
+ * the single consumer (owning process) advances head. The tail also
+ * serves as the futex word consumers sleep on.
+ */
+struct ShmTransport::Segment {
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        uint32_t length;
+        uint8_t data[SLOT_SIZE];
+    };
+
+    uint32_t magic;
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;  // Futex word: bumped on every enqueue
+    Slot slots[SLOT_COUNT];
+
+    void init() {
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < SLOT_COUNT; ++i) {
+            slots[i].sequence.store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+            slots[i].length = 0;
+        }
+        magic = SHM_MAGIC;
+    }
+
+    // Multi-producer enqueue: false when the ring is full or the frame
+    // does not fit a slot
+    bool enqueue(const uint8_t* frame, size_t length) {
+        if (length > SLOT_SIZE) {
+            return false;
+        }
+
+        uint32_t pos = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[pos & (SLOT_COUNT - 1)];
+            uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+            int32_t diff = static_cast<int32_t>(seq) - static_cast<int32_t>(pos);
+
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.length = static_cast<uint32_t>(length);
+                    std::memcpy(slot.data, frame, length);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    futex_wake(&tail);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Single-consumer dequeue
+    bool dequeue(std::vector<uint8_t>& frame) {
+        uint32_t pos = head.load(std::memory_order_relaxed);
+        Slot& slot = slots[pos & (SLOT_COUNT - 1)];
+        uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+        int32_t diff = static_cast<int32_t>(seq) - static_cast<int32_t>(pos + 1);
+
+        if (diff < 0) {
+            return false;  // Empty
+        }
+
+        frame.assign(slot.data, slot.data + slot.length);
+        slot.sequence.store(pos + SLOT_COUNT, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+bool ShmTransport::is_same_host(const Endpoint& local, const Endpoint& remote) {
+    const std::string& address = remote.get_address();
+    return address.rfind("127.", 0) == 0 || address == "localhost" ||
+           address == local.get_address();
+}
+
+std::string ShmTransport::segment_name(uint16_t port) {
+    return "/someip_shm_" + std::to_string(port);
+}
+
+ShmTransport::ShmTransport(const Endpoint& local_endpoint)
+    : local_endpoint_(local_endpoint),
+      shm_name_(segment_name(local_endpoint.get_port())),
+      receive_queue_(1024) {
+    if (!local_endpoint_.is_valid()) {
+        throw std::invalid_argument("Invalid local endpoint");
+    }
+}
+
+ShmTransport::~ShmTransport() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - intentional cleanup
+    stop();
+}
+
+Result ShmTransport::send_message(const Message& message, const Endpoint& endpoint) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+    Segment* peer = map_peer(endpoint.get_port());
+    if (!peer) {
+        return Result::NOT_CONNECTED;  // No listener owns that segment
+    }
+
+    // Serialize header + payload into one frame on the stack when it
+    // fits a slot; the ring copy is the only copy on this path
+    const PayloadBuffer& payload = message.get_payload();
+    size_t frame_size = Message::HEADER_SIZE + payload.size();
+    if (frame_size > SLOT_SIZE) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    uint8_t frame[SLOT_SIZE];
+    message.serialize_header(frame);
+    if (!payload.empty()) {
+        std::memcpy(frame + Message::HEADER_SIZE, payload.data(), payload.size());
+    }
+
+    if (!peer->enqueue(frame, frame_size)) {
+        return Result::BUFFER_OVERFLOW;  // Receiver's ring is full
+    }
+
+    return Result::SUCCESS;
+}
+
+MessagePtr ShmTransport::receive_message() {
+    MessagePtr message;
+    if (!receive_queue_.pop(message)) {
+        return nullptr;
+    }
+    return message;
+}
+
+Result ShmTransport::connect(const Endpoint& endpoint) {
+    // Connectionless, like UDP: validate only
+    if (!endpoint.is_valid()) {
+        return Result::INVALID_ENDPOINT;
+    }
+    return Result::SUCCESS;
+}
+
+Result ShmTransport::disconnect() {
+    return Result::SUCCESS;
+}
+
+bool ShmTransport::is_connected() const {
+    return is_running();
+}
+
+Endpoint ShmTransport::get_local_endpoint() const {
+    return local_endpoint_;
+}
+
+void ShmTransport::set_listener(ITransportListener* listener) {
+    listener_ = listener;
+}
+
+Result ShmTransport::start() {
+    if (is_running()) {
+        return Result::SUCCESS;
+    }
+
+    if (!create_segment()) {
+        return Result::NETWORK_ERROR;
+    }
+
+    running_ = true;
+    receive_thread_ = std::thread(&ShmTransport::receive_loop, this);
+
+    return Result::SUCCESS;
+}
+
+Result ShmTransport::stop() {
+    // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall) - safe: no override expected
+    if (!running_.load()) {
+        return Result::SUCCESS;
+    }
+
+    running_ = false;
+
+    // Bump the futex word so the receive thread observes running_ == false
+    if (segment_) {
+        futex_wake(&segment_->tail);
+    }
+
+    if (receive_thread_.joinable()) {
+        receive_thread_.join();
+    }
+
+    destroy_segment();
+
+    return Result::SUCCESS;
+}
+
+bool ShmTransport::is_running() const {
+    return running_;
+}
+
+bool ShmTransport::create_segment() {
+    shm_fd_ = shm_open(shm_name_.c_str(), O_CREAT | O_RDWR, 0600);
+    if (shm_fd_ < 0) {
+        return false;
+    }
+
+    if (ftruncate(shm_fd_, sizeof(Segment)) < 0) {
+        close(shm_fd_);
+        shm_fd_ = -1;
+        shm_unlink(shm_name_.c_str());
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, shm_fd_, 0);
+    if (mapped == MAP_FAILED) {
+        close(shm_fd_);
+        shm_fd_ = -1;
+        shm_unlink(shm_name_.c_str());
+        return false;
+    }
+
+    segment_ = static_cast<Segment*>(mapped);
+    segment_->init();
+    return true;
+}
+
+void ShmTransport::destroy_segment() {
+    {
+        std::scoped_lock lock(peers_mutex_);
+        for (auto& [port, peer] : peers_) {
+            if (peer.segment) {
+                munmap(peer.segment, sizeof(Segment));
+            }
+            if (peer.fd >= 0) {
+                close(peer.fd);
+            }
+        }
+        peers_.clear();
+    }
+
+    if (segment_) {
+        munmap(segment_, sizeof(Segment));
+        segment_ = nullptr;
+    }
+    if (shm_fd_ >= 0) {
+        close(shm_fd_);
+        shm_fd_ = -1;
+        shm_unlink(shm_name_.c_str());  // We own the receive segment
+    }
+}
+
+ShmTransport::Segment* ShmTransport::map_peer(uint16_t port) {
+    if (port == local_endpoint_.get_port()) {
+        return segment_;  // Loopback to ourselves
+    }
+
+    std::scoped_lock lock(peers_mutex_);
+
+    auto it = peers_.find(port);
+    if (it != peers_.end()) {
+        return it->second.segment;
+    }
+
+    // First send to this port: map the peer's segment (created by its
+    // own start()); failure means no same-host listener exists
+    int fd = shm_open(segment_name(port).c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    void* mapped = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    if (mapped == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+
+    auto* segment = static_cast<Segment*>(mapped);
+    if (segment->magic != SHM_MAGIC) {
+        munmap(segment, sizeof(Segment));
+        close(fd);
+        return nullptr;
+    }
+
+    peers_[port] = MappedPeer{fd, segment};
+    return segment;
+}
+
+void ShmTransport::receive_loop() {
+    std::vector<uint8_t> frame;
+    frame.reserve(SLOT_SIZE);
+
+    // Senders cannot tell us their endpoint through the ring, so the
+    // logical sender is "this host"; port 0 marks it as synthetic
+    Endpoint sender("127.0.0.1", 0, TransportProtocol::UDP);
+
+    while (running_) {
+        if (!segment_->dequeue(frame)) {
+            // Sleep on the tail futex until a producer bumps it; the
+            // timeout bounds shutdown latency if the wake is missed
+            uint32_t observed = segment_->tail.load(std::memory_order_acquire);
+            if (!running_) {
+                break;
+            }
+            if (segment_->head.load(std::memory_order_relaxed) == observed) {
+                futex_wait(&segment_->tail, observed, 100);
+            }
+            continue;
+        }
+
+        MessagePtr message = MessagePool::get_default()->acquire();
+        if (message->deserialize(frame)) {
+            receive_queue_.push(message);
+
+            if (listener_) {
+                listener_->on_message_received(message, sender);
+            }
+        }
+    }
+}
+
+} // namespace transport
+} // namespace someip
+
+#endif // defined(__linux__)
@@ -13,24 +13,75 @@
 
 #include "transport/tcp_transport.h"
 #include "common/result.h"
+#include "someip/message_pool.h"
+#include "common/lz4_codec.h"
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/select.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
+#include <poll.h>
 #include <cstring>
 #include <iostream>
 #include <algorithm>
 #include <cerrno>
 #include <cstdio>
 
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <linux/errqueue.h>
+#endif
+
+// MSG_ZEROCOPY needs both the send flag and the socket option
+#if defined(__linux__) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#define SOMEIP_HAS_MSG_ZEROCOPY 1
+#else
+#define SOMEIP_HAS_MSG_ZEROCOPY 0
+#endif
+
 namespace someip {
 namespace transport {
 
+namespace {
+
+Endpoint endpoint_from_sockaddr(const sockaddr_in& addr) {
+    char ip_str[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &addr.sin_addr, ip_str, sizeof(ip_str));
+    return Endpoint(ip_str, ntohs(addr.sin_port), TransportProtocol::TCP);
+}
+
+// Block until the socket is writable again (send buffer drained) or
+// the timeout elapses. The sockets are non-blocking, so an EAGAIN from
+// a send must park here instead of hot-spinning on the syscall.
+bool wait_writable(int socket_fd, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        pollfd pfd{};
+        pfd.fd = socket_fd;
+        pfd.events = POLLOUT;
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (left.count() < 0) {
+            return false;
+        }
+        int ret = poll(&pfd, 1, static_cast<int>(left.count()));
+        if (ret < 0 && errno == EINTR) {
+            continue;  // Signal; re-poll with the remaining budget
+        }
+        return ret > 0 && (pfd.revents & POLLOUT) != 0;
+    }
+}
+
+} // namespace
+
 TcpTransport::TcpTransport(const TcpTransportConfig& config)
-    : config_(config) {
+    : config_(config),
+      message_queue_(config.receive_queue_capacity, config.overflow_policy) {
 }
 
 TcpTransport::~TcpTransport() {
@@ -57,7 +108,7 @@ Result TcpTransport::initialize(const Endpoint& local_endpoint) {
     // Update local endpoint with the actual bound port (useful when port was 0)
     sockaddr_in bound_addr;
     socklen_t addr_len = sizeof(bound_addr);
-    if (getsockname(connection_.socket_fd, (sockaddr*)&bound_addr, &addr_len) == 0) {
+    if (getsockname(listen_socket_fd_, (sockaddr*)&bound_addr, &addr_len) == 0) {
         local_endpoint_ = Endpoint(local_endpoint_.get_address(), ntohs(bound_addr.sin_port));
     }
 
@@ -65,45 +116,111 @@ Result TcpTransport::initialize(const Endpoint& local_endpoint) {
 }
 
 Result TcpTransport::send_message(const Message& message, const Endpoint& endpoint) {
-    if (!is_connected()) {
+    // Route by destination endpoint; with a single live connection the
+    // endpoint may be anything (old single-connection behavior)
+    int socket_fd = lookup_route(endpoint);
+    if (socket_fd < 0) {
         return Result::NOT_CONNECTED;
     }
 
-    // For TCP, we ignore the endpoint parameter and send over the established connection
-    // The endpoint is mainly used for UDP routing
+    // Opt-in LZ4 stage for bulk payloads, applied at most once: the
+    // receive side strips exactly one layer, so an already-wrapped
+    // payload (including forwarded compressed frames) must pass
+    // through untouched
+    Message compact_storage;
+    const Message* to_send = &message;
+    if (config_.enable_compression &&
+        message.get_payload().size() >= config_.compression_threshold &&
+        !lz4::is_compressed_payload(message.get_payload().data(),
+                                    message.get_payload().size())) {
+        std::vector<uint8_t> compressed;
+        if (lz4::compress_payload(std::vector<uint8_t>(message.get_payload().begin(),
+                                                       message.get_payload().end()),
+                                  compressed)) {
+            compact_storage = message;
+            compact_storage.set_payload(std::move(compressed));
+            to_send = &compact_storage;
+        }
+    }
 
-    // Serialize message
-    std::vector<uint8_t> data = message.serialize();
+    // Scatter-gather send: header into a stack buffer, payload
+    // referenced in place — large payloads are never copied just to
+    // prepend 16 bytes of header
+    uint8_t header[Message::HEADER_SIZE];
+    to_send->serialize_header(header);
+    const PayloadBuffer& payload = to_send->get_payload();
 
-    // Send data
-    Result result = send_data(connection_.socket_fd, data);
+    struct iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len = sizeof(header);
+    iov[1].iov_base = const_cast<uint8_t*>(payload.data());
+    iov[1].iov_len = payload.size();
+
+    Result result = send_vectored(socket_fd, iov, payload.empty() ? 1 : 2);
     if (result == Result::SUCCESS) {
-        connection_.update_activity();
+        std::scoped_lock lock(connection_mutex_);
+        auto it = connections_.find(socket_fd);
+        if (it != connections_.end()) {
+            it->second.update_activity();
+        }
     }
 
     return result;
 }
 
-MessagePtr TcpTransport::receive_message() {
-    std::scoped_lock lock(queue_mutex_);
-    if (message_queue_.empty()) {
-        return nullptr;
+Result TcpTransport::send_message(const MessagePtr& message, const Endpoint& endpoint) {
+    if (!message) {
+        return Result::INVALID_ENDPOINT;
+    }
+
+#if SOMEIP_HAS_MSG_ZEROCOPY
+    if (config_.zerocopy_enabled &&
+        message->get_payload().size() >= config_.zerocopy_threshold) {
+        int socket_fd = lookup_route(endpoint);
+        if (socket_fd < 0) {
+            return Result::NOT_CONNECTED;
+        }
+
+        Result result = send_zerocopy(socket_fd, message);
+        if (result != Result::NOT_IMPLEMENTED) {
+            return result;
+        }
+        // NOT_IMPLEMENTED: socket refused zero-copy; use the copy path
     }
+#endif
 
-    auto [message, sender] = message_queue_.front();
-    message_queue_.pop();
-    return message;
+    return send_message(*message, endpoint);
 }
 
-Result TcpTransport::connect(const Endpoint& endpoint) {
-    if (is_connected()) {
-        return Result::SUCCESS;  // Already connected
+Result TcpTransport::send_serialized(const std::vector<uint8_t>& data,
+                                     const Endpoint& endpoint) {
+    int socket_fd = lookup_route(endpoint);
+    if (socket_fd < 0) {
+        return Result::NOT_CONNECTED;
+    }
+    return send_data(socket_fd, data);
+}
+
+MessagePtr TcpTransport::receive_message() {
+    std::pair<MessagePtr, Endpoint> entry;
+    if (!message_queue_.pop(entry)) {
+        return nullptr;
     }
+    return entry.first;
+}
 
+Result TcpTransport::connect(const Endpoint& endpoint) {
     if (server_mode_) {
         return Result::INVALID_STATE;  // Server mode doesn't connect
     }
 
+    {
+        std::scoped_lock lock(connection_mutex_);
+        if (endpoint_to_fd_.count(endpoint) != 0) {
+            return Result::SUCCESS;  // Already connected to this peer
+        }
+    }
+
     return connect_internal(endpoint);
 }
 
@@ -117,7 +234,7 @@ Result TcpTransport::disconnect() {
 }
 
 bool TcpTransport::is_connected() const {
-    return connection_.is_connected();
+    return active_connections_.load() > 0;
 }
 
 Endpoint TcpTransport::get_local_endpoint() const {
@@ -133,13 +250,57 @@ Result TcpTransport::start() {
         return Result::SUCCESS;
     }
 
+#if defined(__linux__)
+    // eventfd so stop() and table changes can interrupt the event wait
+    wakeup_fds_[0] = eventfd(0, EFD_NONBLOCK);
+    if (wakeup_fds_[0] < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    epoll_fd_ = epoll_create1(0);
+    if (epoll_fd_ < 0) {
+        close(wakeup_fds_[0]);
+        wakeup_fds_[0] = -1;
+        return Result::NETWORK_ERROR;
+    }
+
+    // Idle sweeps ride the same loop via a timerfd instead of a thread
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    if (timer_fd_ >= 0) {
+        itimerspec interval{};
+        interval.it_interval.tv_sec = 30;
+        interval.it_value.tv_sec = 30;
+        timerfd_settime(timer_fd_, 0, &interval, nullptr);
+        watch_fd(timer_fd_);
+    }
+
+    watch_fd(wakeup_fds_[0]);
+    if (server_mode_ && listen_socket_fd_ >= 0) {
+        watch_fd(listen_socket_fd_);
+    }
+    {
+        std::scoped_lock lock(connection_mutex_);
+        for (const auto& [fd, connection] : connections_) {
+            watch_fd(fd);
+        }
+    }
+#else
+    // Self-pipe so stop() and table changes can interrupt the event wait
+    if (pipe(wakeup_fds_) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+    fcntl(wakeup_fds_[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakeup_fds_[1], F_SETFL, O_NONBLOCK);
+#endif
+
     running_ = true;
 
-    // Start receive thread
-    receive_thread_ = std::thread(&TcpTransport::receive_loop, this);
+    // One event loop services accepts, reads, wakeups and idle sweeps
+    event_thread_ = std::thread(&TcpTransport::event_loop, this);
 
-    // Start connection monitor thread
-    connection_thread_ = std::thread(&TcpTransport::connection_monitor_loop, this);
+    if (config_.auto_reconnect) {
+        reconnect_thread_ = std::thread(&TcpTransport::reconnect_loop, this);
+    }
 
     return Result::SUCCESS;
 }
@@ -150,22 +311,52 @@ Result TcpTransport::stop() {
     }
 
     running_ = false;
+    wake_event_loop();
+
+    // Wait for the event loop to finish
+    if (event_thread_.joinable()) {
+        event_thread_.join();
+    }
+    if (reconnect_thread_.joinable()) {
+        reconnect_thread_.join();
+    }
+
+    // Release unused standby sockets
+    {
+        std::scoped_lock lock(standby_mutex_);
+        for (auto& [endpoint, fds] : standby_) {
+            for (int fd : fds) {
+                close(fd);
+            }
+        }
+        standby_.clear();
+        reconnect_queue_.clear();
+    }
 
     // Close connections
     disconnect_internal();
 
-    // Close listen socket if in server mode
-    if (server_mode_ && listen_socket_fd_ != -1) {
+    if (listen_socket_fd_ != -1) {
         close(listen_socket_fd_);
         listen_socket_fd_ = -1;
     }
 
-    // Wait for threads to finish
-    if (receive_thread_.joinable()) {
-        receive_thread_.join();
+#if defined(__linux__)
+    if (timer_fd_ != -1) {
+        close(timer_fd_);
+        timer_fd_ = -1;
     }
-    if (connection_thread_.joinable()) {
-        connection_thread_.join();
+    if (epoll_fd_ != -1) {
+        close(epoll_fd_);
+        epoll_fd_ = -1;
+    }
+#endif
+
+    for (int& fd : wakeup_fds_) {
+        if (fd != -1) {
+            close(fd);
+            fd = -1;
+        }
     }
 
     return Result::SUCCESS;
@@ -176,20 +367,25 @@ bool TcpTransport::is_running() const {
 }
 
 TcpConnectionState TcpTransport::get_connection_state() const {
-    return connection_.state;
+    return is_connected() ? TcpConnectionState::CONNECTED
+                          : TcpConnectionState::DISCONNECTED;
 }
 
 Result TcpTransport::enable_server_mode(int backlog) {
-    if (connection_.socket_fd == -1) {
+    if (listen_socket_fd_ == -1) {
         return Result::NOT_INITIALIZED;
     }
 
-    if (listen(connection_.socket_fd, backlog) < 0) {
+    if (listen(listen_socket_fd_, backlog) < 0) {
         return Result::NETWORK_ERROR;
     }
 
     server_mode_ = true;
-    listen_socket_fd_ = connection_.socket_fd;
+
+    if (running_) {
+        watch_fd(listen_socket_fd_);
+        wake_event_loop();
+    }
 
     return Result::SUCCESS;
 }
@@ -202,7 +398,7 @@ int TcpTransport::accept_connection() {
     sockaddr_in client_addr;
     socklen_t client_len = sizeof(client_addr);
 
-    // For server mode, make the accept blocking temporarily
+    // For manual accepts, make the accept blocking temporarily
     int flags = fcntl(listen_socket_fd_, F_GETFL, 0);
     fcntl(listen_socket_fd_, F_SETFL, flags & ~O_NONBLOCK);
 
@@ -212,32 +408,41 @@ int TcpTransport::accept_connection() {
     fcntl(listen_socket_fd_, F_SETFL, flags);
 
     if (client_fd < 0) {
-        if (errno != EAGAIN && errno != EWOULDBLOCK) {
-            // Accept failed
-        }
         return -1;
     }
 
-    // Set socket options for client connection (blocking for simplicity)
-    setup_socket_options(client_fd, true);
+    // Event-loop sockets are non-blocking
+    setup_socket_options(client_fd, false);
+    register_connection(client_fd, endpoint_from_sockaddr(client_addr));
+
+    if (listener_) {
+        listener_->on_connection_established(endpoint_from_sockaddr(client_addr));
+    }
 
     return client_fd;
 }
 
+size_t TcpTransport::get_connection_count() const {
+    return active_connections_.load();
+}
+
 // Private helper methods
 
 Result TcpTransport::create_socket() {
-    connection_.socket_fd = socket(AF_INET, SOCK_STREAM, 0);
-    if (connection_.socket_fd < 0) {
+    listen_socket_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_socket_fd_ < 0) {
         return Result::NETWORK_ERROR;
     }
 
+    int reuse = 1;
+    setsockopt(listen_socket_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
     // Set socket options (listening socket should be non-blocking)
-    return setup_socket_options(connection_.socket_fd, false);
+    return setup_socket_options(listen_socket_fd_, false);
 }
 
 Result TcpTransport::bind_socket() {
-    if (connection_.socket_fd == -1) {
+    if (listen_socket_fd_ == -1) {
         return Result::NOT_INITIALIZED;
     }
 
@@ -247,7 +452,7 @@ Result TcpTransport::bind_socket() {
     addr.sin_port = htons(local_endpoint_.get_port());
     addr.sin_addr.s_addr = inet_addr(local_endpoint_.get_address().c_str());
 
-    if (bind(connection_.socket_fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+    if (bind(listen_socket_fd_, (sockaddr*)&addr, sizeof(addr)) < 0) {
         return Result::NETWORK_ERROR;
     }
 
@@ -303,175 +508,755 @@ Result TcpTransport::setup_socket_options(int socket_fd, bool blocking) {
     return Result::SUCCESS;
 }
 
-Result TcpTransport::connect_internal(const Endpoint& endpoint) {
+int TcpTransport::dial(const Endpoint& endpoint, std::chrono::milliseconds timeout) {
+    int socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_fd < 0) {
+        return -1;
+    }
+
+    int reuse = 1;
+    setsockopt(socket_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    setup_socket_options(socket_fd, false);
+
     sockaddr_in addr;
     memset(&addr, 0, sizeof(addr));
     addr.sin_family = AF_INET;
     addr.sin_port = htons(endpoint.get_port());
     addr.sin_addr.s_addr = inet_addr(endpoint.get_address().c_str());
 
-    connection_.state = TcpConnectionState::CONNECTING;
-    connection_.remote_endpoint = endpoint;
+    int connect_result = ::connect(socket_fd, (sockaddr*)&addr, sizeof(addr));
+    if (connect_result != 0 && errno == EINPROGRESS) {
+        fd_set write_fds;
+        FD_ZERO(&write_fds);
+        FD_SET(socket_fd, &write_fds);
+        struct timeval tv = {
+            static_cast<time_t>(timeout.count() / 1000),
+            static_cast<suseconds_t>((timeout.count() % 1000) * 1000)
+        };
+        connect_result = select(socket_fd + 1, nullptr, &write_fds, nullptr, &tv);
+        if (connect_result > 0) {
+            int error = 0;
+            socklen_t len = sizeof(error);
+            getsockopt(socket_fd, SOL_SOCKET, SO_ERROR, &error, &len);
+            connect_result = (error == 0) ? 0 : -1;
+        } else {
+            connect_result = -1;
+        }
+    }
 
-    int connect_result = ::connect(connection_.socket_fd, (sockaddr*)&addr, sizeof(addr));
+    if (connect_result != 0) {
+        close(socket_fd);
+        return -1;
+    }
+    return socket_fd;
+}
 
-    if (connect_result == 0) {
-        // Connected immediately
-        connection_.state = TcpConnectionState::CONNECTED;
-        connection_.update_activity();
+Result TcpTransport::warm_up(const Endpoint& endpoint, size_t target_standby) {
+    // Ensure the routed connection exists first
+    Result routed = connect(endpoint);
+    if (routed != Result::SUCCESS) {
+        return routed;
+    }
 
-        if (listener_) {
-            listener_->on_connection_established(endpoint);
+    std::scoped_lock lock(standby_mutex_);
+    auto& standbys = standby_[endpoint];
+    while (standbys.size() < target_standby) {
+        int fd = dial(endpoint, config_.connection_timeout);
+        if (fd < 0) {
+            return Result::NETWORK_ERROR;
+        }
+        standbys.push_back(fd);
+    }
+    return Result::SUCCESS;
+}
+
+size_t TcpTransport::standby_count(const Endpoint& endpoint) const {
+    std::scoped_lock lock(standby_mutex_);
+    auto it = standby_.find(endpoint);
+    return it == standby_.end() ? 0 : it->second.size();
+}
+
+void TcpTransport::schedule_reconnect(const Endpoint& endpoint) {
+    std::scoped_lock lock(standby_mutex_);
+    for (const auto& entry : reconnect_queue_) {
+        if (entry.endpoint == endpoint) {
+            return;  // Already queued
         }
+    }
+    reconnect_queue_.push_back(
+        {endpoint, std::chrono::steady_clock::now() + config_.reconnect_base,
+         config_.reconnect_base});
+}
 
-        return Result::SUCCESS;
-    } else if (errno == EINPROGRESS) {
+void TcpTransport::reconnect_loop() {
+    while (running_) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        std::vector<Endpoint> due;
+        {
+            std::scoped_lock lock(standby_mutex_);
+            auto now = std::chrono::steady_clock::now();
+            for (auto& entry : reconnect_queue_) {
+                if (now >= entry.next_attempt) {
+                    due.push_back(entry.endpoint);
+                    entry.backoff = std::min(entry.backoff * 2, config_.reconnect_max);
+                    entry.next_attempt = now + entry.backoff;
+                }
+            }
+        }
+
+        for (const auto& endpoint : due) {
+            if (!running_) {
+                break;
+            }
+            // Short dial so one dead peer cannot stall the others
+            int fd = dial(endpoint, std::chrono::milliseconds(
+                                        std::min<int64_t>(config_.connection_timeout.count(), 500)));
+            if (fd < 0) {
+                continue;
+            }
+
+            register_connection(fd, endpoint, true);
+            if (listener_) {
+                listener_->on_connection_established(endpoint);
+            }
+
+            std::scoped_lock lock(standby_mutex_);
+            reconnect_queue_.erase(
+                std::remove_if(reconnect_queue_.begin(), reconnect_queue_.end(),
+                               [&](const ReconnectEntry& entry) {
+                                   return entry.endpoint == endpoint;
+                               }),
+                reconnect_queue_.end());
+        }
+    }
+}
+
+Result TcpTransport::connect_internal(const Endpoint& endpoint) {
+    // Each outgoing connection gets its own socket so one transport can
+    // talk to several peers; the local endpoint is shared via REUSEADDR
+    int socket_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_fd < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    int reuse = 1;
+    setsockopt(socket_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    setup_socket_options(socket_fd, false);
+
+    if (local_endpoint_.is_valid()) {
+        sockaddr_in local_addr;
+        memset(&local_addr, 0, sizeof(local_addr));
+        local_addr.sin_family = AF_INET;
+        local_addr.sin_port = htons(local_endpoint_.get_port());
+        local_addr.sin_addr.s_addr = inet_addr(local_endpoint_.get_address().c_str());
+        bind(socket_fd, (sockaddr*)&local_addr, sizeof(local_addr));  // Best effort
+    }
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(endpoint.get_port());
+    addr.sin_addr.s_addr = inet_addr(endpoint.get_address().c_str());
+
+    int connect_result = ::connect(socket_fd, (sockaddr*)&addr, sizeof(addr));
+
+    if (connect_result != 0 && errno == EINPROGRESS) {
         // Connection in progress - wait for completion
         fd_set write_fds;
         FD_ZERO(&write_fds);
-        FD_SET(connection_.socket_fd, &write_fds);
+        FD_SET(socket_fd, &write_fds);
 
         struct timeval timeout = {
             static_cast<time_t>(config_.connection_timeout.count() / 1000),
             static_cast<suseconds_t>((config_.connection_timeout.count() % 1000) * 1000)
         };
 
-        connect_result = select(connection_.socket_fd + 1, nullptr, &write_fds, nullptr, &timeout);
+        connect_result = select(socket_fd + 1, nullptr, &write_fds, nullptr, &timeout);
 
         if (connect_result > 0) {
-            // Check if connection was successful
             int error = 0;
             socklen_t len = sizeof(error);
-            getsockopt(connection_.socket_fd, SOL_SOCKET, SO_ERROR, &error, &len);
+            getsockopt(socket_fd, SOL_SOCKET, SO_ERROR, &error, &len);
+            connect_result = (error == 0) ? 0 : -1;
+        } else {
+            connect_result = -1;
+        }
+    }
 
-            if (error == 0) {
-                connection_.state = TcpConnectionState::CONNECTED;
-                connection_.update_activity();
+    if (connect_result != 0) {
+        close(socket_fd);
+        return Result::NETWORK_ERROR;
+    }
 
-                if (listener_) {
-                    listener_->on_connection_established(endpoint);
-                }
+    register_connection(socket_fd, endpoint, true);
 
-                return Result::SUCCESS;
-            }
+    if (listener_) {
+        listener_->on_connection_established(endpoint);
+    }
+
+    return Result::SUCCESS;
+}
+
+void TcpTransport::disconnect_internal() {
+    std::vector<int> fds;
+    {
+        std::scoped_lock lock(connection_mutex_);
+        fds.reserve(connections_.size());
+        for (const auto& [fd, connection] : connections_) {
+            fds.push_back(fd);
         }
+    }
 
-        // Connection failed
-        disconnect_internal();
-        return Result::NETWORK_ERROR;
-    } else {
-        // Immediate connection failure
-        connection_.state = TcpConnectionState::DISCONNECTED;
-        return Result::NETWORK_ERROR;
+    for (int fd : fds) {
+        close_connection(fd, true);
     }
 }
 
-void TcpTransport::disconnect_internal() {
-    std::scoped_lock lock(connection_mutex_);
+void TcpTransport::register_connection(int socket_fd, const Endpoint& remote_endpoint, bool outbound) {
+    {
+        std::scoped_lock lock(connection_mutex_);
+
+        TcpConnection connection;
+        connection.socket_fd = socket_fd;
+        connection.remote_endpoint = remote_endpoint;
+        connection.state = TcpConnectionState::CONNECTED;
+        connection.update_activity();
+        connection.receive_buffer.reserve(4096);
+        connection.outbound = outbound;
+
+#if SOMEIP_HAS_MSG_ZEROCOPY
+        if (config_.zerocopy_enabled) {
+            int enable = 1;
+            connection.zerocopy_enabled =
+                setsockopt(socket_fd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0;
+        }
+#endif
 
-    if (connection_.socket_fd != -1) {
-        connection_.state = TcpConnectionState::DISCONNECTING;
+        connections_.emplace(socket_fd, std::move(connection));
+        endpoint_to_fd_[remote_endpoint] = socket_fd;
+        active_connections_ = connections_.size();
+    }
 
-        shutdown(connection_.socket_fd, SHUT_RDWR);
-        close(connection_.socket_fd);
-        connection_.socket_fd = -1;
+    if (running_) {
+        watch_fd(socket_fd);
+        wake_event_loop();
+    }
+}
 
-        connection_.state = TcpConnectionState::DISCONNECTED;
+void TcpTransport::close_connection(int socket_fd, bool notify) {
+    Endpoint remote;
+    bool outbound = false;
+    {
+        std::scoped_lock lock(connection_mutex_);
+        auto it = connections_.find(socket_fd);
+        if (it == connections_.end()) {
+            return;
+        }
 
-        // Decrement active connection count
-        if (active_connections_.load() > 0) {
-            active_connections_.fetch_sub(1);
+        remote = it->second.remote_endpoint;
+        outbound = it->second.outbound;
+
+        auto route = endpoint_to_fd_.find(remote);
+        if (route != endpoint_to_fd_.end() && route->second == socket_fd) {
+            endpoint_to_fd_.erase(route);
         }
+        connections_.erase(it);
+        active_connections_ = connections_.size();
+    }
 
-        if (listener_) {
-            listener_->on_connection_lost(connection_.remote_endpoint);
+    unwatch_fd(socket_fd);
+    shutdown(socket_fd, SHUT_RDWR);
+    close(socket_fd);
+
+    // Outbound peers: promote a warm standby instantly, or queue a
+    // background redial with backoff
+    if (outbound && running_) {
+        int standby_fd = -1;
+        {
+            std::scoped_lock lock(standby_mutex_);
+            auto it = standby_.find(remote);
+            if (it != standby_.end() && !it->second.empty()) {
+                standby_fd = it->second.back();
+                it->second.pop_back();
+            }
+        }
+
+        if (standby_fd >= 0) {
+            register_connection(standby_fd, remote, true);
+            if (config_.auto_reconnect) {
+                schedule_reconnect(remote);  // Replenish the consumed standby
+            }
+        } else if (config_.auto_reconnect) {
+            schedule_reconnect(remote);
         }
     }
+
+    if (notify && listener_) {
+        listener_->on_connection_lost(remote);
+    }
 }
 
-void TcpTransport::receive_loop() {
+void TcpTransport::watch_fd(int fd) {
+#if defined(__linux__)
+    if (epoll_fd_ >= 0) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event);
+    }
+#else
+    (void)fd;  // The poll() loop rebuilds its fd set every pass
+#endif
+}
+
+void TcpTransport::unwatch_fd(int fd) {
+#if defined(__linux__)
+    if (epoll_fd_ >= 0) {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+    }
+#else
+    (void)fd;
+#endif
+}
+
+void TcpTransport::wake_event_loop() {
+#if defined(__linux__)
+    if (wakeup_fds_[0] >= 0) {
+        uint64_t value = 1;
+        ssize_t written = write(wakeup_fds_[0], &value, sizeof(value));
+        (void)written;  // Counter saturation means a wakeup is already pending
+    }
+#else
+    if (wakeup_fds_[1] >= 0) {
+        uint8_t byte = 0;
+        ssize_t written = write(wakeup_fds_[1], &byte, 1);
+        (void)written;  // Pipe full means a wakeup is already pending
+    }
+#endif
+}
+
+void TcpTransport::event_loop() {
+#if defined(__linux__)
+    constexpr int kMaxEvents = 64;
+    epoll_event events[kMaxEvents];
+
     while (running_) {
-        if (server_mode_) {
-            // In server mode, accept new connections
-            if (listen_socket_fd_ != -1) {
-                // Check connection limit before accepting
-                if (active_connections_.load() >= config_.max_connections) {
-                    // Too many connections, wait a bit before checking again
-                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        int ready = epoll_wait(epoll_fd_, events, kMaxEvents, -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (running_ && listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+            break;
+        }
+
+        for (int i = 0; i < ready && running_; ++i) {
+            int fd = events[i].data.fd;
+
+            if (fd == wakeup_fds_[0]) {
+                uint64_t drain = 0;
+                while (read(wakeup_fds_[0], &drain, sizeof(drain)) > 0) {
+                }
+                continue;
+            }
+
+            if (fd == timer_fd_) {
+                uint64_t expirations = 0;
+                while (read(timer_fd_, &expirations, sizeof(expirations)) > 0) {
+                }
+                sweep_idle_connections();
+                continue;
+            }
+
+            if (server_mode_ && fd == listen_socket_fd_) {
+                handle_accept();
+                continue;
+            }
+
+            if (events[i].events & EPOLLERR) {
+                // Zero-copy completions arrive on the error queue; a
+                // bare EPOLLERR with nothing to reap is a real error
+                if (reap_zerocopy_completions(fd) == 0 &&
+                    (events[i].events & EPOLLIN) == 0) {
+                    close_connection(fd, true);
                     continue;
                 }
+            }
+
+            if (events[i].events & (EPOLLIN | EPOLLHUP)) {
+                handle_readable(fd);
+            }
+        }
+    }
+#else
+    // Portable fallback: poll() over a set rebuilt each pass; idle
+    // sweeps piggyback on the poll timeout
+    auto last_sweep = std::chrono::steady_clock::now();
+
+    while (running_) {
+        std::vector<pollfd> poll_fds;
+        poll_fds.push_back({wakeup_fds_[0], POLLIN, 0});
+        if (server_mode_ && listen_socket_fd_ >= 0) {
+            poll_fds.push_back({listen_socket_fd_, POLLIN, 0});
+        }
+        {
+            std::scoped_lock lock(connection_mutex_);
+            for (const auto& [fd, connection] : connections_) {
+                poll_fds.push_back({fd, POLLIN, 0});
+            }
+        }
+
+        int ready = poll(poll_fds.data(), poll_fds.size(), 1000);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (running_ && listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+            break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now - last_sweep >= std::chrono::seconds(30)) {
+            last_sweep = now;
+            sweep_idle_connections();
+        }
+
+        for (const pollfd& entry : poll_fds) {
+            if (!running_ || (entry.revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+                continue;
+            }
 
-                int client_fd = accept_connection();
-                if (client_fd != -1) {
-                    // For this simple implementation, we'll handle one client at a time
-                    // In a real implementation, you'd manage multiple client connections
-                    if (!is_connected()) {
-                        connection_.socket_fd = client_fd;
-                        connection_.state = TcpConnectionState::CONNECTED;
-                        connection_.remote_endpoint = Endpoint("127.0.0.1", 0, TransportProtocol::TCP); // Would need to get actual client address
-                        active_connections_.fetch_add(1);
-
-                        if (listener_) {
-                            listener_->on_connection_established(connection_.remote_endpoint);
-                        }
-                    } else {
-                        // Already have a connection, close this one
-                        close(client_fd);
-                    }
+            if (entry.fd == wakeup_fds_[0]) {
+                uint8_t drain[64];
+                while (read(wakeup_fds_[0], drain, sizeof(drain)) > 0) {
+                }
+            } else if (server_mode_ && entry.fd == listen_socket_fd_) {
+                handle_accept();
+            } else {
+                if ((entry.revents & POLLERR) != 0 &&
+                    reap_zerocopy_completions(entry.fd) == 0 &&
+                    (entry.revents & POLLIN) == 0) {
+                    close_connection(entry.fd, true);
+                    continue;
+                }
+                if (entry.revents & (POLLIN | POLLHUP)) {
+                    handle_readable(entry.fd);
                 }
             }
         }
+    }
+#endif
+}
+
+void TcpTransport::handle_accept() {
+    // Drain the accept backlog; the listen socket is non-blocking
+    while (running_) {
+        sockaddr_in client_addr;
+        socklen_t client_len = sizeof(client_addr);
+
+        int client_fd = accept(listen_socket_fd_, (sockaddr*)&client_addr, &client_len);
+        if (client_fd < 0) {
+            return;  // EAGAIN: backlog drained
+        }
 
-        if (!is_connected()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (active_connections_.load() >= config_.max_connections) {
+            // Table full: shed the connection instead of letting the
+            // backlog rot
+            close(client_fd);
             continue;
         }
 
-        std::vector<uint8_t> buffer;
-        Result result = receive_data(connection_.socket_fd, buffer);
+        setup_socket_options(client_fd, false);
 
-        if (result == Result::SUCCESS && !buffer.empty()) {
-            // Try to parse messages from buffer
+        Endpoint remote = endpoint_from_sockaddr(client_addr);
+        register_connection(client_fd, remote);
+
+        if (listener_) {
+            listener_->on_connection_established(remote);
+        }
+    }
+}
+
+void TcpTransport::handle_readable(int socket_fd) {
+    std::vector<std::pair<MessagePtr, Endpoint>> parsed;
+    bool failed = false;
+
+    {
+        std::scoped_lock lock(connection_mutex_);
+        auto it = connections_.find(socket_fd);
+        if (it == connections_.end()) {
+            return;  // Raced with a close
+        }
+
+        TcpConnection& connection = it->second;
+        Result result = receive_data(socket_fd, connection.receive_buffer);
+
+        if (result == Result::SUCCESS) {
+            // Drain every complete frame the stream holds so parsing
+            // never lags the socket
             MessagePtr message;
-            if (parse_message_from_buffer(buffer, message)) {
-                std::scoped_lock lock(queue_mutex_);
-                message_queue_.push({message, connection_.remote_endpoint});
-                connection_.update_activity();
+            while (parse_message_from_buffer(connection, message)) {
+                parsed.emplace_back(message, connection.remote_endpoint);
+                connection.update_activity();
+            }
+        } else {
+            failed = true;
+        }
+    }
 
-                if (listener_) {
-                    listener_->on_message_received(message, connection_.remote_endpoint);
-                }
-            } else {
-                // Failed to parse message from buffer
+    if (failed) {
+        close_connection(socket_fd, true);
+        if (listener_) {
+            listener_->on_error(Result::NETWORK_ERROR);
+        }
+        return;
+    }
+
+    if (parsed.empty()) {
+        return;
+    }
+
+    for (const auto& entry : parsed) {
+        // Lock-free push; a full ring applies the overflow policy
+        message_queue_.push(entry);
+    }
+
+    // All frames from one wakeup go downstream as a single batch
+    if (listener_) {
+        listener_->on_messages_received(parsed);
+    }
+}
+
+void TcpTransport::sweep_idle_connections() {
+    auto now = std::chrono::steady_clock::now();
+
+    std::vector<int> idle_fds;
+    {
+        std::scoped_lock lock(connection_mutex_);
+        for (const auto& [fd, connection] : connections_) {
+            auto idle_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                now - connection.last_activity);
+            if (idle_time > std::chrono::minutes(5)) {
+                idle_fds.push_back(fd);
             }
-        } else if (result != Result::SUCCESS) {
-            // Connection error
-            disconnect_internal();
+        }
+    }
 
-            if (listener_) {
-                listener_->on_error(result);
+    for (int fd : idle_fds) {
+        close_connection(fd, true);
+    }
+}
+
+int TcpTransport::lookup_route(const Endpoint& endpoint) const {
+    std::scoped_lock lock(connection_mutex_);
+
+    auto it = endpoint_to_fd_.find(endpoint);
+    if (it != endpoint_to_fd_.end()) {
+        return it->second;
+    }
+
+    // Single-connection transports keep the old "endpoint is ignored"
+    // behavior so existing request/response flows stay working
+    if (connections_.size() == 1) {
+        return connections_.begin()->first;
+    }
+
+    return -1;
+}
+
+Result TcpTransport::send_zerocopy(int socket_fd, const MessagePtr& message) {
+#if SOMEIP_HAS_MSG_ZEROCOPY
+    // Validate the connection under the lock, but run the send loop
+    // without it: holding connection_mutex_ across a blocked send would
+    // stall every other connection (and the receive path) behind one
+    // slow peer's socket buffer. The per-connection send mutex keeps
+    // concurrent zero-copy sends on the SAME connection in order, so
+    // the sequence accounting below matches the kernel's
+    std::shared_ptr<std::mutex> send_mutex;
+    {
+        std::scoped_lock lock(connection_mutex_);
+        auto it = connections_.find(socket_fd);
+        if (it == connections_.end()) {
+            return Result::NOT_CONNECTED;
+        }
+        if (!it->second.zerocopy_enabled) {
+            return Result::NOT_IMPLEMENTED;  // Caller falls back to the copy path
+        }
+        send_mutex = it->second.zerocopy_send_mutex;
+    }
+    std::scoped_lock send_lock(*send_mutex);
+
+    // The block owns the header bytes and the MessagePtr: the kernel
+    // transmits straight from these pages, so they must stay untouched
+    // until the completion notification releases them
+    auto block = std::make_unique<TcpZeroCopyBlock>();
+    block->message = message;
+    message->serialize_header(block->header.data());
+    const PayloadBuffer& payload = message->get_payload();
+
+    iovec iov[2];
+    iov[0].iov_base = block->header.data();
+    iov[0].iov_len = block->header.size();
+    iov[1].iov_base = const_cast<uint8_t*>(payload.data());
+    iov[1].iov_len = payload.size();
+
+    int index = 0;
+    int iov_count = 2;
+    uint32_t notifications = 0;
+
+    while (index < iov_count) {
+        msghdr msg{};
+        msg.msg_iov = iov + index;
+        msg.msg_iovlen = iov_count - index;
+
+        ssize_t sent = sendmsg(socket_fd, &msg, MSG_ZEROCOPY);
+
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;  // Retry
             }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                if (!wait_writable(socket_fd, config_.send_timeout)) {
+                    return Result::TIMEOUT;
+                }
+                continue;  // Buffer drained; retry
+            }
+            if (errno == ENOBUFS && notifications == 0) {
+                // Pinned-page budget exhausted before anything went out
+                return Result::NOT_IMPLEMENTED;  // Fall back to the copy path
+            }
+            return Result::NETWORK_ERROR;
+        } else if (sent == 0) {
+            return Result::NETWORK_ERROR;  // Connection closed
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ++notifications;  // Each successful MSG_ZEROCOPY send gets one
+
+        // Advance past fully-sent buffers, then trim the partial one
+        size_t remaining = static_cast<size_t>(sent);
+        while (index < iov_count && remaining >= iov[index].iov_len) {
+            remaining -= iov[index].iov_len;
+            ++index;
+        }
+        if (index < iov_count && remaining > 0) {
+            iov[index].iov_base = static_cast<uint8_t*>(iov[index].iov_base) + remaining;
+            iov[index].iov_len -= remaining;
+        }
     }
+
+    // Re-acquire the lock only for the inflight bookkeeping. If the
+    // connection died while we were sending, drop the block: the kernel
+    // holds its own references to the pinned pages, so releasing ours
+    // early is safe
+    {
+        std::scoped_lock lock(connection_mutex_);
+        auto it = connections_.find(socket_fd);
+        if (it == connections_.end()) {
+            return Result::NETWORK_ERROR;
+        }
+        TcpConnection& connection = it->second;
+        connection.zerocopy_next_seq += notifications;
+        block->last_seq = connection.zerocopy_next_seq - 1;
+        connection.zerocopy_inflight.push_back(std::move(block));
+        connection.update_activity();
+    }
+    zerocopy_sends_.fetch_add(1);
+
+    return Result::SUCCESS;
+#else
+    (void)socket_fd;
+    (void)message;
+    return Result::NOT_IMPLEMENTED;
+#endif
 }
 
-void TcpTransport::connection_monitor_loop() {
-    while (running_) {
-        if (is_connected()) {
-            auto now = std::chrono::steady_clock::now();
-            auto time_since_activity = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now - connection_.last_activity);
+size_t TcpTransport::reap_zerocopy_completions(int socket_fd) {
+#if SOMEIP_HAS_MSG_ZEROCOPY
+    size_t reaped = 0;
+
+    while (true) {
+        char control[128];
+        msghdr msg{};
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
 
-            // Check for connection timeout
-            if (time_since_activity > std::chrono::minutes(5)) {
-                disconnect_internal();
+        if (recvmsg(socket_fd, &msg, MSG_ERRQUEUE) < 0) {
+            break;  // EAGAIN: error queue drained
+        }
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                  (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))) {
+                continue;
+            }
+
+            auto* serr = reinterpret_cast<sock_extended_err*>(CMSG_DATA(cmsg));
+            if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                continue;
+            }
+
+            // ee_info..ee_data is the completed sequence range: every
+            // block fully covered may release its pinned pages
+            uint32_t completed_up_to = serr->ee_data;
+            ++reaped;
+
+            std::scoped_lock lock(connection_mutex_);
+            auto it = connections_.find(socket_fd);
+            if (it == connections_.end()) {
+                continue;
+            }
+
+            auto& inflight = it->second.zerocopy_inflight;
+            while (!inflight.empty() && inflight.front()->last_seq <= completed_up_to) {
+                inflight.pop_front();
             }
         }
+    }
+
+    return reaped;
+#else
+    (void)socket_fd;
+    return 0;
+#endif
+}
 
-        std::this_thread::sleep_for(std::chrono::seconds(30));
+Result TcpTransport::send_vectored(int socket_fd, struct iovec* iov, int iov_count) {
+    int index = 0;
+
+    while (index < iov_count) {
+        ssize_t sent = writev(socket_fd, iov + index, iov_count - index);
+
+        if (sent < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                if (!wait_writable(socket_fd, config_.send_timeout)) {
+                    return Result::TIMEOUT;
+                }
+                continue;  // Buffer drained; retry
+            }
+            return Result::NETWORK_ERROR;
+        } else if (sent == 0) {
+            return Result::NETWORK_ERROR;  // Connection closed
+        }
+
+        // Advance past fully-sent buffers, then trim the partial one
+        size_t remaining = static_cast<size_t>(sent);
+        while (index < iov_count && remaining >= iov[index].iov_len) {
+            remaining -= iov[index].iov_len;
+            ++index;
+        }
+        if (index < iov_count && remaining > 0) {
+            iov[index].iov_base = static_cast<uint8_t*>(iov[index].iov_base) + remaining;
+            iov[index].iov_len -= remaining;
+        }
     }
+
+    return Result::SUCCESS;
 }
 
 Result TcpTransport::send_data(int socket_fd, const std::vector<uint8_t>& data) {
@@ -483,7 +1268,10 @@ Result TcpTransport::send_data(int socket_fd, const std::vector<uint8_t>& data)
 
         if (sent < 0) {
             if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                continue;  // Retry
+                if (!wait_writable(socket_fd, config_.send_timeout)) {
+                    return Result::TIMEOUT;
+                }
+                continue;  // Buffer drained; retry
             }
             return Result::NETWORK_ERROR;
         } else if (sent == 0) {
@@ -519,28 +1307,59 @@ Result TcpTransport::receive_data(int socket_fd, std::vector<uint8_t>& data) {
     return Result::SUCCESS;
 }
 
-bool TcpTransport::parse_message_from_buffer(std::vector<uint8_t>& buffer, MessagePtr& message) {
-    // For TCP, we expect complete messages in the buffer since TCP is stream-oriented
-    // but our current implementation receives data in chunks
+void TcpTransport::compact_receive_buffer(TcpConnection& connection) {
+    std::vector<uint8_t>& buffer = connection.receive_buffer;
+    size_t& head = connection.receive_head;
+
+    if (head == 0) {
+        return;
+    }
 
-    // Enforce maximum receive buffer size
-    if (buffer.size() > config_.max_receive_buffer) {
+    if (head == buffer.size()) {
+        // Everything consumed: reset for free (capacity retained)
+        buffer.clear();
+        head = 0;
+        return;
+    }
+
+    // Shift only when the dead prefix dominates, so the cost is
+    // amortized O(1) per byte instead of O(n) per frame
+    if (head >= 4096 && head >= buffer.size() - head) {
+        buffer.erase(buffer.begin(), buffer.begin() + static_cast<ptrdiff_t>(head));
+        head = 0;
+    }
+}
+
+bool TcpTransport::parse_message_from_buffer(TcpConnection& connection, MessagePtr& message) {
+    // For TCP, we expect complete messages in the buffer since TCP is
+    // stream-oriented; frames are consumed by advancing receive_head
+    // so a burst of small messages costs no per-frame memmove
+    std::vector<uint8_t>& buffer = connection.receive_buffer;
+    size_t& head = connection.receive_head;
+    size_t live = buffer.size() - head;
+
+    // Enforce maximum receive buffer size on the live region
+    if (live > config_.max_receive_buffer) {
         buffer.clear();  // Clear oversized buffer
+        head = 0;
         return false;
     }
 
-    if (buffer.size() < SOMEIP_HEADER_SIZE) {
+    if (live < SOMEIP_HEADER_SIZE) {
+        compact_receive_buffer(connection);
         return false;  // Need at least header
     }
 
+    const uint8_t* data = buffer.data() + head;
+
     // Parse message length from header (bytes 4-7 in big-endian)
     // Length field contains length from client_id to end of message
-    uint32_t length_from_client_id = (buffer[4] << 24) | (buffer[5] << 16) | (buffer[6] << 8) | buffer[7];
+    uint32_t length_from_client_id = (data[4] << 24) | (data[5] << 16) | (data[6] << 8) | data[7];
 
     if (length_from_client_id < 8 || length_from_client_id > MAX_MESSAGE_SIZE) {
         // Invalid message length - try to resync by skipping this potential header
         // Look for next potential SOME/IP header (non-zero message ID)
-        size_t search_start = SOMEIP_HEADER_SIZE;
+        size_t search_start = head + SOMEIP_HEADER_SIZE;
         bool found_valid_header = false;
 
         while (search_start + SOMEIP_HEADER_SIZE <= buffer.size()) {
@@ -550,8 +1369,8 @@ bool TcpTransport::parse_message_from_buffer(std::vector<uint8_t>& buffer, Messa
                                        (buffer[search_start + 2] << 8) |
                                        buffer[search_start + 3];
             if (potential_msg_id != 0) {  // Found a non-zero message ID
-                // Discard data before this potential header
-                buffer.erase(buffer.begin(), buffer.begin() + search_start);
+                // Skip the garbage by advancing the head; no data moves
+                head = search_start;
                 found_valid_header = true;
                 break;
             }
@@ -561,6 +1380,7 @@ bool TcpTransport::parse_message_from_buffer(std::vector<uint8_t>& buffer, Messa
         if (!found_valid_header) {
             // No valid header found, clear buffer to prevent infinite loops
             buffer.clear();
+            head = 0;
         }
         return false;
     }
@@ -568,18 +1388,34 @@ bool TcpTransport::parse_message_from_buffer(std::vector<uint8_t>& buffer, Messa
     // Total message size = message_id(4) + length(4) + length_from_client_id
     size_t total_message_size = 8 + length_from_client_id;
 
-    if (buffer.size() < total_message_size) {
+    if (live < total_message_size) {
+        compact_receive_buffer(connection);
         return false;  // Need more data
     }
 
-    // Extract message data
-    std::vector<uint8_t> message_data(buffer.begin(), buffer.begin() + total_message_size);
-    buffer.erase(buffer.begin(), buffer.begin() + total_message_size);
+    // Extract message data and consume the frame by index
+    std::vector<uint8_t> message_data(data, data + total_message_size);
+    head += total_message_size;
+    if (head == buffer.size()) {
+        buffer.clear();
+        head = 0;
+    }
 
     // Parse message
     try {
-        message = std::make_shared<Message>();
+        message = MessagePool::get_default()->acquire();
         if (message->deserialize(message_data)) {
+            // Transparent decompression, gated on this side having
+            // consented (enable_compression): without consent, bytes
+            // that merely look like a compressed frame pass through
+            const PayloadBuffer& payload = message->get_payload();
+            if (config_.enable_compression &&
+                lz4::is_compressed_payload(payload.data(), payload.size())) {
+                std::vector<uint8_t> decompressed;
+                if (lz4::decompress_payload(payload.data(), payload.size(), decompressed)) {
+                    message->set_payload(std::move(decompressed));
+                }
+            }
             return true;
         }
     } catch (const std::exception& e) {
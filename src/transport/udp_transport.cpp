@@ -12,21 +12,83 @@
  ********************************************************************************/
 
 #include "transport/udp_transport.h"
+#include "transport/receive_buffer_pool.h"
 #include "common/result.h"
+#include "common/trace_ring.h"
+#include "someip/message_pool.h"
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
 #include <cstring>
+#include <algorithm>
 #include <iostream>
 
 namespace someip {
 namespace transport {
 
-UdpTransport::UdpTransport(const Endpoint& local_endpoint)
+
+namespace {
+
+// A datagram may carry several back-to-back SOME/IP messages (client
+// request batching packs them); the header length field delimits
+// each. The single-message case deserializes in place as before.
+void deserialize_datagram(std::vector<uint8_t>& buffer, const Endpoint& sender,
+                          std::vector<std::pair<MessagePtr, Endpoint>>& out) {
+    if (buffer.size() < Message::HEADER_SIZE) {
+        return;
+    }
+
+    uint32_t first_length = (static_cast<uint32_t>(buffer[4]) << 24) |
+                            (static_cast<uint32_t>(buffer[5]) << 16) |
+                            (static_cast<uint32_t>(buffer[6]) << 8) |
+                            static_cast<uint32_t>(buffer[7]);
+    if (8 + static_cast<size_t>(first_length) == buffer.size()) {
+        MessagePtr message = MessagePool::get_default()->acquire();
+        if (message->deserialize(buffer)) {
+            TraceRing::record(TraceRing::span_of(message->get_client_id(),
+                                                 message->get_session_id()),
+                              TraceSite::DESERIALIZE);
+            out.emplace_back(std::move(message), sender);
+        }
+        return;
+    }
+
+    size_t offset = 0;
+    while (buffer.size() - offset >= Message::HEADER_SIZE) {
+        const uint8_t* data = buffer.data() + offset;
+        uint32_t length = (static_cast<uint32_t>(data[4]) << 24) |
+                          (static_cast<uint32_t>(data[5]) << 16) |
+                          (static_cast<uint32_t>(data[6]) << 8) |
+                          static_cast<uint32_t>(data[7]);
+        size_t total = 8 + static_cast<size_t>(length);
+        if (length < 8 || total > buffer.size() - offset) {
+            break;  // Malformed tail; drop the remainder
+        }
+
+        std::vector<uint8_t> frame(data, data + total);
+        MessagePtr message = MessagePool::get_default()->acquire();
+        if (message->deserialize(frame)) {
+            out.emplace_back(std::move(message), sender);
+        }
+        offset += total;
+    }
+}
+
+} // namespace
+
+UdpTransport::UdpTransport(const Endpoint& local_endpoint,
+                           size_t receive_queue_capacity,
+                           OverflowPolicy overflow_policy)
     : local_endpoint_(local_endpoint),
-      running_(false) {
+      running_(false),
+      receive_queue_(receive_queue_capacity, overflow_policy) {
     if (!local_endpoint_.is_valid()) {
         throw std::invalid_argument("Invalid local endpoint");
     }
@@ -46,24 +108,310 @@ Result UdpTransport::send_message(const Message& message, const Endpoint& endpoi
         return Result::INVALID_ENDPOINT;
     }
 
-    // Serialize message
-    std::vector<uint8_t> data = message.serialize();
+    // Scatter-gather send: header into a stack buffer, payload
+    // referenced in place — the payload is never copied in the library
+    uint8_t header[Message::HEADER_SIZE];
+    message.serialize_header(header);
+    const PayloadBuffer& payload = message.get_payload();
+
+    size_t total_size = sizeof(header) + payload.size();
+    if (total_size > MAX_UDP_PAYLOAD) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    std::scoped_lock lock(socket_mutex_);
+
+    if (socket_fd_ < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    sockaddr_in dest_addr = create_sockaddr(endpoint);
+
+    struct iovec iov[2];
+    iov[0].iov_base = header;
+    iov[0].iov_len = sizeof(header);
+    iov[1].iov_base = const_cast<uint8_t*>(payload.data());
+    iov[1].iov_len = payload.size();
+
+    msghdr msg{};
+    msg.msg_name = &dest_addr;
+    msg.msg_namelen = sizeof(dest_addr);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = payload.empty() ? 1 : 2;
+
+    ssize_t sent = sendmsg(socket_fd_, &msg, 0);
+
+    if (sent < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    if (static_cast<size_t>(sent) != total_size) {
+        return Result::BUFFER_OVERFLOW;
+    }
+
+    return Result::SUCCESS;
+}
+
+bool UdpTransport::is_gso_supported() {
+#if defined(__linux__) && defined(UDP_SEGMENT)
+    // Probe once: ask the kernel to accept a segment size on a scratch
+    // socket. Fails cleanly on pre-4.18 kernels.
+    static const bool supported = [] {
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0) {
+            return false;
+        }
+        int segment_size = 1400;
+        bool ok = setsockopt(fd, IPPROTO_UDP, UDP_SEGMENT,
+                             &segment_size, sizeof(segment_size)) == 0;
+        close(fd);
+        return ok;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+Result UdpTransport::send_messages(const std::vector<std::pair<MessagePtr, Endpoint>>& messages) {
+    if (!is_running()) {
+        return Result::NOT_CONNECTED;
+    }
+
+    if (is_gso_supported()) {
+        return send_messages_gso(messages);
+    }
+
+#if defined(__linux__)
+    // Submit up to SEND_BATCH_SIZE datagrams per sendmmsg syscall,
+    // each as a header+payload iovec pair (no payload copies)
+    size_t index = 0;
+
+    while (index < messages.size()) {
+        size_t batch_size = std::min(messages.size() - index, SEND_BATCH_SIZE);
+
+        uint8_t headers[SEND_BATCH_SIZE][Message::HEADER_SIZE];
+        iovec iovs[SEND_BATCH_SIZE][2];
+        sockaddr_in dest_addrs[SEND_BATCH_SIZE];
+        mmsghdr msgs[SEND_BATCH_SIZE];
+
+        for (size_t i = 0; i < batch_size; ++i) {
+            const auto& [message, endpoint] = messages[index + i];
+            if (!message || !endpoint.is_valid()) {
+                return Result::INVALID_ENDPOINT;
+            }
+
+            message->serialize_header(headers[i]);
+            const PayloadBuffer& payload = message->get_payload();
+
+            if (Message::HEADER_SIZE + payload.size() > MAX_UDP_PAYLOAD) {
+                return Result::BUFFER_OVERFLOW;
+            }
+
+            iovs[i][0].iov_base = headers[i];
+            iovs[i][0].iov_len = Message::HEADER_SIZE;
+            iovs[i][1].iov_base = const_cast<uint8_t*>(payload.data());
+            iovs[i][1].iov_len = payload.size();
+
+            dest_addrs[i] = create_sockaddr(endpoint);
+
+            std::memset(&msgs[i], 0, sizeof(mmsghdr));
+            msgs[i].msg_hdr.msg_iov = iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = payload.empty() ? 1 : 2;
+            msgs[i].msg_hdr.msg_name = &dest_addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+        }
+
+        std::scoped_lock lock(socket_mutex_);
+
+        if (socket_fd_ < 0) {
+            return Result::NOT_CONNECTED;
+        }
+
+        size_t submitted = 0;
+        while (submitted < batch_size) {
+            int sent = sendmmsg(socket_fd_, msgs + submitted,
+                                static_cast<unsigned int>(batch_size - submitted), 0);
+            if (sent < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    continue;  // Retry
+                }
+                return Result::NETWORK_ERROR;
+            }
+            submitted += static_cast<size_t>(sent);
+        }
+
+        index += batch_size;
+    }
+
+    return Result::SUCCESS;
+#else
+    // Fallback: one syscall per message
+    for (const auto& [message, endpoint] : messages) {
+        if (!message) {
+            return Result::INVALID_ENDPOINT;
+        }
+        Result result = send_message(*message, endpoint);
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+    }
+    return Result::SUCCESS;
+#endif
+}
+
+Result UdpTransport::send_messages_gso(
+    const std::vector<std::pair<MessagePtr, Endpoint>>& messages) {
+#if defined(__linux__) && defined(UDP_SEGMENT)
+    // Coalesce runs of consecutive same-destination datagrams into one
+    // super-packet the kernel splits with UDP_SEGMENT. GSO requires all
+    // segments but the last to share one size, which TP bursts and
+    // event fan-out batches naturally satisfy.
+    std::vector<uint8_t> super_packet;
+    super_packet.reserve(GSO_MAX_BYTES);
+
+    size_t index = 0;
+    while (index < messages.size()) {
+        const auto& [first_message, endpoint] = messages[index];
+        if (!first_message || !endpoint.is_valid()) {
+            return Result::INVALID_ENDPOINT;
+        }
+
+        size_t segment_size = Message::HEADER_SIZE + first_message->get_payload().size();
+        if (segment_size > MAX_UDP_PAYLOAD) {
+            return Result::BUFFER_OVERFLOW;
+        }
+
+        // Extend the run while destination and segment size hold; a
+        // single shorter datagram may close the run as its tail
+        size_t run_end = index + 1;
+        size_t total_bytes = segment_size;
+        while (run_end < messages.size() && run_end - index < GSO_MAX_SEGMENTS) {
+            const auto& [message, run_endpoint] = messages[run_end];
+            if (!message) {
+                return Result::INVALID_ENDPOINT;
+            }
+
+            size_t size = Message::HEADER_SIZE + message->get_payload().size();
+            if (run_endpoint != endpoint || size > segment_size ||
+                total_bytes + size > GSO_MAX_BYTES) {
+                break;
+            }
+
+            total_bytes += size;
+            ++run_end;
+
+            if (size < segment_size) {
+                break;  // Shorter tail segment: run must end here
+            }
+        }
+
+        if (run_end - index == 1) {
+            // Lone datagram: the plain scatter-gather path is cheaper
+            Result result = send_message(*first_message, endpoint);
+            if (result != Result::SUCCESS) {
+                return result;
+            }
+            index = run_end;
+            continue;
+        }
+
+        super_packet.clear();
+        for (size_t i = index; i < run_end; ++i) {
+            const auto& message = messages[i].first;
+            size_t offset = super_packet.size();
+            super_packet.resize(offset + Message::HEADER_SIZE);
+            message->serialize_header(super_packet.data() + offset);
+            const PayloadBuffer& payload = message->get_payload();
+            super_packet.insert(super_packet.end(), payload.begin(), payload.end());
+        }
+
+        Result result = send_gso_packet(super_packet,
+                                        static_cast<uint16_t>(segment_size), endpoint);
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+
+        index = run_end;
+    }
+
+    return Result::SUCCESS;
+#else
+    // GSO probe never passes off Linux; keep the symbol defined
+    for (const auto& [message, endpoint] : messages) {
+        if (!message) {
+            return Result::INVALID_ENDPOINT;
+        }
+        Result result = send_message(*message, endpoint);
+        if (result != Result::SUCCESS) {
+            return result;
+        }
+    }
+    return Result::SUCCESS;
+#endif
+}
+
+Result UdpTransport::send_gso_packet(const std::vector<uint8_t>& data,
+                                     uint16_t segment_size, const Endpoint& endpoint) {
+#if defined(__linux__) && defined(UDP_SEGMENT)
+    std::scoped_lock lock(socket_mutex_);
+
+    if (socket_fd_ < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    sockaddr_in dest_addr = create_sockaddr(endpoint);
+
+    iovec iov;
+    iov.iov_base = const_cast<uint8_t*>(data.data());
+    iov.iov_len = data.size();
+
+    // The UDP_SEGMENT cmsg tells the kernel where to cut the buffer
+    char control[CMSG_SPACE(sizeof(uint16_t))] = {};
+    msghdr msg{};
+    msg.msg_name = &dest_addr;
+    msg.msg_namelen = sizeof(dest_addr);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_UDP;
+    cmsg->cmsg_type = UDP_SEGMENT;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+    std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+
+    ssize_t sent;
+    do {
+        sent = sendmsg(socket_fd_, &msg, 0);
+    } while (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR));
 
-    if (data.size() > MAX_UDP_PAYLOAD) {
+    if (sent < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    if (static_cast<size_t>(sent) != data.size()) {
         return Result::BUFFER_OVERFLOW;
     }
 
-    return send_data(data, endpoint);
+    return Result::SUCCESS;
+#else
+    (void)data;
+    (void)segment_size;
+    (void)endpoint;
+    return Result::NOT_IMPLEMENTED;
+#endif
 }
 
 MessagePtr UdpTransport::receive_message() {
-    std::scoped_lock lock(queue_mutex_);
-    if (receive_queue_.empty()) {
+    MessagePtr message;
+    if (!receive_queue_.pop(message)) {
         return nullptr;
     }
-
-    MessagePtr message = receive_queue_.front();
-    receive_queue_.pop();
+    TraceRing::record(TraceRing::span_of(message->get_client_id(),
+                                         message->get_session_id()),
+                      TraceSite::QUEUE_POP);
     return message;
 }
 
@@ -98,6 +446,84 @@ void UdpTransport::set_listener(ITransportListener* listener) {
     listener_ = listener;
 }
 
+Result UdpTransport::configure_socket_tuning(const SocketTuningConfig& config) {
+    if (is_running()) {
+        return Result::INVALID_STATE;
+    }
+    tuning_ = config;
+    return Result::SUCCESS;
+}
+
+SocketStats UdpTransport::get_socket_stats() const {
+    SocketStats stats;
+    stats.kernel_drops = kernel_drops_.load(std::memory_order_relaxed);
+    stats.buffer_growths = buffer_growths_.load(std::memory_order_relaxed);
+
+    if (socket_fd_ >= 0) {
+        int rcvbuf = 0;
+        socklen_t length = sizeof(rcvbuf);
+        if (getsockopt(socket_fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &length) == 0) {
+            stats.current_rcvbuf = static_cast<size_t>(rcvbuf);
+        }
+    }
+    return stats;
+}
+
+void UdpTransport::maybe_grow_rcvbuf(uint64_t observed_drops) {
+    uint64_t previous = kernel_drops_.exchange(observed_drops, std::memory_order_relaxed);
+    if (!tuning_.adaptive || observed_drops <= previous) {
+        return;
+    }
+
+    int rcvbuf = 0;
+    socklen_t length = sizeof(rcvbuf);
+    if (getsockopt(socket_fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &length) != 0) {
+        return;
+    }
+
+    // The kernel reports the doubled value; grow from what it says
+    size_t next = static_cast<size_t>(rcvbuf) * 2;
+    if (static_cast<size_t>(rcvbuf) >= tuning_.rcvbuf_ceiling) {
+        return;  // At the ceiling: drops stay visible in the counter
+    }
+    next = std::min(next, tuning_.rcvbuf_ceiling);
+
+    int request = static_cast<int>(next / 2);  // SO_RCVBUF doubles internally
+    if (setsockopt(socket_fd_, SOL_SOCKET, SO_RCVBUF, &request, sizeof(request)) == 0) {
+        buffer_growths_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+Result UdpTransport::set_dscp(uint8_t dscp) {
+    std::scoped_lock lock(socket_mutex_);
+    if (socket_fd_ < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    int tos = dscp << 2;  // DSCP occupies the top six bits of TOS
+    if (setsockopt(socket_fd_, IPPROTO_IP, IP_TOS, &tos, sizeof(tos)) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+    return Result::SUCCESS;
+}
+
+Result UdpTransport::enable_low_latency_mode(const LowLatencyConfig& config) {
+    if (is_running()) {
+        return Result::INVALID_STATE;
+    }
+    low_latency_ = true;
+    low_latency_config_ = config;
+    return Result::SUCCESS;
+}
+
+Result UdpTransport::attach_to_event_loop(EventLoop& loop) {
+    if (is_running()) {
+        return Result::INVALID_STATE;
+    }
+    event_loop_ = &loop;
+    return Result::SUCCESS;
+}
+
 Result UdpTransport::start() {
     if (is_running()) {
         return Result::SUCCESS;
@@ -116,6 +542,18 @@ Result UdpTransport::start() {
     }
 
     running_ = true;
+
+    if (event_loop_) {
+        // Shared-loop mode: the loop's thread drains this socket
+        if (!event_loop_->add_fd(socket_fd_, [this]() { drain_socket_event(); })) {
+            running_ = false;
+            close(socket_fd_);
+            socket_fd_ = -1;
+            return Result::NETWORK_ERROR;
+        }
+        return Result::SUCCESS;
+    }
+
     receive_thread_ = std::thread(&UdpTransport::receive_loop, this);
 
     return Result::SUCCESS;
@@ -129,6 +567,10 @@ Result UdpTransport::stop() {
 
     running_ = false;
 
+    if (event_loop_ && socket_fd_ >= 0) {
+        event_loop_->remove_fd(socket_fd_);
+    }
+
     // Close socket to wake up receive thread
     if (socket_fd_ >= 0) {
         close(socket_fd_);
@@ -147,7 +589,8 @@ bool UdpTransport::is_running() const {
     return running_;
 }
 
-Result UdpTransport::join_multicast_group(const std::string& multicast_address) {
+Result UdpTransport::join_multicast_group(const std::string& multicast_address,
+                                          const std::string& interface_address) {
     std::scoped_lock lock(socket_mutex_);
 
     if (socket_fd_ < 0) {
@@ -160,7 +603,9 @@ Result UdpTransport::join_multicast_group(const std::string& multicast_address)
 
     struct ip_mreq mreq;
     mreq.imr_multiaddr.s_addr = inet_addr(multicast_address.c_str());
-    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    mreq.imr_interface.s_addr = interface_address.empty()
+                                    ? htonl(INADDR_ANY)
+                                    : inet_addr(interface_address.c_str());
 
     if (setsockopt(socket_fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) < 0) {
         return Result::NETWORK_ERROR;
@@ -181,6 +626,28 @@ Result UdpTransport::join_multicast_group(const std::string& multicast_address)
     return Result::SUCCESS;
 }
 
+Result UdpTransport::set_multicast_interface(const std::string& interface_address) {
+    std::scoped_lock lock(socket_mutex_);
+
+    if (socket_fd_ < 0) {
+        return Result::NOT_CONNECTED;
+    }
+
+    in_addr interface_addr;
+    interface_addr.s_addr = inet_addr(interface_address.c_str());
+    if (interface_addr.s_addr == INADDR_NONE ||
+        setsockopt(socket_fd_, IPPROTO_IP, IP_MULTICAST_IF,
+                   &interface_addr, sizeof(interface_addr)) < 0) {
+        return Result::NETWORK_ERROR;
+    }
+
+    // Same-host subscribers only see the group with loopback on
+    int loop = 1;
+    setsockopt(socket_fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop));
+
+    return Result::SUCCESS;
+}
+
 Result UdpTransport::leave_multicast_group(const std::string& multicast_address) {
     std::scoped_lock lock(socket_mutex_);
 
@@ -227,6 +694,39 @@ Result UdpTransport::create_socket() {
         return Result::NETWORK_ERROR;
     }
 
+    if (tuning_.initial_rcvbuf > 0) {
+        int rcvbuf = static_cast<int>(tuning_.initial_rcvbuf);
+        setsockopt(socket_fd_, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    }
+    if (tuning_.initial_sndbuf > 0) {
+        int sndbuf = static_cast<int>(tuning_.initial_sndbuf);
+        setsockopt(socket_fd_, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    }
+
+#if defined(__linux__) && defined(SO_RXQ_OVFL)
+    {
+        // Kernel drop counter rides each datagram as a cmsg
+        int enable = 1;
+        rxq_ovfl_enabled_ =
+            setsockopt(socket_fd_, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) == 0;
+    }
+#endif
+
+#if defined(__linux__) && defined(SO_BUSY_POLL)
+    if (low_latency_ && low_latency_config_.busy_poll) {
+        // Kernel-side NIC polling for the first microseconds of a wait
+        int budget_us = low_latency_config_.busy_poll_us;
+        setsockopt(socket_fd_, SOL_SOCKET, SO_BUSY_POLL, &budget_us, sizeof(budget_us));
+    }
+#endif
+
+#if defined(__linux__) && defined(UDP_GRO)
+    // Best effort: with GRO the kernel hands us coalesced super-packets
+    // that the receive loop splits back into datagrams
+    int gro = 1;
+    gro_enabled_ = setsockopt(socket_fd_, IPPROTO_UDP, UDP_GRO, &gro, sizeof(gro)) == 0;
+#endif
+
     return Result::SUCCESS;
 }
 
@@ -257,27 +757,226 @@ Result UdpTransport::configure_multicast(const Endpoint& endpoint) {
     return Result::SUCCESS;
 }
 
+void UdpTransport::drain_socket_event() {
+    // One readiness callback drains whatever is queued; buffers come
+    // from the shared pool and go straight back
+#if defined(__linux__)
+    const auto& buffer_pool = ReceiveBufferPool::get_default();
+
+    while (running_) {
+        std::vector<uint8_t> buffer = buffer_pool->acquire();
+        sockaddr_in addr{};
+        socklen_t addr_len = sizeof(addr);
+
+        ssize_t received = recvfrom(socket_fd_, buffer.data(), buffer.size(), MSG_DONTWAIT,
+                                    reinterpret_cast<sockaddr*>(&addr), &addr_len);
+        if (received <= 0) {
+            buffer_pool->release(std::move(buffer));
+            break;  // Drained (or the socket is closing)
+        }
+
+        buffer.resize(static_cast<size_t>(received));
+        Endpoint sender = sockaddr_to_endpoint(addr);
+
+        std::vector<std::pair<MessagePtr, Endpoint>> decoded;
+        deserialize_datagram(buffer, sender, decoded);
+        buffer_pool->release(std::move(buffer));
+
+        for (const auto& entry : decoded) {
+            receive_queue_.push(entry.first);
+        }
+        if (listener_ && !decoded.empty()) {
+            listener_->on_messages_received(decoded);
+        }
+    }
+#endif
+}
+
 void UdpTransport::receive_loop() {
-    std::vector<uint8_t> buffer(RECEIVE_BUFFER_SIZE);
+#if defined(__linux__)
+    if (low_latency_) {
+        if (low_latency_config_.pinned_core >= 0) {
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            CPU_SET(low_latency_config_.pinned_core, &cpuset);
+            // Best effort: an unpinnable thread still works
+            pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        }
+        if (low_latency_config_.sched_fifo_priority > 0) {
+            sched_param param{};
+            param.sched_priority = low_latency_config_.sched_fifo_priority;
+            pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);  // Needs privilege
+        }
+    }
+
+    // Batched receive: drain up to RECEIVE_BATCH_SIZE datagrams per
+    // recvmmsg syscall and hand them downstream as one group, so both
+    // syscall overhead and queue locking are amortized across the batch.
+    // Buffers are full-size and pooled: acquired once here, resized in
+    // place each iteration (capacity retained), returned on exit
+    const auto& buffer_pool = ReceiveBufferPool::get_default();
+    std::vector<std::vector<uint8_t>> buffers;
+    buffers.reserve(RECEIVE_BATCH_SIZE);
+    for (size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+        buffers.push_back(buffer_pool->acquire());
+    }
+    mmsghdr msgs[RECEIVE_BATCH_SIZE];
+    iovec iovs[RECEIVE_BATCH_SIZE];
+    sockaddr_in addrs[RECEIVE_BATCH_SIZE];
+#if defined(UDP_GRO)
+    char controls[RECEIVE_BATCH_SIZE][CMSG_SPACE(sizeof(int)) + CMSG_SPACE(sizeof(uint32_t))];
+#endif
 
     while (running_) {
+        for (size_t i = 0; i < RECEIVE_BATCH_SIZE; ++i) {
+            buffers[i].resize(RECEIVE_BUFFER_SIZE);
+            iovs[i].iov_base = buffers[i].data();
+            iovs[i].iov_len = buffers[i].size();
+            std::memset(&msgs[i], 0, sizeof(mmsghdr));
+            msgs[i].msg_hdr.msg_iov = &iovs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+#if defined(UDP_GRO)
+            if (gro_enabled_ || rxq_ovfl_enabled_) {
+                msgs[i].msg_hdr.msg_control = controls[i];
+                msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+            }
+#endif
+        }
+
+        int received_count = recvmmsg(socket_fd_, msgs, RECEIVE_BATCH_SIZE, 0, nullptr);
+
+        if (received_count < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                if (low_latency_) {
+                    // Spin for the configured budget before yielding to
+                    // the kernel: a request arriving mid-spin is picked
+                    // up with no wakeup latency at all
+                    auto spin_deadline = std::chrono::steady_clock::now() +
+                                         std::chrono::microseconds(low_latency_config_.spin_us);
+                    bool ready = false;
+                    while (running_ && std::chrono::steady_clock::now() < spin_deadline) {
+                        pollfd probe{};
+                        probe.fd = socket_fd_;
+                        probe.events = POLLIN;
+                        if (poll(&probe, 1, 0) > 0) {
+                            ready = true;
+                            break;
+                        }
+                    }
+                    if (ready) {
+                        continue;
+                    }
+                }
+
+                // Nothing queued on the non-blocking socket; wait for
+                // readiness instead of spinning
+                pollfd pfd{};
+                pfd.fd = socket_fd_;
+                pfd.events = POLLIN;
+                poll(&pfd, 1, low_latency_ ? 1 : 100);
+                continue;
+            }
+
+            if (running_ && listener_) {
+                listener_->on_error(Result::NETWORK_ERROR);
+            }
+
+            // Small delay to prevent tight error loop
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        std::vector<std::pair<MessagePtr, Endpoint>> batch;
+        batch.reserve(static_cast<size_t>(received_count));
+
+        for (int i = 0; i < received_count; ++i) {
+            size_t packet_length = msgs[i].msg_len;
+            size_t segment_size = packet_length;
+
+#if defined(UDP_GRO)
+            // A GRO super-packet carries several datagrams back to
+            // back; the cmsg tells us where to cut. SO_RXQ_OVFL rides
+            // the same control buffer with the kernel's drop counter.
+            if (gro_enabled_ || rxq_ovfl_enabled_) {
+                for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); cmsg != nullptr;
+                     cmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, cmsg)) {
+                    if (cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO) {
+                        int gro_size = 0;
+                        std::memcpy(&gro_size, CMSG_DATA(cmsg), sizeof(gro_size));
+                        if (gro_size > 0) {
+                            segment_size = static_cast<size_t>(gro_size);
+                        }
+                    }
+#if defined(SO_RXQ_OVFL)
+                    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL) {
+                        uint32_t drops = 0;
+                        std::memcpy(&drops, CMSG_DATA(cmsg), sizeof(drops));
+                        maybe_grow_rcvbuf(drops);
+                    }
+#endif
+                }
+            }
+#endif
+
+            Endpoint sender = sockaddr_to_endpoint(addrs[i]);
+            if (segment_size >= packet_length) {
+                buffers[i].resize(packet_length);
+                deserialize_datagram(buffers[i], sender, batch);
+            } else {
+                for (size_t offset = 0; offset < packet_length; offset += segment_size) {
+                    size_t length = std::min(segment_size, packet_length - offset);
+                    std::vector<uint8_t> datagram(buffers[i].data() + offset,
+                                                  buffers[i].data() + offset + length);
+                    deserialize_datagram(datagram, sender, batch);
+                }
+            }
+        }
+
+        if (batch.empty()) {
+            continue;
+        }
+
+        // Direct dispatch bypasses the queue handoff entirely; the
+        // listener runs right here on the (possibly pinned) thread
+        if (!(low_latency_ && low_latency_config_.direct_dispatch)) {
+            // Lock-free push; a full ring applies the overflow policy
+            for (const auto& entry : batch) {
+                TraceRing::record(TraceRing::span_of(entry.first->get_client_id(),
+                                                     entry.first->get_session_id()),
+                                  TraceSite::QUEUE_PUSH);
+                receive_queue_.push(entry.first);
+            }
+        }
+
+        if (listener_) {
+            listener_->on_messages_received(batch);
+        }
+    }
+
+    for (auto& buffer : buffers) {
+        buffer_pool->release(std::move(buffer));
+    }
+#else
+    const auto& buffer_pool = ReceiveBufferPool::get_default();
+    std::vector<uint8_t> buffer = buffer_pool->acquire();
+
+    while (running_) {
+        buffer.resize(RECEIVE_BUFFER_SIZE);
         Endpoint sender;
         Result result = receive_data(buffer, sender);
 
         if (result == Result::SUCCESS) {
-            // Try to deserialize message
-            MessagePtr message = std::make_shared<Message>();
-            if (message->deserialize(buffer)) {  // Deserialize from the received buffer
-                // Add to queue
-                {
-                    std::scoped_lock lock(queue_mutex_);
-                    receive_queue_.push(message);
-                }
-                queue_cv_.notify_one();
+            std::vector<std::pair<MessagePtr, Endpoint>> decoded;
+            deserialize_datagram(buffer, sender, decoded);
+            for (const auto& entry : decoded) {
+                // Lock-free push; a full ring applies the overflow policy
+                receive_queue_.push(entry.first);
 
                 // Notify listener with sender information
                 if (listener_) {
-                    listener_->on_message_received(message, sender);
+                    listener_->on_message_received(entry.first, entry.second);
                 }
             }
         } else if (result == Result::NETWORK_ERROR) {
@@ -290,6 +989,9 @@ void UdpTransport::receive_loop() {
             std::this_thread::sleep_for(std::chrono::milliseconds(10));
         }
     }
+
+    buffer_pool->release(std::move(buffer));
+#endif
 }
 
 Result UdpTransport::send_data(const std::vector<uint8_t>& data, const Endpoint& endpoint) {
@@ -341,8 +1043,13 @@ Result UdpTransport::receive_data(std::vector<uint8_t>& data, Endpoint& sender)
 }
 
 sockaddr_in UdpTransport::create_sockaddr(const Endpoint& endpoint) const {
+    // Pre-parsed endpoints skip the per-packet string parse entirely
+    if (const sockaddr_in* cached = endpoint.cached_sockaddr()) {
+        return *cached;
+    }
+
     sockaddr_in addr;
-    memset(&addr, 0, sizeof(addr));
+    std::memset(&addr, 0, sizeof(addr));
     addr.sin_family = AF_INET;
     addr.sin_port = htons(endpoint.get_port());
     addr.sin_addr.s_addr = inet_addr(endpoint.get_address().c_str());
@@ -213,3 +213,161 @@ TEST_F(EventsTest, EventConfigCopy) {
     EXPECT_EQ(config2.is_field, config1.is_field);
     EXPECT_EQ(config2.event_name, config1.event_name);
 }
+
+TEST_F(EventsTest, EventSampleConstruction) {
+    EventSample sample(0x8001, {0x01, 0x02});
+
+    EXPECT_EQ(sample.event_id, 0x8001u);
+    EXPECT_EQ(sample.data.size(), 2u);
+
+    EventSample empty;
+    EXPECT_EQ(empty.event_id, 0u);
+    EXPECT_TRUE(empty.data.empty());
+}
+
+#include <events/event_publisher.h>
+#include <transport/udp_transport.h>
+#include <chrono>
+#include <thread>
+
+TEST_F(EventsTest, BatchedPublicationReachesSubscriber) {
+    using namespace someip;
+    using namespace someip::transport;
+
+    // Subscriber endpoint is the publisher's hardcoded demo target
+    UdpTransport subscriber(Endpoint("127.0.0.1", 30500, TransportProtocol::UDP));
+    ASSERT_EQ(subscriber.start(), Result::SUCCESS);
+
+    EventPublisher publisher(0x1234, 0x0001);
+    ASSERT_TRUE(publisher.initialize());
+
+    for (uint16_t event_id = 0x8001; event_id <= 0x8003; ++event_id) {
+        EventConfig config;
+        config.event_id = event_id;
+        config.eventgroup_id = 0x0010;
+        config.notification_type = NotificationType::ON_CHANGE;
+        ASSERT_TRUE(publisher.register_event(config));
+    }
+    ASSERT_TRUE(publisher.handle_subscription(0x0010, 0x0001));
+
+    // One tick's worth of correlated samples, plus one unregistered
+    // event that must be skipped without failing the batch
+    std::vector<EventSample> samples = {
+        {0x8001, {0x01}},
+        {0x8002, {0x02}},
+        {0x9999, {0xFF}},  // Not registered
+        {0x8003, {0x03}},
+    };
+    EXPECT_TRUE(publisher.publish_events(samples));
+
+    size_t received = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (received < 3 && std::chrono::steady_clock::now() < deadline) {
+        MessagePtr message = subscriber.receive_message();
+        if (message) {
+            EXPECT_EQ(message->get_service_id(), 0x1234);
+            EXPECT_EQ(message->get_message_type(), MessageType::NOTIFICATION);
+            ++received;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(received, 3u);
+
+    publisher.shutdown();
+    EXPECT_EQ(subscriber.stop(), Result::SUCCESS);
+}
+
+TEST_F(EventsTest, FilteredPublicationSelectsByPayloadPrefix) {
+    using namespace someip;
+    using namespace someip::transport;
+
+    UdpTransport receiver(Endpoint("127.0.0.1", 30500, TransportProtocol::UDP));
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    EventPublisher publisher(0x1234, 0x0001);
+    ASSERT_TRUE(publisher.initialize());
+
+    EventConfig config;
+    config.event_id = 0x8010;
+    config.eventgroup_id = 0x0020;
+    config.notification_type = NotificationType::ON_CHANGE_WITH_FILTER;
+    ASSERT_TRUE(publisher.register_event(config));
+
+    // Client 1 is unfiltered; clients 2 and 3 share one predicate
+    // (compiled once) matching payloads starting with 0x01
+    EventFilter prefix_filter{0x8010, {0x01}};
+    ASSERT_TRUE(publisher.handle_subscription(0x0020, 1));
+    ASSERT_TRUE(publisher.handle_subscription(0x0020, 2, {prefix_filter}));
+    ASSERT_TRUE(publisher.handle_subscription(0x0020, 3, {prefix_filter}));
+
+    auto drain = [&receiver](int settle_ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+        size_t count = 0;
+        while (receiver.receive_message()) {
+            ++count;
+        }
+        return count;
+    };
+
+    // Matching payload: all three clients receive
+    EXPECT_TRUE(publisher.publish_event(0x8010, {0x01, 0x42}));
+    EXPECT_EQ(drain(100), 3u);
+
+    // Non-matching payload: only the unfiltered client receives
+    EXPECT_TRUE(publisher.publish_event(0x8010, {0x02, 0x42}));
+    EXPECT_EQ(drain(100), 1u);
+
+    publisher.shutdown();
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+TEST_F(EventsTest, MulticastSwitchOverAboveThreshold) {
+    using namespace someip;
+    using namespace someip::transport;
+
+    // Receiver joins the multicast group the publisher switches to
+    UdpTransport receiver(Endpoint("0.0.0.0", 30501, TransportProtocol::UDP));
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(receiver.join_multicast_group("239.0.0.42", "127.0.0.1"), Result::SUCCESS);
+
+    // Unicast observer on the hardcoded subscriber endpoint
+    UdpTransport unicast_observer(Endpoint("127.0.0.1", 30500, TransportProtocol::UDP));
+    ASSERT_EQ(unicast_observer.start(), Result::SUCCESS);
+
+    EventPublisher publisher(0x1234, 0x0001);
+    ASSERT_TRUE(publisher.initialize());
+
+    EventConfig config;
+    config.event_id = 0x8020;
+    config.eventgroup_id = 0x0030;
+    config.notification_type = NotificationType::ON_CHANGE;
+    ASSERT_TRUE(publisher.register_event(config));
+    ASSERT_TRUE(publisher.set_eventgroup_multicast(0x0030, "239.0.0.42", 30501, 3, "127.0.0.1"));
+
+    auto drain = [](UdpTransport& transport, int settle_ms) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(settle_ms));
+        size_t count = 0;
+        while (transport.receive_message()) {
+            ++count;
+        }
+        return count;
+    };
+
+    // Two subscribers: below the threshold of 3, fan-out stays unicast
+    ASSERT_TRUE(publisher.handle_subscription(0x0030, 1));
+    ASSERT_TRUE(publisher.handle_subscription(0x0030, 2));
+    EXPECT_TRUE(publisher.publish_event(0x8020, {0x01}));
+    EXPECT_EQ(drain(unicast_observer, 100), 2u);
+    EXPECT_EQ(drain(receiver, 0), 0u);
+
+    // Third subscriber crosses the threshold: one multicast datagram
+    ASSERT_TRUE(publisher.handle_subscription(0x0030, 3));
+    EXPECT_TRUE(publisher.publish_event(0x8020, {0x02}));
+    EXPECT_EQ(drain(receiver, 100), 1u);
+    EXPECT_EQ(drain(unicast_observer, 0), 0u);
+
+    publisher.shutdown();
+    EXPECT_EQ(unicast_observer.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
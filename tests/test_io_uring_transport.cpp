@@ -0,0 +1,145 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "transport/io_uring_transport.h"
+#include "transport/udp_transport.h"
+
+using namespace someip;
+using namespace someip::transport;
+
+class IoUringTransportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // io_uring may be unavailable (old kernel, seccomp-filtered CI):
+        // every test checks is_supported() first and skips if absent
+        if (!IoUringUdpTransport::is_supported()) {
+            GTEST_SKIP() << "io_uring not supported on this kernel";
+        }
+    }
+
+    // Polls receive_message until a message arrives or the timeout hits
+    static MessagePtr wait_for_message(ITransport& transport, int timeout_ms = 2000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            MessagePtr message = transport.receive_message();
+            if (message) {
+                return message;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(IoUringTransportTest, StartStopLifecycle) {
+    IoUringUdpTransport transport(Endpoint("127.0.0.1", 47801, TransportProtocol::UDP));
+
+    EXPECT_FALSE(transport.is_running());
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    EXPECT_TRUE(transport.is_running());
+    EXPECT_TRUE(transport.is_connected());
+    EXPECT_EQ(transport.stop(), Result::SUCCESS);
+    EXPECT_FALSE(transport.is_running());
+}
+
+TEST_F(IoUringTransportTest, SendReceiveRoundTrip) {
+    IoUringUdpTransport receiver(Endpoint("127.0.0.1", 47802, TransportProtocol::UDP));
+    IoUringUdpTransport sender(Endpoint("127.0.0.1", 47803, TransportProtocol::UDP));
+
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload({0x11, 0x22, 0x33});
+
+    ASSERT_EQ(sender.send_message(message, Endpoint("127.0.0.1", 47802, TransportProtocol::UDP)),
+              Result::SUCCESS);
+
+    MessagePtr received = wait_for_message(receiver);
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x1234);
+    EXPECT_EQ(received->get_payload(), message.get_payload());
+
+    EXPECT_EQ(sender.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+TEST_F(IoUringTransportTest, InteroperatesWithBlockingUdpTransport) {
+    // The ring-based receiver must be wire-compatible with the
+    // plain-socket sender and vice versa
+    IoUringUdpTransport ring_side(Endpoint("127.0.0.1", 47804, TransportProtocol::UDP));
+    UdpTransport socket_side(Endpoint("127.0.0.1", 47805, TransportProtocol::UDP));
+
+    ASSERT_EQ(ring_side.start(), Result::SUCCESS);
+    ASSERT_EQ(socket_side.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x4321, 0x0002}, RequestId{0x0002, 0x0001});
+    message.set_payload({0xAA, 0xBB});
+
+    ASSERT_EQ(socket_side.send_message(message,
+                                       Endpoint("127.0.0.1", 47804, TransportProtocol::UDP)),
+              Result::SUCCESS);
+
+    MessagePtr received = wait_for_message(ring_side);
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x4321);
+
+    ASSERT_EQ(ring_side.send_message(*received,
+                                     Endpoint("127.0.0.1", 47805, TransportProtocol::UDP)),
+              Result::SUCCESS);
+
+    MessagePtr echoed = wait_for_message(socket_side);
+    ASSERT_NE(echoed, nullptr);
+    EXPECT_EQ(echoed->get_payload(), message.get_payload());
+
+    EXPECT_EQ(ring_side.stop(), Result::SUCCESS);
+    EXPECT_EQ(socket_side.stop(), Result::SUCCESS);
+}
+
+TEST_F(IoUringTransportTest, BurstExceedingReceiveSlots) {
+    IoUringUdpTransport receiver(Endpoint("127.0.0.1", 47806, TransportProtocol::UDP));
+    IoUringUdpTransport sender(Endpoint("127.0.0.1", 47807, TransportProtocol::UDP));
+
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+
+    Endpoint destination("127.0.0.1", 47806, TransportProtocol::UDP);
+
+    // More datagrams than armed receive slots to exercise re-arming
+    constexpr size_t kMessageCount = IoUringUdpTransport::RECEIVE_SLOTS * 2;
+    for (size_t i = 0; i < kMessageCount; ++i) {
+        Message message(MessageId{0x1234, 0x0003},
+                        RequestId{0x0001, static_cast<uint16_t>(i + 1)});
+        message.set_payload({static_cast<uint8_t>(i)});
+        ASSERT_EQ(sender.send_message(message, destination), Result::SUCCESS);
+    }
+
+    size_t received_count = 0;
+    while (received_count < kMessageCount) {
+        MessagePtr received = wait_for_message(receiver);
+        ASSERT_NE(received, nullptr) << "Timed out after " << received_count << " messages";
+        EXPECT_EQ(received->get_method_id(), 0x0003);
+        ++received_count;
+    }
+
+    EXPECT_EQ(sender.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
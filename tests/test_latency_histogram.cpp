@@ -0,0 +1,107 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "common/latency_histogram.h"
+
+using namespace someip;
+
+TEST(LatencyHistogramTest, EmptySnapshot) {
+    LatencyHistogram histogram;
+    auto percentiles = histogram.snapshot();
+
+    EXPECT_EQ(percentiles.count, 0u);
+    EXPECT_EQ(percentiles.p50_us, 0u);
+    EXPECT_EQ(percentiles.p999_us, 0u);
+}
+
+TEST(LatencyHistogramTest, ExactValuesBelowSixteen) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 100; ++i) {
+        histogram.record(static_cast<uint64_t>(7));
+    }
+
+    auto percentiles = histogram.snapshot();
+    EXPECT_EQ(percentiles.count, 100u);
+    EXPECT_EQ(percentiles.p50_us, 7u);
+    EXPECT_EQ(percentiles.p999_us, 7u);
+    EXPECT_EQ(percentiles.max_us, 7u);
+    EXPECT_EQ(percentiles.mean_us, 7u);
+}
+
+TEST(LatencyHistogramTest, PercentilesSeparateTail) {
+    LatencyHistogram histogram;
+
+    // 990 fast samples, 10 slow outliers: the average hides the tail,
+    // the percentiles must not
+    for (int i = 0; i < 990; ++i) {
+        histogram.record(static_cast<uint64_t>(50));
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.record(static_cast<uint64_t>(20000));
+    }
+
+    auto percentiles = histogram.snapshot();
+    EXPECT_EQ(percentiles.count, 1000u);
+    EXPECT_LT(percentiles.p50_us, 100u);
+    EXPECT_LT(percentiles.p95_us, 100u);
+    EXPECT_GE(percentiles.p999_us, 16000u);  // Tail surfaces at p99.9
+    EXPECT_GE(percentiles.max_us, 20000u);
+}
+
+TEST(LatencyHistogramTest, LogBucketErrorBounded) {
+    LatencyHistogram histogram;
+    histogram.record(static_cast<uint64_t>(1000));
+
+    auto percentiles = histogram.snapshot();
+    // Bucket lower bound within ~12.5% of the recorded value
+    EXPECT_GE(percentiles.p50_us, 875u);
+    EXPECT_LE(percentiles.p50_us, 1000u);
+}
+
+TEST(LatencyHistogramTest, ResetClears) {
+    LatencyHistogram histogram;
+    histogram.record(static_cast<uint64_t>(123));
+    histogram.reset();
+
+    auto percentiles = histogram.snapshot();
+    EXPECT_EQ(percentiles.count, 0u);
+    EXPECT_EQ(percentiles.max_us, 0u);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecording) {
+    LatencyHistogram histogram;
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 10000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&histogram] {
+            for (int i = 0; i < kPerThread; ++i) {
+                histogram.record(static_cast<uint64_t>(i % 500));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto percentiles = histogram.snapshot();
+    EXPECT_EQ(percentiles.count, static_cast<uint64_t>(kThreads) * kPerThread);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
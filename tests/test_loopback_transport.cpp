@@ -0,0 +1,135 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "transport/loopback_transport.h"
+
+using namespace someip;
+using namespace someip::transport;
+
+namespace {
+
+MessagePtr wait_for_message(ITransport& transport, int timeout_ms = 2000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+        MessagePtr message = transport.receive_message();
+        if (message) {
+            return message;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST(LoopbackTransportTest, PairedRoundTrip) {
+    LoopbackTransport a(Endpoint("127.0.0.1", 1, TransportProtocol::UDP));
+    LoopbackTransport b(Endpoint("127.0.0.1", 2, TransportProtocol::UDP));
+    LoopbackTransport::pair(a, b);
+
+    ASSERT_EQ(a.start(), Result::SUCCESS);
+    ASSERT_EQ(b.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload({0x11, 0x22});
+
+    ASSERT_EQ(a.send_message(message, b.get_local_endpoint()), Result::SUCCESS);
+
+    // Zero-latency model delivers inline: already queued at b
+    MessagePtr received = b.receive_message();
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x1234);
+    EXPECT_EQ(received->get_payload(), message.get_payload());
+
+    ASSERT_EQ(b.send_message(*received, a.get_local_endpoint()), Result::SUCCESS);
+    EXPECT_NE(a.receive_message(), nullptr);
+
+    EXPECT_EQ(a.stop(), Result::SUCCESS);
+    EXPECT_EQ(b.stop(), Result::SUCCESS);
+}
+
+TEST(LoopbackTransportTest, UnpairedSendFails) {
+    LoopbackTransport lonely(Endpoint("127.0.0.1", 3, TransportProtocol::UDP));
+    ASSERT_EQ(lonely.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    EXPECT_EQ(lonely.send_message(message, Endpoint()), Result::NOT_CONNECTED);
+    EXPECT_EQ(lonely.stop(), Result::SUCCESS);
+}
+
+TEST(LoopbackTransportTest, LatencyModelDelaysDelivery) {
+    LoopbackTransport a(Endpoint("127.0.0.1", 4, TransportProtocol::UDP));
+    LoopbackTransport b(Endpoint("127.0.0.1", 5, TransportProtocol::UDP));
+    LoopbackTransport::pair(a, b);
+
+    LoopbackTransport::LinkModel model;
+    model.latency = std::chrono::microseconds(50000);  // 50ms
+    a.set_link_model(model);
+
+    ASSERT_EQ(a.start(), Result::SUCCESS);
+    ASSERT_EQ(b.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0002}, RequestId{0x0001, 0x0001});
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_EQ(a.send_message(message, b.get_local_endpoint()), Result::SUCCESS);
+
+    EXPECT_EQ(b.receive_message(), nullptr);  // Not yet: in flight
+
+    MessagePtr received = wait_for_message(b);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_NE(received, nullptr);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(45));
+
+    EXPECT_EQ(a.stop(), Result::SUCCESS);
+    EXPECT_EQ(b.stop(), Result::SUCCESS);
+}
+
+TEST(LoopbackTransportTest, LossModelDropsStatistically) {
+    LoopbackTransport a(Endpoint("127.0.0.1", 6, TransportProtocol::UDP));
+    LoopbackTransport b(Endpoint("127.0.0.1", 7, TransportProtocol::UDP));
+    LoopbackTransport::pair(a, b);
+
+    LoopbackTransport::LinkModel model;
+    model.loss_probability = 0.5;
+    a.set_link_model(model);
+
+    ASSERT_EQ(a.start(), Result::SUCCESS);
+    ASSERT_EQ(b.start(), Result::SUCCESS);
+
+    constexpr int kSends = 400;
+    for (int i = 0; i < kSends; ++i) {
+        Message message(MessageId{0x1234, 0x0003},
+                        RequestId{0x0001, static_cast<uint16_t>(i + 1)});
+        ASSERT_EQ(a.send_message(message, b.get_local_endpoint()), Result::SUCCESS);
+    }
+
+    int received = 0;
+    while (b.receive_message()) {
+        ++received;
+    }
+
+    // Statistically around half; generous bounds avoid flakiness
+    EXPECT_GT(received, kSends / 5);
+    EXPECT_LT(received, kSends * 4 / 5);
+
+    EXPECT_EQ(a.stop(), Result::SUCCESS);
+    EXPECT_EQ(b.stop(), Result::SUCCESS);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
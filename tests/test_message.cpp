@@ -12,7 +12,10 @@
  ********************************************************************************/
 
 #include <gtest/gtest.h>
+#include <cstring>
 #include "someip/message.h"
+#include "someip/message_view.h"
+#include "someip/message_pool.h"
 #include "serialization/serializer.h"
 
 using namespace someip;
@@ -184,6 +187,149 @@ TEST_F(MessageTest, MessageTypeHelpers) {
     EXPECT_FALSE(notification_msg.is_response());
 }
 
+TEST_F(MessageTest, MessageViewZeroCopyParse) {
+    MessageId message_id{0x1234, 0x5678};
+    RequestId request_id{0xABCD, 0x0001};
+    Message original(message_id, request_id, MessageType::NOTIFICATION);
+    original.set_payload({0xDE, 0xAD, 0xBE, 0xEF});
+
+    std::vector<uint8_t> wire = original.serialize();
+
+    MessageView view;
+    ASSERT_TRUE(view.parse(wire));
+    EXPECT_TRUE(view.is_valid());
+
+    EXPECT_EQ(view.get_service_id(), 0x1234);
+    EXPECT_EQ(view.get_method_id(), 0x5678);
+    EXPECT_EQ(view.get_client_id(), 0xABCD);
+    EXPECT_EQ(view.get_session_id(), 0x0001);
+    EXPECT_EQ(view.get_message_type(), MessageType::NOTIFICATION);
+    EXPECT_EQ(view.get_length(), original.get_length());
+
+    // The payload pointer aims into the wire buffer itself — no copy
+    ASSERT_EQ(view.get_payload_size(), 4u);
+    EXPECT_EQ(view.get_payload_data(), wire.data() + Message::get_header_size());
+    EXPECT_EQ(view.get_payload_data()[0], 0xDE);
+
+    // Conversion to an owning Message copies exactly once
+    Message owned = view.to_message();
+    EXPECT_TRUE(owned.is_valid());
+    EXPECT_EQ(owned.get_payload(), original.get_payload());
+    EXPECT_EQ(owned.get_message_id().to_uint32(), message_id.to_uint32());
+}
+
+TEST_F(MessageTest, MessageViewRejectsInvalidInput) {
+    MessageView view;
+
+    // Too short for a header
+    std::vector<uint8_t> runt = {0x00, 0x01, 0x02};
+    EXPECT_FALSE(view.parse(runt));
+    EXPECT_FALSE(view.is_valid());
+
+    // Truncated payload: header claims more bytes than the buffer holds
+    Message message;
+    message.set_payload({1, 2, 3, 4, 5, 6, 7, 8});
+    std::vector<uint8_t> wire = message.serialize();
+    wire.resize(wire.size() - 3);
+    EXPECT_FALSE(view.parse(wire));
+    EXPECT_FALSE(view.is_valid());
+
+    // Wrong protocol version
+    wire = message.serialize();
+    wire[12] = 0x42;
+    EXPECT_FALSE(view.parse(wire));
+}
+
+TEST_F(MessageTest, MessagePoolRecyclesMessages) {
+    auto pool = MessagePool::create(4);
+
+    Message* first_address = nullptr;
+    {
+        MessagePtr message = pool->acquire();
+        first_address = message.get();
+        message->set_service_id(0x1111);
+        message->set_payload({1, 2, 3, 4, 5, 6, 7, 8});
+    }  // Last release returns the message to the pool
+
+    auto statistics = pool->get_statistics();
+    EXPECT_EQ(statistics.acquired, 1u);
+    EXPECT_EQ(statistics.pool_misses, 1u);
+    EXPECT_EQ(statistics.released, 1u);
+    EXPECT_EQ(statistics.pooled, 1u);
+    EXPECT_GE(statistics.payload_high_water, 8u);
+
+    // The next acquire must reuse the same object, reset to defaults
+    MessagePtr recycled = pool->acquire();
+    EXPECT_EQ(recycled.get(), first_address);
+    EXPECT_EQ(recycled->get_service_id(), 0x0000);
+    EXPECT_TRUE(recycled->get_payload().empty());
+    EXPECT_GE(recycled->get_payload_capacity(), 8u);  // Buffer was kept
+    EXPECT_TRUE(recycled->is_valid());
+
+    statistics = pool->get_statistics();
+    EXPECT_EQ(statistics.pool_hits, 1u);
+}
+
+TEST_F(MessageTest, MessagePoolCapAndPoolOutlivedMessages) {
+    MessagePtr survivor;
+    {
+        auto pool = MessagePool::create(1);
+        survivor = pool->acquire();
+        MessagePtr second = pool->acquire();
+        // Both released after the pool itself goes away below
+    }
+    // Message outliving its pool is freed normally on release
+    survivor->set_payload({42});
+    survivor.reset();
+}
+
+TEST_F(MessageTest, SerializeHeaderMatchesFullSerialization) {
+    MessageId message_id{0x00A0, 0x0B0C};
+    RequestId request_id{0x0D0E, 0x0F10};
+    Message message(message_id, request_id, MessageType::RESPONSE, ReturnCode::E_OK);
+    message.set_payload({0x10, 0x20, 0x30});
+
+    std::vector<uint8_t> wire = message.serialize();
+    ASSERT_EQ(wire.size(), Message::HEADER_SIZE + 3);
+
+    // The scatter-gather header must be byte-identical to the header
+    // portion of the single-buffer serialization
+    uint8_t header[Message::HEADER_SIZE];
+    message.serialize_header(header);
+    EXPECT_EQ(std::memcmp(header, wire.data(), Message::HEADER_SIZE), 0);
+
+    // And the payload portion is the raw payload bytes
+    EXPECT_EQ(std::memcmp(wire.data() + Message::HEADER_SIZE,
+                          message.get_payload().data(), 3), 0);
+}
+
+TEST_F(MessageTest, SmallBufferPayloadStorage) {
+    Message message;
+
+    // Small payload lives inline: data pointer sits inside the Message
+    std::vector<uint8_t> small(PayloadBuffer::INLINE_CAPACITY, 0xAB);
+    message.set_payload(small);
+    const uint8_t* payload_data = message.get_payload().data();
+    const uint8_t* object_start = reinterpret_cast<const uint8_t*>(&message);
+    EXPECT_GE(payload_data, object_start);
+    EXPECT_LT(payload_data, object_start + sizeof(Message));
+    EXPECT_EQ(message.get_payload(), small);
+
+    // Oversized payload spills to the heap but round-trips identically
+    std::vector<uint8_t> large(PayloadBuffer::INLINE_CAPACITY + 1, 0xCD);
+    message.set_payload(large);
+    EXPECT_EQ(message.get_payload(), large);
+    payload_data = message.get_payload().data();
+    EXPECT_TRUE(payload_data < object_start || payload_data >= object_start + sizeof(Message));
+
+    // Shrinking back re-inlines while serialization stays consistent
+    message.set_payload(std::vector<uint8_t>{1, 2, 3, 4});
+    std::vector<uint8_t> wire = message.serialize();
+    Message decoded;
+    ASSERT_TRUE(decoded.deserialize(wire));
+    EXPECT_EQ(decoded.get_payload(), message.get_payload());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
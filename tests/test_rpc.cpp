@@ -116,6 +116,213 @@ TEST_F(RpcTest, ClientBasicFunctionality) {
     EXPECT_FALSE(client.is_ready());
 }
 
+// Pipelining: many calls in flight at once through the slot table
+TEST_F(RpcTest, HundredsOfCallsInFlight) {
+    RpcServer server(test_service_id_);
+    ASSERT_TRUE(server.initialize());
+    server.register_method(test_method_id_,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+            out = in;
+            return RpcResult::SUCCESS;
+        });
+
+    RpcClient client(client_id_, 512);
+    ASSERT_TRUE(client.initialize());
+
+    constexpr size_t kInFlight = 300;
+    std::atomic<size_t> completed{0};
+    std::atomic<size_t> succeeded{0};
+
+    // Issue every call before any response is consumed: the table
+    // must hold all of them simultaneously
+    for (size_t i = 0; i < kInFlight; ++i) {
+        auto handle = client.call_method_async(
+            test_service_id_, test_method_id_, {static_cast<uint8_t>(i)},
+            [&](const RpcResponse& response) {
+                if (response.result == RpcResult::SUCCESS) {
+                    succeeded.fetch_add(1);
+                }
+                completed.fetch_add(1);
+            });
+        ASSERT_NE(handle, 0u) << "table refused call " << i;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (completed.load() < kInFlight && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(completed.load(), kInFlight);
+    EXPECT_EQ(succeeded.load(), kInFlight);
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// A slow offloaded method must not head-of-line block a fast inline one
+TEST_F(RpcTest, OffloadedSlowMethodDoesNotBlockFastPath) {
+    RpcServerConfig config;
+    config.worker_count = 2;
+    RpcServer server(test_service_id_, config);
+    ASSERT_TRUE(server.initialize());
+
+    server.register_method(0x0001,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>&, std::vector<uint8_t>& out) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            out = {0x51};
+            return RpcResult::SUCCESS;
+        },
+        DispatchMode::OFFLOAD);
+    server.register_method(0x0002,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>&, std::vector<uint8_t>& out) {
+            out = {0xFA};
+            return RpcResult::SUCCESS;
+        });  // INLINE_FAST default
+
+    RpcClient client(client_id_);
+    ASSERT_TRUE(client.initialize());
+
+    std::atomic<bool> slow_done{false};
+    ASSERT_NE(client.call_method_async(test_service_id_, 0x0001, {},
+                                       [&](const RpcResponse&) { slow_done = true; }),
+              0u);
+
+    // Fast call issued while the slow handler sleeps in the pool
+    auto start = std::chrono::steady_clock::now();
+    auto fast = client.call_method_sync(test_service_id_, 0x0002, {});
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    EXPECT_EQ(fast.result, RpcResult::SUCCESS);
+    EXPECT_LT(elapsed.count(), 150) << "fast path was blocked behind the slow handler";
+    EXPECT_FALSE(slow_done.load());  // Slow one is genuinely still running
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!slow_done.load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_TRUE(slow_done.load());
+
+    auto stats = server.get_statistics();
+    EXPECT_EQ(stats.requests_offloaded, 1u);
+    EXPECT_EQ(stats.requests_shed, 0u);
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// Zero-copy path: view handler borrows the payload, response buffer
+// is lent to the message
+TEST_F(RpcTest, ZeroCopyViewHandlerRoundTrip) {
+    RpcServer server(test_service_id_);
+    ASSERT_TRUE(server.initialize());
+
+    const uint8_t* seen_data = nullptr;
+    size_t seen_size = 0;
+    server.register_method(0x0003,
+        MethodViewHandler([&](const RpcRequestView& request, std::vector<uint8_t>& out) {
+            seen_data = request.data;
+            seen_size = request.size;
+            out.assign(request.data, request.data + request.size);  // Echo
+            return RpcResult::SUCCESS;
+        }));
+
+    RpcClient client(client_id_);
+    ASSERT_TRUE(client.initialize());
+
+    std::vector<uint8_t> blob(20000);
+    for (size_t i = 0; i < blob.size(); ++i) {
+        blob[i] = static_cast<uint8_t>(i * 13);
+    }
+    std::vector<uint8_t> expected = blob;
+
+    // Move overload lends the buffer to the request message
+    auto result = client.call_method_sync(test_service_id_, 0x0003, std::move(blob));
+    ASSERT_EQ(result.result, RpcResult::SUCCESS);
+    EXPECT_EQ(result.return_values, expected);
+    EXPECT_EQ(seen_size, expected.size());
+    EXPECT_NE(seen_data, nullptr);
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// Frozen flat dispatch table: lock-free lookup, immutable method set
+TEST_F(RpcTest, FrozenDispatchTable) {
+    RpcServer server(test_service_id_);
+    ASSERT_TRUE(server.initialize());
+    ASSERT_FALSE(server.freeze());  // Nothing registered yet
+
+    server.register_method(0x0005,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+            out = in;
+            return RpcResult::SUCCESS;
+        });
+
+    ASSERT_TRUE(server.freeze());
+    ASSERT_FALSE(server.freeze());  // Already frozen
+
+    // Mutation is refused after freeze
+    EXPECT_FALSE(server.register_method(0x0006,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>&, std::vector<uint8_t>&) {
+            return RpcResult::SUCCESS;
+        }));
+    EXPECT_FALSE(server.unregister_method(0x0005));
+    EXPECT_TRUE(server.is_method_registered(0x0005));
+    EXPECT_FALSE(server.is_method_registered(0x0006));
+
+    // Calls dispatch through the flat table
+    RpcClient client(client_id_);
+    ASSERT_TRUE(client.initialize());
+
+    auto ok = client.call_method_sync(test_service_id_, 0x0005, {0x11});
+    EXPECT_EQ(ok.result, RpcResult::SUCCESS);
+
+    auto missing = client.call_method_sync(test_service_id_, 0x0777, {0x11});
+    EXPECT_NE(missing.result, RpcResult::SUCCESS);  // UNKNOWN_METHOD error
+
+    client.shutdown();
+    server.shutdown();
+}
+
+// Batched getters: 30 requests packed into shared datagrams
+TEST_F(RpcTest, BatchedRequestsAllAnswered) {
+    RpcServer server(test_service_id_);
+    ASSERT_TRUE(server.initialize());
+    server.register_method(0x0007,
+        [](uint16_t, uint16_t, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+            out = in;
+            return RpcResult::SUCCESS;
+        });
+
+    RpcClient client(client_id_, 512);
+    ASSERT_TRUE(client.initialize());
+    client.enable_request_batching(1400, std::chrono::milliseconds(2));
+
+    std::atomic<size_t> completed{0};
+    constexpr size_t kGetters = 30;
+    for (size_t i = 0; i < kGetters; ++i) {
+        ASSERT_NE(client.call_method_async(test_service_id_, 0x0007,
+                                           {static_cast<uint8_t>(i)},
+                                           [&](const RpcResponse& response) {
+                                               if (response.result == RpcResult::SUCCESS) {
+                                                   completed.fetch_add(1);
+                                               }
+                                           }),
+                  0u);
+    }
+    client.flush();  // Explicit flush path
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (completed.load() < kGetters && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(completed.load(), kGetters);
+
+    client.disable_request_batching();
+    client.shutdown();
+    server.shutdown();
+}
+
 // Test timeout configuration
 TEST_F(RpcTest, RpcTimeoutConfiguration) {
     RpcTimeout timeout;
@@ -0,0 +1,90 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <rpc/rpc_awaitable.h>
+#include <rpc/rpc_client.h>
+#include <rpc/rpc_server.h>
+
+using namespace someip::rpc;
+
+class RpcAwaitableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server_ = std::make_unique<RpcServer>(0x1234);
+        ASSERT_TRUE(server_->initialize());
+
+        // Echo with a transform so chained results are observable
+        server_->register_method(0x0001,
+            [](uint16_t, uint16_t, const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+                out = in;
+                for (auto& byte : out) {
+                    byte = static_cast<uint8_t>(byte + 1);
+                }
+                return RpcResult::SUCCESS;
+            });
+
+        client_ = std::make_unique<RpcClient>(0x42);
+        ASSERT_TRUE(client_->initialize());
+    }
+
+    void TearDown() override {
+        client_->shutdown();
+        server_->shutdown();
+    }
+
+    std::unique_ptr<RpcServer> server_;
+    std::unique_ptr<RpcClient> client_;
+};
+
+TEST_F(RpcAwaitableTest, SingleAwaitedCall) {
+    auto task = [this]() -> RpcTask<RpcResponse> {
+        co_return co_await call(*client_, 0x1234, 0x0001, std::vector<uint8_t>(1, 0x10));
+    }();
+
+    RpcResponse response = task.sync_wait();
+    ASSERT_EQ(response.result, RpcResult::SUCCESS);
+    ASSERT_EQ(response.return_values.size(), 1u);
+    EXPECT_EQ(response.return_values[0], 0x11);
+}
+
+TEST_F(RpcAwaitableTest, SequentialChainThreadsResults) {
+    // A -> B with A's result -> C with B's result: the callback-pyramid
+    // case the awaitable API is for
+    auto task = [this]() -> RpcTask<std::vector<uint8_t>> {
+        auto a = co_await call(*client_, 0x1234, 0x0001, std::vector<uint8_t>(1, 0x01));
+        auto b = co_await call(*client_, 0x1234, 0x0001, a.return_values);
+        auto c = co_await call(*client_, 0x1234, 0x0001, b.return_values);
+        co_return c.return_values;
+    }();
+
+    std::vector<uint8_t> result = task.sync_wait();
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result[0], 0x04);  // +1 three times
+}
+
+TEST_F(RpcAwaitableTest, FailedSendResumesWithError) {
+    RpcClient dead_client(0x43);  // Never initialized
+
+    auto task = [&dead_client]() -> RpcTask<RpcResponse> {
+        co_return co_await call(dead_client, 0x1234, 0x0001, std::vector<uint8_t>(1, 0x01));
+    }();
+
+    RpcResponse response = task.sync_wait();
+    EXPECT_EQ(response.result, RpcResult::NETWORK_ERROR);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -118,52 +118,52 @@ TEST_F(SdTest, IPv4EndpointOptionDeserialization) {
     EXPECT_EQ(deserialized_option.get_protocol(), 0x11);
 }
 
-// TEST_F(SdTest, IPv4EndpointOptionWithSdMessage) {
-//     // Test IPv4 Endpoint Option integration with SD message
-//     SdMessage message;
-
-//     // Create offer service entry
-//     auto entry = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
-//     entry->set_service_id(0x1234);
-//     entry->set_instance_id(0x5678);
-//     entry->set_major_version(1);
-//     entry->set_ttl(30);
-
-//     // Create IPv4 endpoint option
-//     auto option = std::make_unique<IPv4EndpointOption>();
-//     option->set_ipv4_address_from_string("10.0.0.1");
-//     option->set_port(30500);
-//     option->set_protocol(0x11);  // UDP
-
-//     message.add_entry(std::move(entry));
-//     message.add_option(std::move(option));
-
-//     // Set option index in entry
-//     if (auto* service_entry = dynamic_cast<ServiceEntry*>(message.get_entries()[0].get())) {
-//         service_entry->set_index1(0);  // Reference first option
-//     }
-
-//     // Serialize and deserialize
-//     auto serialized = message.serialize();
-//     SdMessage deserialized;
-//     bool success = deserialized.deserialize(serialized);
-
-//     EXPECT_TRUE(success);
-//     EXPECT_EQ(deserialized.get_entries().size(), 1);
-//     EXPECT_EQ(deserialized.get_options().size(), 1);
-
-//     auto* deserialized_entry = dynamic_cast<ServiceEntry*>(deserialized.get_entries()[0].get());
-//     auto* deserialized_option = dynamic_cast<IPv4EndpointOption*>(deserialized.get_options()[0].get());
-
-//     ASSERT_TRUE(deserialized_entry != nullptr);
-//     ASSERT_TRUE(deserialized_option != nullptr);
-
-//     EXPECT_EQ(deserialized_entry->get_service_id(), 0x1234);
-//     EXPECT_EQ(deserialized_entry->get_index1(), 0);
-//     EXPECT_EQ(deserialized_option->get_ipv4_address_string(), "10.0.0.1");
-//     EXPECT_EQ(deserialized_option->get_port(), 30500);
-//     EXPECT_EQ(deserialized_option->get_protocol(), 0x11);
-// }
+TEST_F(SdTest, IPv4EndpointOptionWithSdMessage) {
+    // Test IPv4 Endpoint Option integration with SD message
+    SdMessage message;
+
+    // Create offer service entry
+    auto entry = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
+    entry->set_service_id(0x1234);
+    entry->set_instance_id(0x5678);
+    entry->set_major_version(1);
+    entry->set_ttl(30);
+
+    // Create IPv4 endpoint option
+    auto option = std::make_unique<IPv4EndpointOption>();
+    option->set_ipv4_address_from_string("10.0.0.1");
+    option->set_port(30500);
+    option->set_protocol(0x11);  // UDP
+
+    message.add_entry(std::move(entry));
+    message.add_option(std::move(option));
+
+    // Set option index in entry
+    if (auto* service_entry = dynamic_cast<ServiceEntry*>(message.get_entries()[0].get())) {
+        service_entry->set_index1(0);  // Reference first option
+    }
+
+    // Serialize and deserialize
+    auto serialized = message.serialize();
+    SdMessage deserialized;
+    bool success = deserialized.deserialize(serialized);
+
+    EXPECT_TRUE(success);
+    EXPECT_EQ(deserialized.get_entries().size(), 1);
+    EXPECT_EQ(deserialized.get_options().size(), 1);
+
+    auto* deserialized_entry = dynamic_cast<ServiceEntry*>(deserialized.get_entries()[0].get());
+    auto* deserialized_option = dynamic_cast<IPv4EndpointOption*>(deserialized.get_options()[0].get());
+
+    ASSERT_TRUE(deserialized_entry != nullptr);
+    ASSERT_TRUE(deserialized_option != nullptr);
+
+    EXPECT_EQ(deserialized_entry->get_service_id(), 0x1234);
+    EXPECT_EQ(deserialized_entry->get_index1(), 0);
+    EXPECT_EQ(deserialized_option->get_ipv4_address_string(), "10.0.0.1");
+    EXPECT_EQ(deserialized_option->get_port(), 30500);
+    EXPECT_EQ(deserialized_option->get_protocol(), 0x11);
+}
 
 TEST_F(SdTest, Config) {
     SdConfig config;
@@ -616,3 +616,120 @@ TEST_F(SdTest, PortConversion) {
             << "Round-trip failed for port: " << port;
     }
 }
+
+#include <sd/service_registry.h>
+
+TEST(ServiceRegistryTest, ExactAndWildcardLookup) {
+    using namespace someip::sd;
+    ServiceRegistry<int> registry;
+
+    registry.insert(0x1234, 0x0001, 10);
+    registry.insert(0x1234, 0x0002, 20);
+    registry.insert(0x5678, 0x0001, 30);
+
+    ASSERT_NE(registry.find(0x1234, 0x0002), nullptr);
+    EXPECT_EQ(*registry.find(0x1234, 0x0002), 20);
+    EXPECT_EQ(registry.find(0x9999, 0x0001), nullptr);
+
+    // Wildcard instance resolves through the per-service bucket
+    ASSERT_NE(registry.find(0x1234, ServiceRegistry<int>::ANY_INSTANCE), nullptr);
+    EXPECT_EQ(registry.find_all(0x1234).size(), 2u);
+    EXPECT_EQ(registry.find_all(0x5678).size(), 1u);
+    EXPECT_TRUE(registry.find_all(0x9999).empty());
+}
+
+TEST(ServiceRegistryTest, InsertReplaceEraseAndBuckets) {
+    using namespace someip::sd;
+    ServiceRegistry<int> registry;
+
+    registry.insert(0x1234, 0x0001, 1);
+    registry.insert(0x1234, 0x0001, 2);  // Replace, no duplicate bucket entry
+    EXPECT_EQ(registry.size(), 1u);
+    EXPECT_EQ(*registry.find(0x1234, 0x0001), 2);
+    EXPECT_EQ(registry.find_all(0x1234).size(), 1u);
+
+    EXPECT_TRUE(registry.erase(0x1234, 0x0001));
+    EXPECT_FALSE(registry.erase(0x1234, 0x0001));
+    EXPECT_TRUE(registry.empty());
+    EXPECT_EQ(registry.find(0x1234, ServiceRegistry<int>::ANY_INSTANCE), nullptr);
+}
+
+TEST(ServiceRegistryTest, EraseIfMaintainsBuckets) {
+    using namespace someip::sd;
+    ServiceRegistry<int> registry;
+    for (uint16_t i = 1; i <= 8; ++i) {
+        registry.insert(0x1234, i, i);
+    }
+
+    EXPECT_EQ(registry.erase_if([](int value) { return value % 2 == 0; }), 4u);
+    EXPECT_EQ(registry.size(), 4u);
+    EXPECT_EQ(registry.find_all(0x1234).size(), 4u);
+}
+
+TEST(SdMessageBuilderTest, ByteIdenticalToSdMessage) {
+    using namespace someip::sd;
+
+    // Reference: assembled via SdMessage with unique_ptr parts
+    SdMessage reference;
+    auto entry = std::make_unique<ServiceEntry>(EntryType::OFFER_SERVICE);
+    entry->set_service_id(0x1234);
+    entry->set_instance_id(0x0001);
+    entry->set_major_version(1);
+    entry->set_ttl(30);
+    entry->set_index1(0);
+    reference.add_entry(std::move(entry));
+    auto option = std::make_unique<IPv4EndpointOption>();
+    option->set_ipv4_address_from_string("10.0.0.1");
+    option->set_port(30500);
+    option->set_protocol(0x11);
+    reference.add_option(std::move(option));
+
+    SdMessageBuilder builder;
+    ServiceEntry& built_entry = builder.add_service_entry(EntryType::OFFER_SERVICE);
+    built_entry.set_service_id(0x1234);
+    built_entry.set_instance_id(0x0001);
+    built_entry.set_major_version(1);
+    built_entry.set_ttl(30);
+    built_entry.set_index1(0);
+    IPv4EndpointOption& built_option = builder.add_ipv4_endpoint_option();
+    built_option.set_ipv4_address_from_string("10.0.0.1");
+    built_option.set_port(30500);
+    built_option.set_protocol(0x11);
+
+    EXPECT_EQ(builder.build(), reference.serialize());
+}
+
+TEST(SdMessageBuilderTest, ResetRetainsCapacityAndClearsState) {
+    using namespace someip::sd;
+    SdMessageBuilder builder;
+
+    for (int round = 0; round < 3; ++round) {
+        builder.reset();
+        EXPECT_EQ(builder.entry_count(), 0u);
+        for (uint16_t i = 0; i < 10; ++i) {
+            auto& entry = builder.add_service_entry(EntryType::OFFER_SERVICE);
+            entry.set_service_id(i);
+            entry.set_ttl(30);
+        }
+        EXPECT_EQ(builder.entry_count(), 10u);
+
+        const auto& bytes = builder.build();
+        SdMessage parsed;
+        ASSERT_TRUE(parsed.deserialize(bytes));
+        EXPECT_EQ(parsed.get_entries().size(), 10u);
+    }
+}
+
+TEST(SdMessageBuilderTest, MulticastOptionLengthField) {
+    using namespace someip::sd;
+    // Regression: the length must land in the option's length field,
+    // not over its type byte
+    IPv4MulticastOption option;
+    option.set_ipv4_address(0x7F000001);
+    option.set_port(30500);
+
+    auto bytes = option.serialize();
+    ASSERT_GE(bytes.size(), 4u);
+    EXPECT_EQ((bytes[0] << 8) | bytes[1], 7);  // Length field
+    EXPECT_EQ(bytes[2], static_cast<uint8_t>(OptionType::IPV4_MULTICAST));
+}
@@ -15,9 +15,50 @@
 #include <cmath>
 #include <limits>
 #include "serialization/serializer.h"
+#include "serialization/streaming_deserializer.h"
+#include "serialization/struct_serializer.h"
 
 using namespace someip::serialization;
 
+// Test types for reflective struct serialization
+struct FixedHeader {
+    uint16_t service_id;
+    uint16_t method_id;
+    uint32_t length;
+    bool is_request;
+};
+
+struct SensorFrame {
+    FixedHeader header;
+    std::string sensor_name;
+    std::vector<float> samples;
+};
+
+namespace someip {
+namespace serialization {
+
+template<>
+struct StructDescriptor<FixedHeader> {
+    static constexpr auto fields() {
+        return std::make_tuple(&FixedHeader::service_id,
+                               &FixedHeader::method_id,
+                               &FixedHeader::length,
+                               &FixedHeader::is_request);
+    }
+};
+
+template<>
+struct StructDescriptor<SensorFrame> {
+    static constexpr auto fields() {
+        return std::make_tuple(&SensorFrame::header,
+                               &SensorFrame::sensor_name,
+                               &SensorFrame::samples);
+    }
+};
+
+} // namespace serialization
+} // namespace someip
+
 // Helper macro for deserialization result testing
 #define EXPECT_DESERIALIZE_SUCCESS(result_expr, expected_value) \
     do { \
@@ -893,6 +934,368 @@ TEST_F(SerializationTest, DeserializationErrorHandling) {
     EXPECT_EQ(false_error.get_error(), someip::Result::MALFORMED_MESSAGE);
 }
 
+TEST_F(SerializationTest, ExternalBufferReuse) {
+    std::vector<uint8_t> shared_buffer;
+    shared_buffer.reserve(256);
+
+    // Serialize two messages into the same caller-provided buffer
+    for (uint32_t value : {0x11111111u, 0x22222222u}) {
+        shared_buffer.clear();
+        Serializer serializer(shared_buffer);
+        serializer.serialize_uint32(value);
+        serializer.serialize_string("reuse");
+
+        EXPECT_EQ(serializer.get_buffer().data(), shared_buffer.data());
+
+        Deserializer deserializer(shared_buffer);
+        EXPECT_DESERIALIZE_SUCCESS(deserializer.deserialize_uint32(), value);
+        EXPECT_DESERIALIZE_SUCCESS(deserializer.deserialize_string(), "reuse");
+    }
+
+    // reset() clears the external buffer, like the internal-buffer mode
+    Serializer serializer(shared_buffer);
+    serializer.reset();
+    EXPECT_EQ(shared_buffer.size(), 0u);
+}
+
+TEST_F(SerializationTest, SerializedSizeCounterMatchesSerializer) {
+    std::vector<uint32_t> values = {1, 2, 3, 4, 5};
+    std::string text = "hello";  // Length not a multiple of 4, exercises padding
+
+    SerializedSizeCounter counter;
+    counter.serialize_uint16(0x1234);
+    counter.serialize_array(values);
+    counter.serialize_string(text);
+    counter.serialize_double(3.14);
+
+    Serializer serializer;
+    serializer.reserve(counter.get_size());
+    serializer.serialize_uint16(0x1234);
+    serializer.serialize_array(values);
+    serializer.serialize_string(text);
+    serializer.serialize_double(3.14);
+
+    EXPECT_EQ(counter.get_size(), serializer.get_size());
+
+    // Counter reset starts a fresh computation
+    counter.reset();
+    EXPECT_EQ(counter.get_size(), 0u);
+}
+
+TEST_F(SerializationTest, BulkPrimitiveArrayRoundTrip) {
+    // Large enough to exercise the bulk memcpy + byteswap path
+    std::vector<uint32_t> u32_values(1000);
+    for (size_t i = 0; i < u32_values.size(); ++i) {
+        u32_values[i] = static_cast<uint32_t>(i * 0x01010101u);
+    }
+    std::vector<float> float_values = {0.0f, -1.5f, 3.14159f, 1e30f, -1e-30f};
+    std::vector<int16_t> i16_values = {-32768, -1, 0, 1, 32767};
+
+    Serializer serializer;
+    serializer.serialize_array(u32_values);
+    serializer.serialize_array(float_values);
+    serializer.serialize_array(i16_values);
+
+    Deserializer deserializer(serializer.get_buffer());
+
+    auto u32_len = deserializer.deserialize_uint32();
+    ASSERT_TRUE(u32_len.is_success());
+    auto u32_result = deserializer.deserialize_array<uint32_t>(u32_len.get_value());
+    ASSERT_TRUE(u32_result.is_success());
+    EXPECT_EQ(u32_result.get_value(), u32_values);
+
+    auto float_len = deserializer.deserialize_uint32();
+    ASSERT_TRUE(float_len.is_success());
+    auto float_result = deserializer.deserialize_array<float>(float_len.get_value());
+    ASSERT_TRUE(float_result.is_success());
+    EXPECT_EQ(float_result.get_value(), float_values);
+
+    auto i16_len = deserializer.deserialize_uint32();
+    ASSERT_TRUE(i16_len.is_success());
+    auto i16_result = deserializer.deserialize_array<int16_t>(i16_len.get_value());
+    ASSERT_TRUE(i16_result.is_success());
+    EXPECT_EQ(i16_result.get_value(), i16_values);
+}
+
+TEST_F(SerializationTest, BulkPrimitiveArrayWireFormat) {
+    // The bulk path must produce the same big-endian layout as the
+    // per-element path: length prefix followed by big-endian elements
+    std::vector<uint32_t> values = {0x12345678u};
+
+    Serializer serializer;
+    serializer.serialize_array(values);
+
+    const auto& buffer = serializer.get_buffer();
+    ASSERT_EQ(buffer.size(), 8u);
+    EXPECT_EQ(buffer[0], 0x00);  // Length = 1, big-endian
+    EXPECT_EQ(buffer[1], 0x00);
+    EXPECT_EQ(buffer[2], 0x00);
+    EXPECT_EQ(buffer[3], 0x01);
+    EXPECT_EQ(buffer[4], 0x12);  // Element, big-endian
+    EXPECT_EQ(buffer[5], 0x34);
+    EXPECT_EQ(buffer[6], 0x56);
+    EXPECT_EQ(buffer[7], 0x78);
+}
+
+TEST_F(SerializationTest, BulkPrimitiveArrayInsufficientData) {
+    // One bounds check covers the whole array: asking for more elements
+    // than the remaining bytes can hold fails without partial reads
+    std::vector<uint8_t> data = {0x00, 0x01, 0x02, 0x03};
+    Deserializer deserializer(data);
+
+    auto result = deserializer.deserialize_array<uint32_t>(2);
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(result.get_error(), someip::Result::MALFORMED_MESSAGE);
+    EXPECT_EQ(deserializer.get_position(), 0u);
+}
+
+TEST_F(SerializationTest, StructSerializationFixedSize) {
+    // All fields fixed-size: wire size is a compile-time constant
+    static_assert(has_fixed_wire_size_v<FixedHeader>);
+    static_assert(fixed_wire_size_v<FixedHeader> == 2 + 2 + 4 + 1);
+
+    FixedHeader header{0x1234, 0x5678, 42, true};
+
+    Serializer serializer;
+    serialize_struct(serializer, header);
+    EXPECT_EQ(serializer.get_size(), fixed_wire_size_v<FixedHeader>);
+
+    Deserializer deserializer(serializer.get_buffer());
+    auto result = deserialize_struct<FixedHeader>(deserializer);
+    ASSERT_TRUE(result.is_success());
+    EXPECT_EQ(result.get_value().service_id, header.service_id);
+    EXPECT_EQ(result.get_value().method_id, header.method_id);
+    EXPECT_EQ(result.get_value().length, header.length);
+    EXPECT_EQ(result.get_value().is_request, header.is_request);
+}
+
+TEST_F(SerializationTest, StructSerializationNestedAndVariable) {
+    // String and vector fields make the size run-time dependent
+    static_assert(!has_fixed_wire_size_v<SensorFrame>);
+
+    SensorFrame frame{{0x0001, 0x0002, 3, false}, "lidar_front", {1.0f, -2.5f, 3.75f}};
+
+    Serializer serializer;
+    serialize_struct(serializer, frame);
+
+    Deserializer deserializer(serializer.get_buffer());
+    auto result = deserialize_struct<SensorFrame>(deserializer);
+    ASSERT_TRUE(result.is_success());
+    const auto& decoded = result.get_value();
+    EXPECT_EQ(decoded.header.service_id, frame.header.service_id);
+    EXPECT_EQ(decoded.header.is_request, frame.header.is_request);
+    EXPECT_EQ(decoded.sensor_name, frame.sensor_name);
+    EXPECT_EQ(decoded.samples, frame.samples);
+}
+
+TEST_F(SerializationTest, StructDeserializationTruncatedInput) {
+    // Fixed-size structs are rejected by one up-front bounds check
+    std::vector<uint8_t> truncated = {0x12, 0x34, 0x56};
+    Deserializer deserializer(truncated);
+
+    auto result = deserialize_struct<FixedHeader>(deserializer);
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(result.get_error(), someip::Result::MALFORMED_MESSAGE);
+    EXPECT_EQ(deserializer.get_position(), 0u);
+}
+
+TEST_F(SerializationTest, DeserializerNonOwningView) {
+    Serializer serializer;
+    serializer.serialize_uint32(0xCAFEBABE);
+    serializer.serialize_string("view");
+    serializer.serialize_uint16(0xBEEF);
+
+    // Parse in place over the caller's buffer — no copy is taken
+    const auto& wire = serializer.get_buffer();
+    Deserializer deserializer(wire.data(), wire.size());
+
+    EXPECT_EQ(deserializer.get_remaining(), wire.size());
+    EXPECT_DESERIALIZE_SUCCESS(deserializer.deserialize_uint32(), 0xCAFEBABEu);
+    EXPECT_DESERIALIZE_SUCCESS(deserializer.deserialize_string(), "view");
+    EXPECT_DESERIALIZE_SUCCESS(deserializer.deserialize_uint16(), 0xBEEF);
+    EXPECT_EQ(deserializer.get_remaining(), 0u);
+
+    // Bounds checking works the same as in owning mode
+    auto error_result = deserializer.deserialize_uint8();
+    EXPECT_TRUE(error_result.is_error());
+    EXPECT_EQ(error_result.get_error(), someip::Result::MALFORMED_MESSAGE);
+}
+
+TEST_F(SerializationTest, StreamingDeserializerSuspendsAndResumes) {
+    Serializer serializer;
+    serializer.serialize_uint32(0xDEADBEEF);
+    serializer.serialize_string("stream");
+    serializer.serialize_uint16(0x0102);
+    const auto& wire = serializer.get_buffer();
+
+    StreamingDeserializer streaming;
+
+    // Feed one byte at a time; every field must suspend until complete,
+    // then decode exactly once
+    size_t fed = 0;
+    auto feed_one = [&]() {
+        ASSERT_LT(fed, wire.size());
+        streaming.feed(&wire[fed], 1);
+        ++fed;
+    };
+
+    // uint32 needs 4 bytes
+    for (int i = 0; i < 3; ++i) {
+        feed_one();
+        auto partial = streaming.deserialize_uint32();
+        EXPECT_TRUE(partial.is_error());
+        EXPECT_EQ(partial.get_error(), someip::Result::INSUFFICIENT_DATA);
+    }
+    feed_one();
+    EXPECT_DESERIALIZE_SUCCESS(streaming.deserialize_uint32(), 0xDEADBEEFu);
+
+    // String: length prefix alone is not enough, content and padding
+    // must arrive before anything is consumed
+    for (int i = 0; i < 4; ++i) {
+        feed_one();
+    }
+    auto header_only = streaming.deserialize_string();
+    EXPECT_TRUE(header_only.is_error());
+    EXPECT_EQ(header_only.get_error(), someip::Result::INSUFFICIENT_DATA);
+
+    while (fed < wire.size() - 2) {
+        feed_one();
+    }
+    EXPECT_DESERIALIZE_SUCCESS(streaming.deserialize_string(), "stream");
+
+    // Trailing uint16 arrives in the last chunk
+    auto early = streaming.deserialize_uint16();
+    EXPECT_TRUE(early.is_error());
+    feed_one();
+    feed_one();
+    EXPECT_DESERIALIZE_SUCCESS(streaming.deserialize_uint16(), 0x0102);
+    EXPECT_EQ(streaming.get_buffered(), 0u);
+    EXPECT_EQ(streaming.get_consumed(), wire.size());
+}
+
+TEST_F(SerializationTest, StreamingDeserializerArrayAndSkip) {
+    std::vector<uint32_t> values = {10, 20, 30};
+
+    Serializer serializer;
+    serializer.serialize_uint8(0xAA);  // Uninteresting leading byte
+    serializer.serialize_array(values);
+    const auto& wire = serializer.get_buffer();
+
+    StreamingDeserializer streaming;
+    streaming.feed(wire.data(), 6);  // Header byte + length + partial first element
+
+    EXPECT_EQ(streaming.skip(1), someip::Result::SUCCESS);
+    auto length_result = streaming.deserialize_uint32();
+    ASSERT_TRUE(length_result.is_success());
+
+    auto partial = streaming.deserialize_array<uint32_t>(length_result.get_value());
+    EXPECT_TRUE(partial.is_error());
+    EXPECT_EQ(partial.get_error(), someip::Result::INSUFFICIENT_DATA);
+
+    streaming.feed(wire.data() + 6, wire.size() - 6);
+    auto complete = streaming.deserialize_array<uint32_t>(length_result.get_value());
+    ASSERT_TRUE(complete.is_success());
+    EXPECT_EQ(complete.get_value(), values);
+}
+
+TEST_F(SerializationTest, ArenaBackedDeserialization) {
+    std::vector<uint32_t> values = {100, 200, 300, 400};
+
+    Serializer serializer;
+    serializer.serialize_string("arena-backed");
+    serializer.serialize_array(values);
+    const auto& wire = serializer.get_buffer();
+
+    Arena arena;
+
+    // Decode the same message twice; the second pass must reuse the
+    // arena's blocks instead of reserving more memory
+    for (int pass = 0; pass < 2; ++pass) {
+        arena.reset();
+        EXPECT_EQ(arena.get_bytes_used(), 0u);
+
+        Deserializer deserializer(wire.data(), wire.size());
+
+        auto string_result = deserializer.deserialize_string(arena);
+        ASSERT_TRUE(string_result.is_success());
+        EXPECT_EQ(std::string(string_result.get_value().c_str()), "arena-backed");
+
+        auto length_result = deserializer.deserialize_uint32();
+        ASSERT_TRUE(length_result.is_success());
+        auto array_result =
+            deserializer.deserialize_array<uint32_t>(length_result.get_value(), arena);
+        ASSERT_TRUE(array_result.is_success());
+        ASSERT_EQ(array_result.get_value().size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(array_result.get_value()[i], values[i]);
+        }
+
+        EXPECT_GT(arena.get_bytes_used(), 0u);
+    }
+
+    // Both passes fit comfortably in the first block
+    EXPECT_EQ(arena.get_bytes_reserved(), Arena::kDefaultBlockSize);
+}
+
+TEST_F(SerializationTest, ArenaBoundsChecking) {
+    // Arena-backed array deserialization keeps the single bounds check
+    std::vector<uint8_t> data = {0x00, 0x01};
+    Deserializer deserializer(data.data(), data.size());
+
+    Arena arena;
+    auto result = deserializer.deserialize_array<uint32_t>(5, arena);
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(result.get_error(), someip::Result::MALFORMED_MESSAGE);
+}
+
+
+TEST(StringInterningTest, RepeatedStringsShareStorage) {
+    using namespace someip::serialization;
+
+    // Encode the same signal name three times plus one distinct name
+    Serializer serializer;
+    serializer.serialize_string("vehicle.speed");
+    serializer.serialize_string("vehicle.speed");
+    serializer.serialize_string("vehicle.rpm");
+    serializer.serialize_string("vehicle.speed");
+
+    StringInternTable table;
+    Deserializer deserializer(serializer.get_buffer());
+    deserializer.set_intern_table(&table);
+
+    auto a = deserializer.deserialize_string_interned();
+    auto b = deserializer.deserialize_string_interned();
+    auto c = deserializer.deserialize_string_interned();
+    auto d = deserializer.deserialize_string_interned();
+    ASSERT_FALSE(a.is_error());
+    ASSERT_FALSE(b.is_error());
+    ASSERT_FALSE(c.is_error());
+    ASSERT_FALSE(d.is_error());
+
+    EXPECT_EQ(*a.get_value(), "vehicle.speed");
+    EXPECT_EQ(*c.get_value(), "vehicle.rpm");
+
+    // Identical strings share one stored copy
+    EXPECT_EQ(a.get_value(), b.get_value());
+    EXPECT_EQ(a.get_value(), d.get_value());
+    EXPECT_NE(a.get_value(), c.get_value());
+
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_EQ(table.miss_count(), 2u);
+    EXPECT_EQ(table.hit_count(), 2u);
+}
+
+TEST(StringInterningTest, RequiresTable) {
+    using namespace someip::serialization;
+
+    Serializer serializer;
+    serializer.serialize_string("standalone");
+
+    Deserializer deserializer(serializer.get_buffer());
+    auto result = deserializer.deserialize_string_interned();
+    EXPECT_TRUE(result.is_error());  // Interned mode needs a table
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,123 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "transport/sharded_udp_transport.h"
+#include "transport/udp_transport.h"
+
+using namespace someip;
+using namespace someip::transport;
+
+class ShardedUdpTransportTest : public ::testing::Test {
+protected:
+    // Polls receive_message until a message arrives or the timeout hits
+    static MessagePtr wait_for_message(ITransport& transport, int timeout_ms = 2000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            MessagePtr message = transport.receive_message();
+            if (message) {
+                return message;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(ShardedUdpTransportTest, DefaultShardCountFollowsCores) {
+    ShardedUdpTransport transport(Endpoint("127.0.0.1", 47901, TransportProtocol::UDP));
+    EXPECT_GE(transport.get_shard_count(), 1u);
+    EXPECT_LE(transport.get_shard_count(), ShardedUdpTransport::MAX_SHARDS);
+}
+
+TEST_F(ShardedUdpTransportTest, StartStopLifecycle) {
+    ShardedUdpTransport transport(Endpoint("127.0.0.1", 47902, TransportProtocol::UDP), 4);
+
+    ASSERT_EQ(transport.get_shard_count(), 4u);
+    EXPECT_FALSE(transport.is_running());
+    ASSERT_EQ(transport.start(), Result::SUCCESS);
+    EXPECT_TRUE(transport.is_running());
+    EXPECT_EQ(transport.stop(), Result::SUCCESS);
+    EXPECT_FALSE(transport.is_running());
+}
+
+TEST_F(ShardedUdpTransportTest, ReceivesFromManySenders) {
+    // Several sender sockets give the kernel distinct flows to hash
+    // across the shards; all messages must surface through the one
+    // logical receive_message() interface
+    ShardedUdpTransport receiver(Endpoint("127.0.0.1", 47903, TransportProtocol::UDP), 4);
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+
+    Endpoint destination("127.0.0.1", 47903, TransportProtocol::UDP);
+
+    constexpr size_t kSenderCount = 4;
+    constexpr size_t kPerSender = 25;
+    std::vector<std::unique_ptr<UdpTransport>> senders;
+    for (size_t s = 0; s < kSenderCount; ++s) {
+        senders.push_back(std::make_unique<UdpTransport>(
+            Endpoint("127.0.0.1", static_cast<uint16_t>(47910 + s), TransportProtocol::UDP)));
+        ASSERT_EQ(senders.back()->start(), Result::SUCCESS);
+    }
+
+    for (size_t i = 0; i < kPerSender; ++i) {
+        for (size_t s = 0; s < kSenderCount; ++s) {
+            Message message(MessageId{0x1234, 0x0001},
+                            RequestId{static_cast<uint16_t>(s + 1),
+                                      static_cast<uint16_t>(i + 1)});
+            message.set_payload({static_cast<uint8_t>(s), static_cast<uint8_t>(i)});
+            ASSERT_EQ(senders[s]->send_message(message, destination), Result::SUCCESS);
+        }
+    }
+
+    size_t received_count = 0;
+    while (received_count < kSenderCount * kPerSender) {
+        MessagePtr received = wait_for_message(receiver);
+        ASSERT_NE(received, nullptr) << "Timed out after " << received_count << " messages";
+        EXPECT_EQ(received->get_service_id(), 0x1234);
+        ++received_count;
+    }
+
+    for (auto& sender : senders) {
+        EXPECT_EQ(sender->stop(), Result::SUCCESS);
+    }
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+TEST_F(ShardedUdpTransportTest, SendsThroughLogicalTransport) {
+    ShardedUdpTransport sharded(Endpoint("127.0.0.1", 47904, TransportProtocol::UDP), 2);
+    UdpTransport plain(Endpoint("127.0.0.1", 47905, TransportProtocol::UDP));
+
+    ASSERT_EQ(sharded.start(), Result::SUCCESS);
+    ASSERT_EQ(plain.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x4321, 0x0002}, RequestId{0x0002, 0x0001});
+    message.set_payload({0xDE, 0xAD});
+
+    ASSERT_EQ(sharded.send_message(message, Endpoint("127.0.0.1", 47905, TransportProtocol::UDP)),
+              Result::SUCCESS);
+
+    MessagePtr received = wait_for_message(plain);
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x4321);
+    EXPECT_EQ(received->get_payload(), message.get_payload());
+
+    EXPECT_EQ(sharded.stop(), Result::SUCCESS);
+    EXPECT_EQ(plain.stop(), Result::SUCCESS);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
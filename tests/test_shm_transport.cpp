@@ -0,0 +1,142 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include "transport/shm_transport.h"
+
+using namespace someip;
+using namespace someip::transport;
+
+class ShmTransportTest : public ::testing::Test {
+protected:
+    // Polls receive_message until a message arrives or the timeout hits
+    static MessagePtr wait_for_message(ITransport& transport, int timeout_ms = 2000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            MessagePtr message = transport.receive_message();
+            if (message) {
+                return message;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(ShmTransportTest, SameHostDetection) {
+    Endpoint local("192.168.1.10", 30000, TransportProtocol::UDP);
+
+    EXPECT_TRUE(ShmTransport::is_same_host(local, Endpoint("127.0.0.1", 1, TransportProtocol::UDP)));
+    EXPECT_TRUE(ShmTransport::is_same_host(local, Endpoint("192.168.1.10", 1, TransportProtocol::UDP)));
+    EXPECT_FALSE(ShmTransport::is_same_host(local, Endpoint("192.168.1.11", 1, TransportProtocol::UDP)));
+}
+
+TEST_F(ShmTransportTest, SendReceiveRoundTrip) {
+    ShmTransport receiver(Endpoint("127.0.0.1", 48001, TransportProtocol::UDP));
+    ShmTransport sender(Endpoint("127.0.0.1", 48002, TransportProtocol::UDP));
+
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    message.set_payload({0x11, 0x22, 0x33});
+
+    ASSERT_EQ(sender.send_message(message, Endpoint("127.0.0.1", 48001, TransportProtocol::UDP)),
+              Result::SUCCESS);
+
+    MessagePtr received = wait_for_message(receiver);
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x1234);
+    EXPECT_EQ(received->get_payload(), message.get_payload());
+
+    EXPECT_EQ(sender.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+TEST_F(ShmTransportTest, SendToMissingPeerFails) {
+    ShmTransport sender(Endpoint("127.0.0.1", 48003, TransportProtocol::UDP));
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    EXPECT_EQ(sender.send_message(message, Endpoint("127.0.0.1", 48999, TransportProtocol::UDP)),
+              Result::NOT_CONNECTED);
+
+    EXPECT_EQ(sender.stop(), Result::SUCCESS);
+}
+
+TEST_F(ShmTransportTest, BurstFromMultipleSenders) {
+    // The ring is multi-producer: several processes (here transports)
+    // may enqueue into one receiver segment concurrently
+    ShmTransport receiver(Endpoint("127.0.0.1", 48004, TransportProtocol::UDP));
+    ShmTransport sender_a(Endpoint("127.0.0.1", 48005, TransportProtocol::UDP));
+    ShmTransport sender_b(Endpoint("127.0.0.1", 48006, TransportProtocol::UDP));
+
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(sender_a.start(), Result::SUCCESS);
+    ASSERT_EQ(sender_b.start(), Result::SUCCESS);
+
+    Endpoint destination("127.0.0.1", 48004, TransportProtocol::UDP);
+    constexpr size_t kPerSender = 100;
+
+    auto send_many = [&destination, kPerSender](ShmTransport& sender, uint16_t client_id) {
+        for (size_t i = 0; i < kPerSender; ++i) {
+            Message message(MessageId{0x1234, 0x0002},
+                            RequestId{client_id, static_cast<uint16_t>(i + 1)});
+            message.set_payload({static_cast<uint8_t>(i)});
+            while (sender.send_message(message, destination) != Result::SUCCESS) {
+                std::this_thread::yield();  // Ring momentarily full
+            }
+        }
+    };
+
+    std::thread thread_a(send_many, std::ref(sender_a), 1);
+    std::thread thread_b(send_many, std::ref(sender_b), 2);
+
+    size_t received_count = 0;
+    while (received_count < 2 * kPerSender) {
+        MessagePtr received = wait_for_message(receiver);
+        ASSERT_NE(received, nullptr) << "Timed out after " << received_count << " messages";
+        ++received_count;
+    }
+
+    thread_a.join();
+    thread_b.join();
+
+    EXPECT_EQ(sender_a.stop(), Result::SUCCESS);
+    EXPECT_EQ(sender_b.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+TEST_F(ShmTransportTest, OversizedFrameRefused) {
+    ShmTransport receiver(Endpoint("127.0.0.1", 48007, TransportProtocol::UDP));
+    ShmTransport sender(Endpoint("127.0.0.1", 48008, TransportProtocol::UDP));
+
+    ASSERT_EQ(receiver.start(), Result::SUCCESS);
+    ASSERT_EQ(sender.start(), Result::SUCCESS);
+
+    Message message(MessageId{0x1234, 0x0003}, RequestId{0x0001, 0x0001});
+    message.set_payload(std::vector<uint8_t>(ShmTransport::SLOT_SIZE, 0xAA));
+
+    EXPECT_EQ(sender.send_message(message, Endpoint("127.0.0.1", 48007, TransportProtocol::UDP)),
+              Result::BUFFER_OVERFLOW);
+
+    EXPECT_EQ(sender.stop(), Result::SUCCESS);
+    EXPECT_EQ(receiver.stop(), Result::SUCCESS);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,160 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "transport/spsc_ring.h"
+
+using namespace someip::transport;
+
+TEST(SpscRingTest, PushPopRoundTrip) {
+    SpscRing<int> ring(8);
+
+    EXPECT_TRUE(ring.empty());
+    EXPECT_TRUE(ring.push(42));
+    EXPECT_EQ(ring.size(), 1u);
+
+    int value = 0;
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(ring.empty());
+
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SpscRingTest, CapacityRoundsUpToPowerOfTwo) {
+    SpscRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+
+    SpscRing<int> exact(16);
+    EXPECT_EQ(exact.capacity(), 16u);
+}
+
+TEST(SpscRingTest, WrapsAroundManyTimes) {
+    SpscRing<int> ring(4);
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(ring.push(i));
+        int value = -1;
+        ASSERT_TRUE(ring.pop(value));
+        ASSERT_EQ(value, i);
+    }
+}
+
+TEST(SpscRingTest, DropNewestRefusesWhenFull) {
+    SpscRing<int> ring(4, OverflowPolicy::DROP_NEWEST);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.push(i));
+    }
+    EXPECT_FALSE(ring.push(99));
+    EXPECT_EQ(ring.dropped_newest(), 1u);
+    EXPECT_EQ(ring.dropped_oldest(), 0u);
+
+    // Backlog preserved in order
+    for (int i = 0; i < 4; ++i) {
+        int value = -1;
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(SpscRingTest, DropOldestEvictsHead) {
+    SpscRing<int> ring(4, OverflowPolicy::DROP_OLDEST);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(ring.push(i));
+    }
+    EXPECT_TRUE(ring.push(99));  // Evicts 0
+    EXPECT_EQ(ring.dropped_oldest(), 1u);
+    EXPECT_EQ(ring.size(), 4u);
+
+    int value = -1;
+    ASSERT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 1);  // 0 was evicted
+}
+
+TEST(SpscRingTest, ReleasesSharedOwnershipOnPop) {
+    SpscRing<std::shared_ptr<int>> ring(4);
+    auto element = std::make_shared<int>(7);
+
+    ASSERT_TRUE(ring.push(element));
+    EXPECT_EQ(element.use_count(), 2);
+
+    std::shared_ptr<int> out;
+    ASSERT_TRUE(ring.pop(out));
+    out.reset();
+    EXPECT_EQ(element.use_count(), 1);  // Ring keeps no stale reference
+}
+
+TEST(SpscRingTest, ConcurrentProducerConsumer) {
+    SpscRing<int> ring(64);
+    constexpr int kCount = 20000;
+
+    std::thread producer([&ring] {
+        for (int i = 0; i < kCount; ++i) {
+            while (!ring.push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    while (expected < kCount) {
+        int value = -1;
+        if (ring.pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingTest, ConcurrentDropOldestNeverLosesMoreThanDropped) {
+    // Slow consumer + fast producer under DROP_OLDEST: every pushed
+    // element is either consumed or counted as dropped
+    SpscRing<int> ring(16, OverflowPolicy::DROP_OLDEST);
+    constexpr int kCount = 10000;
+    std::atomic<int> consumed{0};
+    std::atomic<bool> done{false};
+
+    std::thread consumer([&] {
+        int value = -1;
+        while (!done.load() || !ring.empty()) {
+            if (ring.pop(value)) {
+                consumed.fetch_add(1);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (int i = 0; i < kCount; ++i) {
+        ASSERT_TRUE(ring.push(i));  // DROP_OLDEST push always succeeds
+    }
+    done = true;
+    consumer.join();
+
+    EXPECT_EQ(static_cast<uint64_t>(consumed.load()) + ring.dropped_oldest(),
+              static_cast<uint64_t>(kCount));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "core/static_router.h"
+
+using namespace someip;
+
+namespace {
+
+std::vector<std::string>& call_log() {
+    static std::vector<std::string> log;
+    return log;
+}
+
+void handle_read(const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+    out = in;
+    call_log().push_back("read");
+}
+
+void handle_write(const std::vector<uint8_t>& in, std::vector<uint8_t>& out) {
+    out.assign(in.rbegin(), in.rend());
+    call_log().push_back("write");
+}
+
+void handle_other(const std::vector<uint8_t>&, std::vector<uint8_t>& out) {
+    out = {0xFF};
+    call_log().push_back("other");
+}
+
+using Router = StaticRouter<Route<0x1234, 0x0001, &handle_read>,
+                            Route<0x1234, 0x0002, &handle_write>,
+                            Route<0x5678, 0x0001, &handle_other>>;
+
+} // namespace
+
+// The table is fully resolved at compile time
+static_assert(Router::route_count == 3);
+static_assert(Router::contains(0x1234, 0x0001));
+static_assert(Router::contains(0x5678, 0x0001));
+static_assert(!Router::contains(0x1234, 0x0003));
+static_assert(Router::contains_service(0x1234));
+static_assert(!Router::contains_service(0x9999));
+
+TEST(StaticRouterTest, DispatchesToMatchingHandler) {
+    call_log().clear();
+
+    std::vector<uint8_t> in = {1, 2, 3};
+    std::vector<uint8_t> out;
+
+    EXPECT_TRUE(Router::dispatch(0x1234, 0x0001, in, out));
+    EXPECT_EQ(out, in);
+
+    EXPECT_TRUE(Router::dispatch(0x1234, 0x0002, in, out));
+    EXPECT_EQ(out, (std::vector<uint8_t>{3, 2, 1}));
+
+    EXPECT_TRUE(Router::dispatch(0x5678, 0x0001, in, out));
+    EXPECT_EQ(out, (std::vector<uint8_t>{0xFF}));
+
+    EXPECT_EQ(call_log(), (std::vector<std::string>{"read", "write", "other"}));
+}
+
+TEST(StaticRouterTest, UnroutedReturnsFalse) {
+    std::vector<uint8_t> in;
+    std::vector<uint8_t> out = {9};
+
+    EXPECT_FALSE(Router::dispatch(0x1234, 0x0003, in, out));
+    EXPECT_FALSE(Router::dispatch(0x9999, 0x0001, in, out));
+    EXPECT_EQ(out, (std::vector<uint8_t>{9}));  // Untouched
+}
+
+namespace {
+void double_value(int& value) { value *= 2; }
+} // namespace
+
+TEST(StaticRouterTest, DifferentSignatureRoutes) {
+    // Handler signatures are enforced per dispatch call: mismatched
+    // arguments fail to compile (C++17 has no lambda template args)
+    using IntRouter = StaticRouter<Route<0x0001, 0x0001, &double_value>>;
+
+    int value = 21;
+    EXPECT_TRUE(IntRouter::dispatch(0x0001, 0x0001, value));
+    EXPECT_EQ(value, 42);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
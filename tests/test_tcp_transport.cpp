@@ -324,12 +324,9 @@ TEST_F(TcpTransportTest, TransportLifecycle) {
     transport.stop();
 }
 
-// Integration-style test for message sending/receiving
-// Note: This test requires proper server setup and may be skipped in CI
-TEST_F(TcpTransportTest, DISABLED_MessageRoundTrip) {
-    // This test would require setting up a TCP server and client
-    // For now, it's disabled but shows the intended test structure
-
+// Integration-style test for message sending/receiving over the
+// event-loop connection engine
+TEST_F(TcpTransportTest, MessageRoundTrip) {
     TcpTransport client_transport(config);
     TcpTransport server_transport(config);
 
@@ -365,8 +362,19 @@ TEST_F(TcpTransportTest, DISABLED_MessageRoundTrip) {
     result = client_transport.send_message(test_message, server_endpoint);
     ASSERT_EQ(result, Result::SUCCESS);
 
-    // Server should receive the message
-    // (This would require proper listener setup and synchronization)
+    // Server must surface the message through receive_message()
+    MessagePtr received;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!received && std::chrono::steady_clock::now() < deadline) {
+        received = server_transport.receive_message();
+        if (!received) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_service_id(), 0x1234);
+    EXPECT_EQ(received->get_payload(), test_message.get_payload());
+    EXPECT_EQ(server_transport.get_connection_count(), 1u);
 
     // Clean up
     client_transport.disconnect();
@@ -374,6 +382,142 @@ TEST_F(TcpTransportTest, DISABLED_MessageRoundTrip) {
     server_transport.stop();
 }
 
+TEST_F(TcpTransportTest, SmallMessageBurstInOneStream) {
+    // Many small frames typically coalesce into few TCP segments; the
+    // framing stage must emit them all without head-of-buffer shifts
+    TcpTransport server(config);
+    Endpoint server_endpoint("127.0.0.1", 30510);
+    ASSERT_EQ(server.initialize(server_endpoint), Result::SUCCESS);
+    ASSERT_EQ(server.enable_server_mode(), Result::SUCCESS);
+    ASSERT_EQ(server.start(), Result::SUCCESS);
+
+    TcpTransport client(config);
+    ASSERT_EQ(client.initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+    ASSERT_EQ(client.start(), Result::SUCCESS);
+    ASSERT_EQ(client.connect(server_endpoint), Result::SUCCESS);
+
+    constexpr size_t kBurst = 200;
+    for (size_t i = 0; i < kBurst; ++i) {
+        Message message(MessageId(0x1234, 0x0004),
+                        RequestId(0x0001, static_cast<uint16_t>(i + 1)));
+        message.set_payload({static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8)});
+        ASSERT_EQ(client.send_message(message, server_endpoint), Result::SUCCESS);
+    }
+
+    size_t received = 0;
+    uint16_t expected_session = 1;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (received < kBurst && std::chrono::steady_clock::now() < deadline) {
+        MessagePtr message = server.receive_message();
+        if (message) {
+            // Stream order must be preserved
+            EXPECT_EQ(message->get_session_id(), expected_session++);
+            ++received;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(received, kBurst);
+
+    client.disconnect();
+    client.stop();
+    server.stop();
+}
+
+TEST_F(TcpTransportTest, ZeroCopyLargePayloadRoundTrip) {
+    // Flash-update-sized payload over the MSG_ZEROCOPY path (falls
+    // back to the copy path transparently where unsupported)
+    TcpTransportConfig zc_config = config;
+    zc_config.zerocopy_enabled = true;
+    zc_config.zerocopy_threshold = 4096;
+    zc_config.max_receive_buffer = 256 * 1024;
+
+    TcpTransport server(zc_config);
+    Endpoint server_endpoint("127.0.0.1", 30509);
+    ASSERT_EQ(server.initialize(server_endpoint), Result::SUCCESS);
+    ASSERT_EQ(server.enable_server_mode(), Result::SUCCESS);
+    ASSERT_EQ(server.start(), Result::SUCCESS);
+
+    TcpTransport client(zc_config);
+    ASSERT_EQ(client.initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+    ASSERT_EQ(client.start(), Result::SUCCESS);
+    ASSERT_EQ(client.connect(server_endpoint), Result::SUCCESS);
+
+    // Largest payload the TCP framing parser accepts today
+    std::vector<uint8_t> payload(48 * 1024);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i * 37);
+    }
+
+    auto message = std::make_shared<Message>(MessageId(0x1234, 0x0003),
+                                             RequestId(0xABCD, 0x0002));
+    message->set_payload(payload);
+
+    ASSERT_EQ(client.send_message(message, server_endpoint), Result::SUCCESS);
+
+    MessagePtr received;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (!received && std::chrono::steady_clock::now() < deadline) {
+        received = server.receive_message();
+        if (!received) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    ASSERT_NE(received, nullptr);
+    EXPECT_EQ(received->get_payload().size(), payload.size());
+    EXPECT_EQ(received->get_payload(), payload);
+
+    client.disconnect();
+    client.stop();
+    server.stop();
+}
+
+TEST_F(TcpTransportTest, MultipleConcurrentClients) {
+    // The connection engine must service several clients at once and
+    // route replies by endpoint
+    TcpTransportConfig server_config = config;
+    server_config.max_connections = 16;
+    TcpTransport server(server_config);
+
+    Endpoint server_endpoint("127.0.0.1", 30508);
+    ASSERT_EQ(server.initialize(server_endpoint), Result::SUCCESS);
+    ASSERT_EQ(server.enable_server_mode(16), Result::SUCCESS);
+    ASSERT_EQ(server.start(), Result::SUCCESS);
+
+    constexpr size_t kClientCount = 8;
+    std::vector<std::unique_ptr<TcpTransport>> clients;
+    for (size_t i = 0; i < kClientCount; ++i) {
+        clients.push_back(std::make_unique<TcpTransport>(config));
+        ASSERT_EQ(clients[i]->initialize(Endpoint("127.0.0.1", 0)), Result::SUCCESS);
+        ASSERT_EQ(clients[i]->start(), Result::SUCCESS);
+        ASSERT_EQ(clients[i]->connect(server_endpoint), Result::SUCCESS);
+
+        Message message(MessageId(0x1234, 0x0002),
+                        RequestId(static_cast<uint16_t>(i + 1), 0x0001));
+        message.set_payload({static_cast<uint8_t>(i)});
+        ASSERT_EQ(clients[i]->send_message(message, server_endpoint), Result::SUCCESS);
+    }
+
+    // Server receives one message per client
+    size_t received_count = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    while (received_count < kClientCount && std::chrono::steady_clock::now() < deadline) {
+        if (server.receive_message()) {
+            ++received_count;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    EXPECT_EQ(received_count, kClientCount);
+    EXPECT_EQ(server.get_connection_count(), kClientCount);
+
+    for (auto& client : clients) {
+        client->disconnect();
+        client->stop();
+    }
+    server.stop();
+}
+
 TEST_F(TcpTransportTest, ResourceCleanup) {
     // Test that resources are properly cleaned up
     {
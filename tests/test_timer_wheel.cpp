@@ -0,0 +1,152 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "common/timer_wheel.h"
+
+using namespace someip;
+using namespace std::chrono_literals;
+
+namespace {
+
+void wait_until(const std::function<bool()>& done, int timeout_ms = 3000) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (!done() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+} // namespace
+
+TEST(TimerWheelTest, OneShotFires) {
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    std::atomic<bool> fired{false};
+    auto start = std::chrono::steady_clock::now();
+    wheel.schedule(50ms, [&] { fired = true; });
+
+    wait_until([&] { return fired.load(); });
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(fired.load());
+    EXPECT_GE(elapsed, 40ms);  // Not early
+    EXPECT_EQ(wheel.pending_count(), 0u);
+    wheel.stop();
+}
+
+TEST(TimerWheelTest, CancelPreventsFiring) {
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    std::atomic<bool> fired{false};
+    auto id = wheel.schedule(100ms, [&] { fired = true; });
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.cancel(id));  // Already gone
+
+    std::this_thread::sleep_for(200ms);
+    EXPECT_FALSE(fired.load());
+    wheel.stop();
+}
+
+TEST(TimerWheelTest, RecurringFiresRepeatedly) {
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    std::atomic<int> count{0};
+    auto id = wheel.schedule_recurring(30ms, [&] { count++; });
+
+    wait_until([&] { return count.load() >= 3; });
+    EXPECT_GE(count.load(), 3);
+
+    EXPECT_TRUE(wheel.cancel(id));
+    int at_cancel = count.load();
+    std::this_thread::sleep_for(150ms);
+    EXPECT_LE(count.load(), at_cancel + 1);  // At most one in-flight firing
+    wheel.stop();
+}
+
+TEST(TimerWheelTest, LongDelayCascadesAcrossLevels) {
+    // 5ms tick: level 0 spans 1.28s, so 2s must cascade from level 1
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    std::atomic<bool> fired{false};
+    auto start = std::chrono::steady_clock::now();
+    wheel.schedule(2000ms, [&] { fired = true; });
+
+    wait_until([&] { return fired.load(); }, 4000);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(fired.load());
+    EXPECT_GE(elapsed, 1900ms);
+    EXPECT_LE(elapsed, 3000ms);
+    wheel.stop();
+}
+
+TEST(TimerWheelTest, JitterSpreadsFirings) {
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    // Many timers with the same base delay and a wide jitter window
+    // must not all land on the same tick
+    std::mutex mutex;
+    std::vector<std::chrono::steady_clock::time_point> firings;
+    auto start = std::chrono::steady_clock::now();
+    constexpr int kTimers = 20;
+
+    for (int i = 0; i < kTimers; ++i) {
+        wheel.schedule(50ms,
+                       [&] {
+                           std::scoped_lock lock(mutex);
+                           firings.push_back(std::chrono::steady_clock::now());
+                       },
+                       300ms);
+    }
+
+    wait_until([&] {
+        std::scoped_lock lock(mutex);
+        return firings.size() == kTimers;
+    }, 5000);
+
+    std::scoped_lock lock(mutex);
+    ASSERT_EQ(firings.size(), static_cast<size_t>(kTimers));
+
+    auto min_time = *std::min_element(firings.begin(), firings.end());
+    auto max_time = *std::max_element(firings.begin(), firings.end());
+    auto spread = std::chrono::duration_cast<std::chrono::milliseconds>(max_time - min_time);
+    EXPECT_GT(spread.count(), 50);  // Genuinely spread, not a burst
+    EXPECT_GE(std::chrono::duration_cast<std::chrono::milliseconds>(
+                  min_time - start).count(), 40);
+    wheel.stop();
+}
+
+TEST(TimerWheelTest, StopDropsPendingTimers) {
+    TimerWheel wheel(5ms);
+    wheel.start();
+
+    std::atomic<bool> fired{false};
+    wheel.schedule(100ms, [&] { fired = true; });
+    wheel.stop();
+
+    std::this_thread::sleep_for(200ms);
+    EXPECT_FALSE(fired.load());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
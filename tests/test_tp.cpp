@@ -17,6 +17,7 @@
 #include <tp/tp_reassembler.h>
 #include <someip/message.h>
 #include <thread>
+#include <set>
 
 using namespace someip;
 using namespace someip::tp;
@@ -245,3 +246,316 @@ TEST_F(TpTest, StatisticsTracking) {
 
     tp_manager.shutdown();
 }
+
+TEST(TpSegmentViewTest, ViewsMatchOwningSegmentsByteForByte) {
+    using namespace someip;
+    using namespace someip::tp;
+
+    TpConfig config;
+    config.max_segment_size = 256;
+
+    Message message(MessageId{0x1234, 0x0001}, RequestId{0x0001, 0x0001});
+    std::vector<uint8_t> payload(2000);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i * 17);
+    }
+    message.set_payload(payload);
+
+    TpSegmenter owning_segmenter(config);
+    std::vector<TpSegment> owning;
+    ASSERT_EQ(owning_segmenter.segment_message(message, owning), TpResult::SUCCESS);
+
+    TpSegmenter view_segmenter(config);
+    TpSegmentedMessage segmented;
+    ASSERT_EQ(view_segmenter.segment_message(message, segmented), TpResult::SUCCESS);
+
+    ASSERT_EQ(segmented.views.size(), owning.size());
+    for (size_t i = 0; i < owning.size(); ++i) {
+        const TpSegmentView& view = segmented.views[i];
+        EXPECT_EQ(view.header.message_type, owning[i].header.message_type);
+        EXPECT_EQ(view.header.segment_offset, owning[i].header.segment_offset);
+        EXPECT_EQ(view.length, owning[i].payload.size());
+        EXPECT_TRUE(std::equal(owning[i].payload.begin(), owning[i].payload.end(),
+                               segmented.data(view)));
+    }
+}
+
+TEST(TpSegmentViewTest, ManagerViewPathReassemblesRoundTrip) {
+    using namespace someip;
+    using namespace someip::tp;
+
+    TpConfig config;
+    config.max_segment_size = 300;
+
+    TpManager sender(config);
+    TpManager receiver(config);
+    ASSERT_TRUE(sender.initialize());
+    ASSERT_TRUE(receiver.initialize());
+
+    Message message(MessageId{0x1234, 0x0002}, RequestId{0x0001, 0x0002});
+    std::vector<uint8_t> payload(5000);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i * 31 + 5);
+    }
+    message.set_payload(payload);
+
+    uint32_t transfer_id = 0;
+    ASSERT_EQ(sender.segment_message(message, transfer_id), TpResult::SUCCESS);
+
+    // Drive zero-copy views into the receiver via a copying shim (the
+    // wire would use vectored send)
+    std::vector<uint8_t> complete;
+    bool delivered = false;
+    while (true) {
+        TpSegmentHeader header;
+        const uint8_t* data = nullptr;
+        size_t length = 0;
+        bool done = false;
+        ASSERT_EQ(sender.get_next_segment_view(transfer_id, header, data, length, done),
+                  TpResult::SUCCESS);
+        if (done) {
+            break;
+        }
+
+        TpSegment wire;
+        wire.header = header;
+        wire.payload.assign(data, data + length);
+        if (receiver.handle_received_segment(wire, complete)) {
+            delivered = true;
+        }
+    }
+
+    ASSERT_TRUE(delivered);
+    // Reassembled bytes are the original payload
+    ASSERT_EQ(complete.size(), payload.size());
+    EXPECT_EQ(complete, payload);
+}
+
+TEST(TpSackTest, LossyLinkSackRetransmissionCompletes) {
+    using namespace someip;
+    using namespace someip::tp;
+
+    TpConfig config;
+    config.max_segment_size = 256;
+    config.window_size = 8;
+    config.retry_timeout = std::chrono::milliseconds(40);
+    config.max_retries = 10;
+
+    TpManager sender(config);
+    TpManager receiver(config);
+    ASSERT_TRUE(sender.initialize());
+    ASSERT_TRUE(receiver.initialize());
+
+    Message message(MessageId{0x1234, 0x0003}, RequestId{0x0001, 0x0003});
+    std::vector<uint8_t> payload(10000);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<uint8_t>(i * 23 + 1);
+    }
+    message.set_payload(payload);
+
+    uint32_t transfer_id = 0;
+    ASSERT_EQ(sender.segment_message(message, transfer_id), TpResult::SUCCESS);
+
+    // Drop every 5th first-time delivery; retransmissions get through
+    std::set<uint16_t> dropped_once;
+    size_t delivery_count = 0;
+    uint8_t sequence_number = 0;
+    std::vector<uint8_t> complete;
+    bool delivered = false;
+
+    auto deliver = [&](const TpSegmentHeader& header, const uint8_t* data, size_t length,
+                       bool allow_drop) {
+        if (allow_drop && ++delivery_count % 5 == 0 &&
+            dropped_once.insert(header.segment_offset).second) {
+            return;  // Lost on the wire
+        }
+        sequence_number = header.sequence_number;
+        TpSegment wire;
+        wire.header = header;
+        wire.payload.assign(data, data + length);
+        // handle_received_segment returns true for any accepted
+        // segment; completion is signalled by the filled output
+        receiver.handle_received_segment(wire, complete);
+        if (!complete.empty()) {
+            delivered = true;
+        }
+    };
+
+    bool all_sent = false;
+    for (int round = 0; round < 300 && !delivered; ++round) {
+        // Send whatever the window allows
+        while (!all_sent) {
+            TpSegmentHeader header;
+            const uint8_t* data = nullptr;
+            size_t length = 0;
+            bool done = false;
+            ASSERT_EQ(sender.get_next_segment_view(transfer_id, header, data, length, done),
+                      TpResult::SUCCESS);
+            if (done) {
+                all_sent = true;
+                break;
+            }
+            if (data == nullptr) {
+                break;  // Window closed until acks arrive
+            }
+            deliver(header, data, length, true);
+        }
+
+        // Receiver reports its SACK; sender slides the window
+        std::vector<uint32_t> sack;
+        if (receiver.get_reassembly_sack(sequence_number, sack)) {
+            ASSERT_EQ(sender.acknowledge_segments(transfer_id, sack), TpResult::SUCCESS);
+        }
+
+        // Only the missing segments are retransmitted
+        while (true) {
+            TpSegmentHeader header;
+            const uint8_t* data = nullptr;
+            size_t length = 0;
+            bool available = false;
+            TpResult result = sender.get_retransmit_segment_view(transfer_id, header, data,
+                                                                 length, available);
+            ASSERT_NE(result, TpResult::TIMEOUT) << "transfer failed";
+            if (!available) {
+                break;
+            }
+            deliver(header, data, length, false);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    ASSERT_TRUE(delivered);
+    EXPECT_EQ(complete, payload);
+
+    auto stats = sender.get_statistics();
+    EXPECT_GT(stats.retransmissions, 0u);
+    // Selective: far fewer retransmissions than segments sent
+    EXPECT_LT(stats.retransmissions, stats.segments_sent / 2);
+}
+
+TEST(TpSchedulerTest, PriorityOrderAndPacing) {
+    using namespace someip;
+    using namespace someip::tp;
+
+    TpConfig config;
+    config.max_segment_size = 500;
+    config.window_size = 1000;
+    config.enable_acknowledgments = false;
+    config.pacing_rate_bytes_per_sec = 200000;  // 200KB/s
+    config.pacing_burst_segments = 4;           // 2KB bucket
+
+    TpManager manager(config);
+    ASSERT_TRUE(manager.initialize());
+
+    auto make_transfer = [&](uint16_t method, uint8_t priority) {
+        Message message(MessageId{0x1234, method}, RequestId{0x0001, method});
+        message.set_payload(std::vector<uint8_t>(8000, static_cast<uint8_t>(method)));
+        uint32_t id = 0;
+        EXPECT_EQ(manager.segment_message(message, id), TpResult::SUCCESS);
+        EXPECT_EQ(manager.set_transfer_priority(id, priority), TpResult::SUCCESS);
+        return id;
+    };
+
+    uint32_t bulk = make_transfer(1, 7);      // Firmware-style, low priority
+    uint32_t urgent = make_transfer(2, 0);    // Diagnostic, high priority
+
+    // First batch: the bucket holds ~4 segments, all from the urgent
+    // transfer despite the bulk one being registered first
+    std::vector<TpTransmitItem> batch;
+    ASSERT_EQ(manager.get_transmit_batch(batch, 64), TpResult::SUCCESS);
+    ASSERT_FALSE(batch.empty());
+    EXPECT_LE(batch.size(), 5u);  // Bucket-limited, not window-limited
+    for (const auto& item : batch) {
+        EXPECT_EQ(item.transfer_id, urgent);
+    }
+
+    // Drain with simulated time: total bytes over ~100ms must respect
+    // the configured rate plus the initial burst
+    size_t total_bytes = 0;
+    for (const auto& item : batch) total_bytes += item.length;
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(100)) {
+        ASSERT_EQ(manager.get_transmit_batch(batch, 64), TpResult::SUCCESS);
+        for (const auto& item : batch) total_bytes += item.length;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    // 200KB/s * 0.1s = 20KB, + 2KB burst, with slack for timing
+    EXPECT_LT(total_bytes, 35000u);
+    EXPECT_GT(total_bytes, 10000u);
+    (void)bulk;
+}
+
+TEST(TpStreamingTest, OversizedTransferStreamsThroughSink) {
+    using namespace someip;
+    using namespace someip::tp;
+
+    TpConfig config;
+    config.max_segment_size = 1000;
+    config.max_message_size = 4000;       // Anything bigger must stream
+    config.reorder_window_bytes = 8000;
+
+    TpManager manager(config);
+    ASSERT_TRUE(manager.initialize());
+
+    const uint32_t kTotal = 20000;
+    uint64_t sink_bytes = 0;
+    uint64_t next_expected = 0;
+    bool in_order = true;
+    bool finished = false;
+    manager.set_chunk_sink([&](uint8_t, uint64_t offset, const uint8_t* data, size_t length,
+                               bool final_chunk) {
+        if (offset != next_expected) {
+            in_order = false;
+        }
+        for (size_t i = 0; i < length; ++i) {
+            if (data[i] != static_cast<uint8_t>((offset + i) * 7)) {
+                in_order = false;
+            }
+        }
+        next_expected = offset + length;
+        sink_bytes += length;
+        finished = final_chunk;
+    });
+
+    // Feed segments with adjacent pairs swapped to exercise reordering
+    std::vector<TpSegment> pair;
+    std::vector<uint8_t> unused;
+    uint32_t offset = 0;
+    bool first = true;
+    while (offset < kTotal) {
+        size_t length = std::min<uint32_t>(config.max_segment_size - (first ? 16 : 0),
+                                           kTotal - offset);
+        TpSegment segment;
+        segment.header.sequence_number = 3;
+        segment.header.message_length = kTotal;
+        segment.header.segment_offset = offset;
+        segment.header.message_type =
+            first ? TpMessageType::FIRST_SEGMENT
+                  : (offset + length == kTotal ? TpMessageType::LAST_SEGMENT
+                                               : TpMessageType::CONSECUTIVE_SEGMENT);
+        size_t header_bytes = first ? 16 : 0;
+        segment.payload.resize(length + header_bytes);
+        for (size_t i = 0; i < length; ++i) {
+            segment.payload[header_bytes + i] = static_cast<uint8_t>((offset + i) * 7);
+        }
+        segment.header.segment_length = static_cast<uint16_t>(segment.payload.size());
+        first = false;
+        offset += static_cast<uint32_t>(length);
+
+        pair.push_back(std::move(segment));
+        if (pair.size() == 2) {
+            manager.handle_received_segment(pair[1], unused);
+            manager.handle_received_segment(pair[0], unused);
+            pair.clear();
+        }
+    }
+    for (auto& segment : pair) {
+        manager.handle_received_segment(segment, unused);
+    }
+
+    EXPECT_EQ(sink_bytes, kTotal);
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(finished);
+}
@@ -0,0 +1,42 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#ifndef SOMEIP_TOOLS_CAPTURE_FORMAT_H
+#define SOMEIP_TOOLS_CAPTURE_FORMAT_H
+
+// Compact binary capture log shared by someip_capture / someip_replay:
+//   CaptureFileHeader, then back-to-back { CaptureRecordHeader, bytes }.
+
+#include <cstdint>
+
+namespace someip {
+namespace tools {
+
+constexpr uint32_t CAPTURE_MAGIC = 0x53504341;  // "ACPS"
+constexpr uint32_t CAPTURE_VERSION = 1;
+
+struct CaptureFileHeader {
+    uint32_t magic{CAPTURE_MAGIC};
+    uint32_t version{CAPTURE_VERSION};
+    uint64_t frame_count{0};
+};
+
+struct CaptureRecordHeader {
+    uint64_t timestamp_ns{0};  // Monotonic, relative to capture start
+    uint32_t length{0};        // Frame bytes that follow
+};
+
+} // namespace tools
+} // namespace someip
+
+#endif // SOMEIP_TOOLS_CAPTURE_FORMAT_H
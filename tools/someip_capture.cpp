@@ -0,0 +1,96 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+// Records SOME/IP traffic arriving on a UDP port into the compact
+// binary capture log. Usage:
+//   someip_capture <listen_port> <output.scap> [duration_seconds]
+
+#include "capture_format.h"
+#include "transport/udp_transport.h"
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using namespace someip;
+using namespace someip::transport;
+using namespace someip::tools;
+
+static volatile std::sig_atomic_t g_stop = 0;
+static void on_signal(int) { g_stop = 1; }
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <listen_port> <output.scap> [duration_s]\n", argv[0]);
+        return 2;
+    }
+
+    uint16_t port = static_cast<uint16_t>(std::atoi(argv[1]));
+    const char* path = argv[2];
+    int duration_s = argc > 3 ? std::atoi(argv[3]) : 0;
+
+    std::FILE* out = std::fopen(path, "wb");
+    if (!out) {
+        std::perror("fopen");
+        return 1;
+    }
+
+    CaptureFileHeader header;
+    std::fwrite(&header, sizeof(header), 1, out);
+
+    UdpTransport transport(Endpoint("0.0.0.0", port, TransportProtocol::UDP));
+    if (transport.start() != Result::SUCCESS) {
+        std::fprintf(stderr, "cannot bind port %u\n", port);
+        return 1;
+    }
+
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = duration_s > 0 ? start + std::chrono::seconds(duration_s)
+                                   : std::chrono::steady_clock::time_point::max();
+    uint64_t frames = 0;
+
+    while (!g_stop && std::chrono::steady_clock::now() < deadline) {
+        MessagePtr message = transport.receive_message();
+        if (!message) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+
+        auto bytes = message->serialize();
+        CaptureRecordHeader record;
+        record.timestamp_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+        record.length = static_cast<uint32_t>(bytes.size());
+        std::fwrite(&record, sizeof(record), 1, out);
+        std::fwrite(bytes.data(), 1, bytes.size(), out);
+        ++frames;
+    }
+
+    (void)transport.stop();
+
+    // Patch the frame count into the header
+    header.frame_count = frames;
+    std::fseek(out, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, out);
+    std::fclose(out);
+
+    std::printf("captured %llu frames to %s\n",
+                static_cast<unsigned long long>(frames), path);
+    return 0;
+}
@@ -0,0 +1,148 @@
+/********************************************************************************
+ * Copyright (c) 2025 Vinicius Tadeu Zein
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+// Replays a capture log against a UDP endpoint. Usage:
+//   someip_replay <log.scap> <ip> <port> <recorded|max|fixed:<pps>> [threads]
+// Reports achieved rate, send failures, and the send-call latency
+// distribution (p50/p99/max).
+
+#include "capture_format.h"
+#include "common/latency_histogram.h"
+#include "transport/udp_transport.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace someip;
+using namespace someip::transport;
+using namespace someip::tools;
+
+struct Frame {
+    uint64_t timestamp_ns;
+    std::vector<uint8_t> bytes;
+};
+
+int main(int argc, char** argv) {
+    if (argc < 5) {
+        std::fprintf(stderr,
+                     "usage: %s <log.scap> <ip> <port> <recorded|max|fixed:<pps>> [threads]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    const char* path = argv[1];
+    std::string ip = argv[2];
+    uint16_t port = static_cast<uint16_t>(std::atoi(argv[3]));
+    std::string mode = argv[4];
+    int thread_count = argc > 5 ? std::atoi(argv[5]) : 1;
+
+    // Load the log
+    std::FILE* in = std::fopen(path, "rb");
+    if (!in) {
+        std::perror("fopen");
+        return 1;
+    }
+    CaptureFileHeader header;
+    if (std::fread(&header, sizeof(header), 1, in) != 1 || header.magic != CAPTURE_MAGIC) {
+        std::fprintf(stderr, "not a capture log\n");
+        return 1;
+    }
+    std::vector<Frame> frames;
+    frames.reserve(header.frame_count);
+    CaptureRecordHeader record;
+    while (std::fread(&record, sizeof(record), 1, in) == 1) {
+        Frame frame;
+        frame.timestamp_ns = record.timestamp_ns;
+        frame.bytes.resize(record.length);
+        if (std::fread(frame.bytes.data(), 1, record.length, in) != record.length) {
+            break;
+        }
+        frames.push_back(std::move(frame));
+    }
+    std::fclose(in);
+    std::printf("loaded %zu frames\n", frames.size());
+    if (frames.empty()) {
+        return 1;
+    }
+
+    uint64_t fixed_interval_ns = 0;
+    bool recorded_speed = mode == "recorded";
+    if (mode.rfind("fixed:", 0) == 0) {
+        long pps = std::atol(mode.c_str() + 6);
+        fixed_interval_ns = pps > 0 ? 1000000000ull / pps : 0;
+    }
+
+    Endpoint destination(ip, port, TransportProtocol::UDP);
+    std::atomic<uint64_t> sent{0}, failed{0};
+    LatencyHistogram send_latency;
+
+    auto worker = [&](int index) {
+        UdpTransport transport(Endpoint("0.0.0.0", 0, TransportProtocol::UDP));
+        if (transport.start() != Result::SUCCESS) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = index; i < frames.size(); i += thread_count) {
+            const Frame& frame = frames[i];
+
+            if (recorded_speed) {
+                auto due = start + std::chrono::nanoseconds(frame.timestamp_ns);
+                while (std::chrono::steady_clock::now() < due) {
+                }
+            } else if (fixed_interval_ns > 0) {
+                auto due = start + std::chrono::nanoseconds(
+                                       fixed_interval_ns * (i / thread_count));
+                while (std::chrono::steady_clock::now() < due) {
+                }
+            }
+
+            auto send_start = std::chrono::steady_clock::now();
+            Result result = transport.send_packed(frame.bytes, destination);
+            send_latency.record(std::chrono::steady_clock::now() - send_start);
+            if (result == Result::SUCCESS) {
+                sent.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                failed.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        (void)transport.stop();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+    auto percentiles = send_latency.snapshot();
+    std::printf("replayed %llu frames (%llu failed) in %.3fs: %.0f frames/s\n",
+                static_cast<unsigned long long>(sent.load()),
+                static_cast<unsigned long long>(failed.load()), seconds,
+                static_cast<double>(sent.load()) / seconds);
+    std::printf("send latency: p50=%lluus p99=%lluus max=%lluus\n",
+                static_cast<unsigned long long>(percentiles.p50_us),
+                static_cast<unsigned long long>(percentiles.p99_us),
+                static_cast<unsigned long long>(percentiles.max_us));
+    return failed.load() == 0 ? 0 : 1;
+}